@@ -22,7 +22,15 @@ FetchContent_MakeAvailable(glfw)
 # ─────────────────────────────────────────────────────────────
 # GLAD - OpenGL function loading
 # Abstracted internally by Pixel Runtime.
-# ─────────────────────────────────────────────────────────────
+#
+# Only the OpenGL 3.3 core profile the runtime uses is generated,
+# plus program binaries for the shader cache. The default of every
+# version and extension makes gladLoadGLLoader() resolve thousands
+# of entry points and scan the extension list at startup.
+# ─────────────────────────────────────────────────────────────
+set(GLAD_PROFILE "core" CACHE STRING "OpenGL profile")
+set(GLAD_API "gl=3.3" CACHE STRING "API type/version pairs")
+set(GLAD_EXTENSIONS "GL_ARB_get_program_binary" CACHE STRING "Extensions to include")
 FetchContent_Declare(
         glad
         GIT_REPOSITORY https://github.com/Dav1dde/glad.git
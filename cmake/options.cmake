@@ -13,3 +13,35 @@
 # Default: ON
 # ─────────────────────────────────────────────────────────────
 option(PXR_BUILD_EXAMPLES "Build example applications" ON)
+
+# ─────────────────────────────────────────────────────────────
+# Option: X11 MIT-SHM Presenter
+# Enable to build the `x11` backend, which presents frames
+# through X11 shared-memory images without OpenGL. Requires
+# Xlib and Xext; ignored on platforms other than Linux.
+#
+# Default: ON
+# ─────────────────────────────────────────────────────────────
+option(PXR_WITH_X11_SHM "Build the X11 MIT-SHM software presenter" ON)
+
+# ─────────────────────────────────────────────────────────────
+# Option: Reload Host
+# Enable to build `pxr_host`, which runs apps built as shared
+# libraries with PXR_RELOADABLE_MAIN and reloads them when they
+# are rebuilt. Ignored on Windows.
+#
+# Default: ON
+# ─────────────────────────────────────────────────────────────
+option(PXR_BUILD_HOST "Build the pxr_host app reloader" ON)
+
+# ─────────────────────────────────────────────────────────────
+# Option: Allocation Tracking
+# Enable to replace the global operator new with one that counts
+# allocations per frame and per profiler zone, for
+# `App::setAllocationCheck()` and the `PXR_PROFILE` report.
+# Adds an atomic update to every allocation; meant for debug
+# and test builds.
+#
+# Default: OFF
+# ─────────────────────────────────────────────────────────────
+option(PXR_TRACK_ALLOCATIONS "Count heap allocations per frame and profiler zone" OFF)
@@ -0,0 +1,119 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <pxr/pixel_runtime.h>
+#include <string>
+#include <vector>
+
+/**
+ * @class PixelAssets
+ * @brief A gallery whose images pop in as their background loads finish.
+ *
+ * Demonstrates how to:
+ * - Start many loads from setup() without blocking with loadImage()
+ * - Check a handle's state every frame and draw images once they are ready
+ * - Spread the hand-over of finished loads with setAssetCommitBudget()
+ * - Pick up edited files with setHotReload(); press Space to rewrite a tile
+ */
+class PixelAssets final : public pxr::App {
+	//--------------------------------------------------------------------------
+	// Members
+	//--------------------------------------------------------------------------
+
+	static constexpr int Columns = 8; ///< Tiles per row.
+	static constexpr int Rows = 5; ///< Tile rows.
+	static constexpr int TileSize = 64; ///< Image width and height in pixels.
+	static constexpr int Margin = 16; ///< Space above the grid for the status line.
+
+	std::vector<pxr::ImageHandle> images; ///< One handle per tile.
+	int edits = 0; ///< Tiles rewritten so far.
+	bool spaceWasPressed = false; ///< Space state in the previous frame.
+
+	//--------------------------------------------------------------------------
+	// Lifecycle
+	//--------------------------------------------------------------------------
+
+	/**
+	 * @brief Writes the demo images and starts loading all of them.
+	 */
+	void setup() override {
+		setTitle("Pixel Assets - Pixel Runtime Demo");
+		setSize(Columns * TileSize, Rows * TileSize + Margin);
+		setPixelSize(2);
+		setVSync(true);
+		setAssetCommitBudget(4 * TileSize * TileSize * sizeof(uint32_t)); // Four images per frame.
+		setHotReload(true);
+
+		const std::filesystem::path directory = std::filesystem::temp_directory_path() / "pxr_assets";
+		std::filesystem::create_directories(directory);
+		for (int i = 0; i < Columns * Rows; ++i) {
+			const std::string path = (directory / ("tile_" + std::to_string(i) + ".ppm")).string();
+			writeTile(path, i, i);
+			images.push_back(loadImage(path)); // Returns at once; the file is read and decoded in the background.
+		}
+		images.push_back(loadImage((directory / "missing.ppm").string())); // Shows how failures are reported.
+	}
+
+	/**
+	 * @brief Draws every loaded tile and placeholders for the others.
+	 */
+	void update() override {
+		const bool spacePressed = isKeyPressed(pxr::KeyCode::Space);
+		if (spacePressed && !spaceWasPressed) {
+			// Rewriting the file is all it takes; the watcher reloads the tile a few frames later.
+			const int tile = (edits * 7) % (Columns * Rows);
+			writeTile(images[tile].getPath(), tile, Columns * Rows + edits++);
+		}
+		spaceWasPressed = spacePressed;
+
+		background(pxr::Color(16, 16, 24));
+		for (int i = 0; i < Columns * Rows; ++i) {
+			const int x = (i % Columns) * TileSize;
+			const int y = Margin + (i / Columns) * TileSize;
+			if (images[i].isReady()) {
+				drawSurface(images[i].getSurface(), x, y);
+			} else {
+				getCommandBuffer().fill(pxr::Rect{x + 2, y + 2, TileSize - 4, TileSize - 4}, pxr::Color(48, 48, 56));
+			}
+		}
+
+		const std::string status = getPendingAssetCount() > 0
+										   ? "Loading, " + std::to_string(getPendingAssetCount()) + " left"
+										   : "Done. " + images.back().getError();
+		getCommandBuffer().text(4, 4, status, pxr::Color::White);
+	}
+
+	//--------------------------------------------------------------------------
+	// Helpers
+	//--------------------------------------------------------------------------
+
+	/**
+	 * @brief Writes a binary PPM image with a pattern that depends on a seed.
+	 */
+	static void writeTile(const std::string &path, int tile, int seed) {
+		std::ofstream file(path, std::ios::binary);
+		file << "P6\n" << TileSize << ' ' << TileSize << "\n255\n";
+		for (int y = 0; y < TileSize; ++y) {
+			for (int x = 0; x < TileSize; ++x) {
+				const float fx = static_cast<float>(x) / TileSize - 0.5f;
+				const float fy = static_cast<float>(y) / TileSize - 0.5f;
+				const float wave = std::sin(std::sqrt(fx * fx + fy * fy) * (8.0f + seed % 40) + seed);
+				const char pixel[3] = {static_cast<char>(128 + 127 * wave), static_cast<char>(tile * 6),
+									   static_cast<char>(255 - tile * 6)};
+				file.write(pixel, sizeof(pixel));
+			}
+		}
+	}
+};
+
+/// @brief Macro that defines the entry point and launches the app.
+PXR_MAIN(PixelAssets)
@@ -0,0 +1,138 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <pxr/pixel_runtime.h>
+#include <utility>
+#include <vector>
+
+namespace {
+
+	constexpr int GridSize = 128; ///< Cells per side.
+	constexpr int InstanceCount = 32; ///< Seed densities swept.
+	constexpr int Generations = 500; ///< Frames run by every instance.
+
+	using NoiseField = std::array<uint8_t, GridSize * GridSize>;
+
+} // namespace
+
+/**
+ * @class LifeInstance
+ * @brief One headless Game of Life run seeded with a given density.
+ *
+ * Demonstrates how to:
+ * - Read a shared, read-only asset instead of building it per instance
+ * - Record a result in `destroy()` before the batch runner deletes the app
+ */
+class LifeInstance final : public pxr::App {
+public:
+	/**
+	 * @param noise Random field shared by every instance.
+	 * @param density Fraction of cells alive at the start.
+	 * @param result Receives the final population.
+	 */
+	LifeInstance(std::shared_ptr<const NoiseField> noise, float density, int &result) :
+		noise(std::move(noise)), density(density), result(result) {}
+
+private:
+	//--------------------------------------------------------------------------
+	// Members
+	//--------------------------------------------------------------------------
+
+	std::shared_ptr<const NoiseField> noise; ///< Shared seed noise.
+	float density; ///< Seed density.
+	int &result; ///< Final population output.
+	NoiseField cells{}; ///< Current generation (1 = alive).
+	NoiseField next{}; ///< Scratch buffer for the next generation.
+	int population = 0; ///< Live cells after the last update.
+
+	//--------------------------------------------------------------------------
+	// Lifecycle
+	//--------------------------------------------------------------------------
+
+	/**
+	 * @brief Seeds the grid from the shared noise.
+	 */
+	void setup() override {
+		setSize(GridSize, GridSize);
+
+		const auto threshold = static_cast<uint8_t>(density * 255.0f);
+		for (int i = 0; i < GridSize * GridSize; ++i) {
+			cells[i] = (*noise)[i] < threshold ? 1 : 0;
+		}
+	}
+
+	/**
+	 * @brief Advances the simulation by one generation.
+	 */
+	void update() override {
+		population = 0;
+		for (int y = 0; y < GridSize; ++y) {
+			for (int x = 0; x < GridSize; ++x) {
+				int neighbours = 0;
+				for (int dy = -1; dy <= 1; ++dy) {
+					for (int dx = -1; dx <= 1; ++dx) {
+						const int nx = (x + dx + GridSize) % GridSize;
+						const int ny = (y + dy + GridSize) % GridSize;
+						neighbours += (dx != 0 || dy != 0) ? cells[ny * GridSize + nx] : 0;
+					}
+				}
+				const bool alive = cells[y * GridSize + x] ? neighbours == 2 || neighbours == 3 : neighbours == 3;
+				next[y * GridSize + x] = alive ? 1 : 0;
+				population += alive ? 1 : 0;
+				drawPixel(x, y, alive ? pxr::Color::White : pxr::Color::Black);
+			}
+		}
+		cells = next;
+	}
+
+	/**
+	 * @brief Hands the final population back to the sweep.
+	 */
+	void destroy() override { result = population; }
+};
+
+/**
+ * @brief Sweeps the seed density over many headless instances and prints the results.
+ */
+int main() {
+	try {
+		pxr::BatchRunner runner;
+		runner.setMode(pxr::BatchRunner::Mode::FreeRunning);
+		runner.setFrameBudget(Generations);
+
+		std::vector<int> populations(InstanceCount);
+		const pxr::BatchStats stats = runner.run(InstanceCount, [&](int index, pxr::SharedAssets &assets) {
+			auto noise = assets.get<NoiseField>("noise", [] {
+				NoiseField field{};
+				for (int i = 0; i < GridSize * GridSize; ++i) {
+					field[i] = pxr::math::pseudoRandomColor(i % GridSize, i / GridSize, 0).r();
+				}
+				return field;
+			});
+			const float density = static_cast<float>(index + 1) / (InstanceCount + 1);
+			return std::make_unique<LifeInstance>(std::move(noise), density, populations[index]);
+		});
+
+		for (int i = 0; i < InstanceCount; ++i) {
+			std::cout << "density " << static_cast<float>(i + 1) / (InstanceCount + 1) << ": " << populations[i]
+					  << " cells alive after " << Generations << " generations\n";
+		}
+		std::cout << stats.frames << " frames on " << stats.threads << " threads in " << stats.runSeconds << " s ("
+				  << stats.framesPerSecond << " frames/s, setup " << stats.setupSeconds << " s)\n";
+	} catch (const std::exception &e) {
+		std::cerr << "Fatal error: " << e.what() << '\n';
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
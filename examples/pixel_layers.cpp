@@ -0,0 +1,89 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <iostream>
+#include <pxr/pixel_runtime.h>
+
+/**
+ * @class PixelLayers
+ * @brief Static background with a moving sprite and a HUD, each on its own layer.
+ *
+ * Demonstrates how to:
+ * - Create layers with different z-orders
+ * - Draw a background once and never touch it again
+ * - Move a layer by changing its offset instead of redrawing it
+ * - Fade a layer with opacity
+ *
+ * Only the areas uncovered or covered by the moving sprite are recomposited each frame.
+ */
+class PixelLayers final : public pxr::App {
+	//--------------------------------------------------------------------------
+	// Members
+	//--------------------------------------------------------------------------
+
+	pxr::Layer *world = nullptr; ///< Static background pattern.
+	pxr::Layer *sprite = nullptr; ///< Small moving sprite.
+	pxr::Layer *hud = nullptr; ///< Semi-transparent overlay bar.
+	float time = 0.0f; ///< Accumulated time in seconds.
+
+	//--------------------------------------------------------------------------
+	// Lifecycle
+	//--------------------------------------------------------------------------
+
+	/**
+	 * @brief Creates the layers and draws their static content once.
+	 */
+	void setup() override {
+		setTitle("Pixel Layers - Pixel Runtime Demo");
+		setSize(320, 240);
+		setPixelSize(3);
+		setVSync(true);
+
+		world = &createLayer(320, 240, 0);
+		for (int y = 0; y < 240; ++y) {
+			for (int x = 0; x < 320; ++x) {
+				const bool dark = ((x / 16) + (y / 16)) % 2 == 0;
+				world->getSurface().setPixel(x, y, dark ? pxr::Color(30, 40, 60) : pxr::Color(50, 70, 100));
+			}
+		}
+
+		sprite = &createLayer(24, 24, 1);
+		for (int y = 0; y < 24; ++y) {
+			for (int x = 0; x < 24; ++x) {
+				const int dx = x - 12, dy = y - 12;
+				if (dx * dx + dy * dy < 144) {
+					sprite->getSurface().setPixel(x, y, pxr::Color::Yellow);
+				}
+			}
+		}
+
+		hud = &createLayer(320, 16, 2);
+		hud->getSurface().clear(pxr::Color(0, 0, 0, 160));
+		hud->setOffset(0, 224);
+	}
+
+	/**
+	 * @brief Moves the sprite and pulses the HUD opacity.
+	 */
+	void update() override {
+		time += getDeltaTime();
+
+		const int x = 148 + static_cast<int>(120.0f * std::sin(time));
+		const int y = 108 + static_cast<int>(80.0f * std::sin(time * 1.7f));
+		sprite->setOffset(x, y);
+
+		hud->setOpacity(0.5f + 0.5f * pxr::math::pingpong(time, 0.0f, 1.0f));
+		hud->setVisible(!isKeyPressed(pxr::KeyCode::H));
+
+		std::cout << "\rFPS: " << getFps() << std::flush;
+	}
+};
+
+/// @brief Macro that defines the entry point and launches the app.
+PXR_MAIN(PixelLayers)
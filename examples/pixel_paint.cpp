@@ -41,6 +41,7 @@ class PixelPaint final : public pxr::App {
 		setSize(16, 16); // Logical canvas size (in pixels)
 		setPixelSize(50); // Each pixel is drawn as 100x100 screen pixels
 		setVSync(true); // Enable vsync
+		setOnDemandRendering(true); // Only wake up on input; idle at zero CPU
 		background(pxr::Color::White);
 		currentColor = pxr::Color::Black;
 	}
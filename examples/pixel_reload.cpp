@@ -0,0 +1,122 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <pxr/pixel_runtime.h>
+#include <string>
+#include <vector>
+
+/**
+ * @class PixelReload
+ * @brief Game of Life whose drawing code can be edited while it runs.
+ *
+ * Demonstrates how to:
+ * - Build an app as a shared library with PXR_RELOADABLE_MAIN and run it with pxr_host
+ * - Keep the simulation across reloads with saveState() and loadState()
+ *
+ * Start it with `pxr_host ./libpxr_pixel_reload_module.so`, change AliveColor or
+ * the trail fade below and rebuild the `pxr_pixel_reload_module` target: the
+ * running window picks up the new code without losing the current generation.
+ */
+class PixelReload final : public pxr::App {
+	//--------------------------------------------------------------------------
+	// Members
+	//--------------------------------------------------------------------------
+
+	static constexpr int GridSize = 128; ///< Cells per side.
+	static constexpr pxr::Color AliveColor = pxr::Color(255, 200, 64); ///< Try editing this and rebuilding.
+	static constexpr int TrailFade = 12; ///< Brightness lost per generation by dead cells.
+
+	/**
+	 * @brief Everything that survives a reload; plain data only.
+	 */
+	struct State {
+		std::array<uint8_t, GridSize * GridSize> cells{}; ///< Current generation (1 = alive).
+		std::array<uint8_t, GridSize * GridSize> trail{}; ///< Afterglow of recently dead cells.
+		uint64_t generation = 0; ///< Generations simulated so far.
+	};
+
+	State state; ///< Simulation state.
+	std::array<uint8_t, GridSize * GridSize> next{}; ///< Scratch buffer for the next generation.
+
+	//--------------------------------------------------------------------------
+	// Lifecycle
+	//--------------------------------------------------------------------------
+
+	/**
+	 * @brief Seeds the grid; after a reload, loadState() replaces the seed.
+	 */
+	void setup() override {
+		setTitle("Pixel Reload - Pixel Runtime Demo");
+		setSize(GridSize, GridSize);
+		setPixelSize(4);
+		setVSync(true);
+
+		for (int i = 0; i < GridSize * GridSize; ++i) {
+			state.cells[i] = pxr::math::pseudoRandomColor(i % GridSize, i / GridSize, 0).r() < 80 ? 1 : 0;
+		}
+	}
+
+	/**
+	 * @brief Advances the simulation and draws live cells with their fading trails.
+	 */
+	void update() override {
+		for (int y = 0; y < GridSize; ++y) {
+			for (int x = 0; x < GridSize; ++x) {
+				int neighbours = 0;
+				for (int dy = -1; dy <= 1; ++dy) {
+					for (int dx = -1; dx <= 1; ++dx) {
+						const int nx = (x + dx + GridSize) % GridSize;
+						const int ny = (y + dy + GridSize) % GridSize;
+						neighbours += (dx != 0 || dy != 0) ? state.cells[ny * GridSize + nx] : 0;
+					}
+				}
+				const int i = y * GridSize + x;
+				const bool alive = state.cells[i] ? neighbours == 2 || neighbours == 3 : neighbours == 3;
+				next[i] = alive ? 1 : 0;
+				state.trail[i] = alive ? 255 : static_cast<uint8_t>(std::max(0, state.trail[i] - TrailFade));
+				const int glow = state.trail[i] / 4;
+				drawPixel(x, y,
+						  alive ? AliveColor
+								: pxr::Color(AliveColor.r() * glow / 255, AliveColor.g() * glow / 255,
+											 AliveColor.b() * glow / 255));
+			}
+		}
+		state.cells = next;
+		++state.generation;
+		getCommandBuffer().text(2, 2, "Gen " + std::to_string(state.generation), pxr::Color::White);
+	}
+
+	//--------------------------------------------------------------------------
+	// Reloading
+	//--------------------------------------------------------------------------
+
+	/**
+	 * @brief Hands the simulation to the instance built from the new code.
+	 */
+	std::vector<uint8_t> saveState() override {
+		const auto *bytes = reinterpret_cast<const uint8_t *>(&state);
+		return {bytes, bytes + sizeof(state)};
+	}
+
+	/**
+	 * @brief Takes over the simulation, unless the layout of State changed in the new build.
+	 */
+	void loadState(std::span<const uint8_t> saved) override {
+		if (saved.size() == sizeof(state)) {
+			std::memcpy(&state, saved.data(), sizeof(state));
+		}
+	}
+};
+
+/// @brief Macro that defines the entry point, and the functions pxr_host loads, and launches the app.
+PXR_RELOADABLE_MAIN(PixelReload)
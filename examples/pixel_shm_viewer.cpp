@@ -0,0 +1,74 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <pxr/pixel_runtime.h>
+
+/**
+ * @class PixelShmViewer
+ * @brief Mirrors the frames another Pixel Runtime app publishes to shared memory.
+ *
+ * Start a producer that calls `setSharedFrameOutput("/pxr_frames")` in its `setup()`,
+ * then run this viewer. Set `PXR_SHM_NAME` to watch a different ring.
+ *
+ * Demonstrates how to:
+ * - Attach to a shared-memory frame ring with SharedFrameReader
+ * - Copy the newest frame into a surface without blocking the producer
+ * - Detect skipped frames from the producer frame numbers
+ */
+class PixelShmViewer final : public pxr::App {
+	//--------------------------------------------------------------------------
+	// Members
+	//--------------------------------------------------------------------------
+
+	std::unique_ptr<pxr::SharedFrameReader> reader; ///< Attached frame ring.
+	std::unique_ptr<pxr::Surface> frame; ///< Latest frame copied out of the ring.
+	uint64_t lastFrame = 0; ///< Producer frame number of the previous copy.
+	uint64_t skipped = 0; ///< Producer frames never seen by the viewer.
+
+	//--------------------------------------------------------------------------
+	// Lifecycle
+	//--------------------------------------------------------------------------
+
+	/**
+	 * @brief Attaches to the ring and sizes the window to match it.
+	 */
+	void setup() override {
+		const char *name = std::getenv("PXR_SHM_NAME");
+		reader = std::make_unique<pxr::SharedFrameReader>(name ? name : "/pxr_frames");
+		frame = std::make_unique<pxr::Surface>(reader->getWidth(), reader->getHeight());
+
+		setTitle("Pixel Shm Viewer - Pixel Runtime Demo");
+		setSize(reader->getWidth(), reader->getHeight());
+		setPixelSize(1);
+		setVSync(true);
+	}
+
+	/**
+	 * @brief Copies the newest frame, if any, and reports skipped frames.
+	 */
+	void update() override {
+		uint64_t frameNumber = 0;
+		if (!reader->readInto(*frame, &frameNumber) || frameNumber == lastFrame) {
+			return;
+		}
+		if (lastFrame != 0 && frameNumber > lastFrame + 1) {
+			skipped += frameNumber - lastFrame - 1;
+		}
+		lastFrame = frameNumber;
+
+		drawSurface(*frame);
+		std::cout << "\rFrame: " << frameNumber << " Skipped: " << skipped << std::flush;
+	}
+};
+
+/// @brief Macro that defines the entry point and launches the app.
+PXR_MAIN(PixelShmViewer)
@@ -0,0 +1,76 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <pxr/pixel_runtime.h>
+
+/**
+ * @class PixelStreamViewer
+ * @brief Shows the frames another Pixel Runtime app streams over a Unix socket.
+ *
+ * Start a producer that calls `setFrameStreamOutput("/tmp/pxr_stream.sock")` in its
+ * `setup()`, then run this viewer. Set `PXR_STREAM_PATH` to watch a different socket.
+ *
+ * Demonstrates how to:
+ * - Connect to a frame stream with FrameStreamClient
+ * - Apply only the tiles that changed to a persistent surface
+ * - Measure the bandwidth a stream actually uses
+ */
+class PixelStreamViewer final : public pxr::App {
+	//--------------------------------------------------------------------------
+	// Members
+	//--------------------------------------------------------------------------
+
+	std::unique_ptr<pxr::FrameStreamClient> client; ///< Connection to the producer.
+	std::unique_ptr<pxr::Surface> frame; ///< Frame rebuilt from received tiles.
+	uint64_t lastBytes = 0; ///< Bytes received at the last report.
+	float reportTimer = 0.0f; ///< Seconds since the last bandwidth report.
+
+	//--------------------------------------------------------------------------
+	// Lifecycle
+	//--------------------------------------------------------------------------
+
+	/**
+	 * @brief Connects to the producer and sizes the window to match its frames.
+	 */
+	void setup() override {
+		const char *path = std::getenv("PXR_STREAM_PATH");
+		client = std::make_unique<pxr::FrameStreamClient>(path ? path : "/tmp/pxr_stream.sock");
+		frame = std::make_unique<pxr::Surface>(client->getWidth(), client->getHeight());
+
+		setTitle("Pixel Stream Viewer - Pixel Runtime Demo");
+		setSize(client->getWidth(), client->getHeight());
+		setPixelSize(1);
+		setVSync(true);
+	}
+
+	/**
+	 * @brief Applies received frames and reports the bandwidth once per second.
+	 */
+	void update() override {
+		uint64_t frameNumber = 0;
+		if (client->poll(*frame, &frameNumber)) {
+			drawSurface(*frame);
+		}
+
+		reportTimer += getDeltaTime();
+		if (reportTimer >= 1.0f) {
+			const uint64_t bytes = client->getBytesReceived();
+			std::cout << "\rFrame: " << frameNumber << " KiB/s: " << (bytes - lastBytes) / 1024
+					  << (client->isConnected() ? "" : " (disconnected)") << std::flush;
+			lastBytes = bytes;
+			reportTimer = 0.0f;
+		}
+	}
+};
+
+/// @brief Macro that defines the entry point and launches the app.
+PXR_MAIN(PixelStreamViewer)
@@ -0,0 +1,104 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <cmath>
+#include <pxr/pixel_runtime.h>
+#include <string>
+#include <vector>
+
+/**
+ * @class PixelTasks
+ * @brief A landscape generated over several frames while a caption script plays.
+ *
+ * Demonstrates how to:
+ * - Compute a height map on a worker thread with runOnWorker()
+ * - Spread drawing across frames with nextFrame()
+ * - Write a timed sequence with seconds() instead of a state machine
+ */
+class PixelTasks final : public pxr::App {
+	//--------------------------------------------------------------------------
+	// Members
+	//--------------------------------------------------------------------------
+
+	static constexpr int Width = 320; ///< Surface width.
+	static constexpr int Height = 200; ///< Surface height.
+
+	pxr::Surface terrain{Width, Height}; ///< Landscape, filled in column by column.
+	std::string caption; ///< Text shown at the top of the screen.
+
+	//--------------------------------------------------------------------------
+	// Lifecycle
+	//--------------------------------------------------------------------------
+
+	/**
+	 * @brief Configures the window and starts both tasks.
+	 */
+	void setup() override {
+		setTitle("Pixel Tasks - Pixel Runtime Demo");
+		setSize(Width, Height);
+		setPixelSize(3);
+		setVSync(true);
+
+		startTask(generateTerrain());
+		startTask(playCaptions());
+	}
+
+	/**
+	 * @brief Shows the landscape generated so far and the current caption.
+	 */
+	void update() override {
+		drawSurface(terrain);
+		getCommandBuffer().text(4, 4, caption, pxr::Color::White);
+	}
+
+	//--------------------------------------------------------------------------
+	// Tasks
+	//--------------------------------------------------------------------------
+
+	/**
+	 * @brief Computes heights off the main thread, then draws a few columns per frame.
+	 */
+	pxr::Task generateTerrain() {
+		const std::vector<int> heights = co_await pxr::runOnWorker([] {
+			std::vector<int> result(Width);
+			for (int x = 0; x < Width; ++x) {
+				const float t = static_cast<float>(x) / Width;
+				const float h = 0.5f + 0.25f * std::sin(t * 9.0f) + 0.12f * std::sin(t * 31.0f + 1.0f);
+				result[x] = static_cast<int>(h * Height);
+			}
+			return result;
+		});
+
+		for (int x = 0; x < Width; ++x) {
+			for (int y = 0; y < Height; ++y) {
+				const bool ground = y >= Height - heights[x];
+				terrain.setPixel(x, y, ground ? pxr::Color(40, 120 + y / 4, 50) : pxr::Color(20, 30, 80 + y / 2));
+			}
+			if (x % 4 == 3) {
+				co_await pxr::nextFrame(); // Four columns per frame make the landscape sweep in.
+			}
+		}
+	}
+
+	/**
+	 * @brief Changes the caption on a timeline.
+	 */
+	pxr::Task playCaptions() {
+		caption = "Generating terrain...";
+		co_await pxr::seconds(2.0f);
+		caption = "Tasks resume after update()";
+		co_await pxr::seconds(2.0f);
+		caption = "Each one awaits frames, time or workers";
+		co_await pxr::seconds(3.0f);
+		caption.clear();
+	}
+};
+
+/// @brief Macro that defines the entry point and launches the app.
+PXR_MAIN(PixelTasks)
@@ -0,0 +1,94 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <array>
+#include <cmath>
+#include <future>
+#include <pxr/pixel_runtime.h>
+#include <string>
+
+/**
+ * @class PixelThreads
+ * @brief Spinning line fans drawn by several threads at once.
+ *
+ * Demonstrates how to:
+ * - Record draw commands from worker threads with getCommandBuffer()
+ * - Mix fills, lines and text in one command buffer
+ * - Let the runtime execute all buffers in parallel at the end of the frame
+ */
+class PixelThreads final : public pxr::App {
+	//--------------------------------------------------------------------------
+	// Members
+	//--------------------------------------------------------------------------
+
+	static constexpr int WorkerCount = 4; ///< Threads recording commands.
+	static constexpr int SpokeCount = 400; ///< Lines drawn by each worker per frame.
+
+	float angle = 0.0f; ///< Current rotation (radians).
+
+	//--------------------------------------------------------------------------
+	// Lifecycle
+	//--------------------------------------------------------------------------
+
+	/**
+	 * @brief Configures the window.
+	 */
+	void setup() override {
+		setTitle("Pixel Threads - Pixel Runtime Demo");
+		setSize(480, 360);
+		setPixelSize(2);
+		setVSync(true);
+	}
+
+	/**
+	 * @brief Lets every worker draw its own quadrant of the screen.
+	 */
+	void update() override {
+		angle += getDeltaTime();
+
+		std::array<std::future<void>, WorkerCount> workers;
+		for (int i = 0; i < WorkerCount; ++i) {
+			workers[i] = std::async(std::launch::async, [this, i] { drawQuadrant(i); });
+		}
+		for (auto &worker: workers) {
+			worker.get(); // Commands must be recorded before update() returns.
+		}
+	}
+
+	//--------------------------------------------------------------------------
+	// Helpers
+	//--------------------------------------------------------------------------
+
+	/**
+	 * @brief Records a background, a fan of lines and a label for one quadrant.
+	 * @param index Quadrant number, left to right and top to bottom.
+	 */
+	void drawQuadrant(int index) {
+		pxr::CommandBuffer &commands = getCommandBuffer();
+		const int w = getWidth() / 2;
+		const int h = getHeight() / 2;
+		const int x = (index % 2) * w;
+		const int y = (index / 2) * h;
+		const int centerX = x + w / 2;
+		const int centerY = y + h / 2;
+
+		commands.fill(pxr::Rect{x, y, w, h}, pxr::Color(20 * index, 10, 40));
+		const float direction = index % 2 ? -1.0f : 1.0f;
+		for (int i = 0; i < SpokeCount; ++i) {
+			const float a = direction * angle + static_cast<float>(i) * 6.2831853f / SpokeCount;
+			const int endX = centerX + static_cast<int>(std::cos(a) * static_cast<float>(w) * 0.45f);
+			const int endY = centerY + static_cast<int>(std::sin(a) * static_cast<float>(h) * 0.45f);
+			commands.line(centerX, centerY, endX, endY, pxr::Color(255, (i * 255) / SpokeCount, 60 * index));
+		}
+		commands.text(x + 4, y + 4, "Thread " + std::to_string(index), pxr::Color::White);
+	}
+};
+
+/// @brief Macro that defines the entry point and launches the app.
+PXR_MAIN(PixelThreads)
@@ -0,0 +1,88 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <pxr/pixel_runtime.h>
+
+/**
+ * @class PixelVideo
+ * @brief Plays a Y4M video on a background layer, with a marker on top that lights up on dropped frames.
+ *
+ * Reads `video.y4m` from the working directory, or the file named by
+ * `PXR_VIDEO_PATH`. Raw video is easy to make with
+ * `ffmpeg -i clip.mp4 -pix_fmt yuv420p video.y4m`.
+ *
+ * Demonstrates how to:
+ * - Stream a video into a layer with VideoPlayer
+ * - Keep playback in step with the frame time, dropping late frames
+ * - Measure the bandwidth playback reads from disk
+ */
+class PixelVideo final : public pxr::App {
+	//--------------------------------------------------------------------------
+	// Members
+	//--------------------------------------------------------------------------
+
+	std::unique_ptr<pxr::VideoPlayer> video; ///< Reads frames ahead of playback.
+	pxr::Layer *screen = nullptr; ///< Video frames, below everything else.
+	pxr::Layer *marker = nullptr; ///< Corner square, red while frames are being dropped.
+	uint64_t lastDropped = 0; ///< Dropped frames at the previous update.
+	uint64_t lastBytes = 0; ///< Bytes read at the last report.
+	float reportTimer = 0.0f; ///< Seconds since the last report.
+
+	//--------------------------------------------------------------------------
+	// Lifecycle
+	//--------------------------------------------------------------------------
+
+	/**
+	 * @brief Opens the video and sizes the window and layers to match it.
+	 */
+	void setup() override {
+		const char *path = std::getenv("PXR_VIDEO_PATH");
+		video = std::make_unique<pxr::VideoPlayer>(path ? path : "video.y4m");
+		video->setLooping(true);
+		const int width = video->getWidth();
+		const int height = video->getHeight();
+
+		setTitle("Pixel Video - Pixel Runtime Demo");
+		setSize(width, height);
+		setPixelSize(1);
+		setVSync(true);
+
+		screen = &createLayer(width, height, 0);
+		marker = &createLayer(8, 8, 1);
+		marker->setOffset(width - 12, 4);
+		marker->getSurface().clear(pxr::Color::Red);
+		marker->setVisible(false);
+	}
+
+	/**
+	 * @brief Shows the frame that is due, flags drops and reports once per second.
+	 */
+	void update() override {
+		video->update(getDeltaTime(), *screen);
+
+		const uint64_t dropped = video->getDroppedFrames();
+		marker->setVisible(dropped != lastDropped);
+		lastDropped = dropped;
+
+		reportTimer += getDeltaTime();
+		if (reportTimer >= 1.0f) {
+			const uint64_t bytes = video->getBytesRead();
+			std::cout << "\rShown: " << video->getShownFrames() << " Dropped: " << video->getDroppedFrames()
+					  << " MiB/s: " << (bytes - lastBytes) / (1024 * 1024) << std::flush;
+			lastBytes = bytes;
+			reportTimer = 0.0f;
+		}
+	}
+};
+
+/// @brief Macro that defines the entry point and launches the app.
+PXR_MAIN(PixelVideo)
@@ -0,0 +1,107 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <pxr/pixel_runtime.h>
+
+/**
+ * @class PixelWindows
+ * @brief Game of Life in the main window, with its population graph in a second window.
+ *
+ * Demonstrates how to:
+ * - Open extra windows with addWindow() during setup
+ * - Draw into an extra window's surface directly
+ * - Check whether the user closed an extra window
+ */
+class PixelWindows final : public pxr::App {
+	//--------------------------------------------------------------------------
+	// Members
+	//--------------------------------------------------------------------------
+
+	static constexpr int GridSize = 96; ///< Cells per side.
+	static constexpr int GraphWidth = 160; ///< Population samples shown in the graph.
+	static constexpr int GraphHeight = 60; ///< Graph height in pixels.
+
+	std::array<uint8_t, GridSize * GridSize> cells{}; ///< Current generation (1 = alive).
+	std::array<uint8_t, GridSize * GridSize> next{}; ///< Scratch buffer for the next generation.
+	pxr::Surface *graph = nullptr; ///< Surface of the graph window.
+	int graphX = 0; ///< Column receiving the next population sample.
+
+	//--------------------------------------------------------------------------
+	// Lifecycle
+	//--------------------------------------------------------------------------
+
+	/**
+	 * @brief Seeds the grid and opens the graph window.
+	 */
+	void setup() override {
+		setTitle("Pixel Windows - Pixel Runtime Demo");
+		setSize(GridSize, GridSize);
+		setPixelSize(5);
+		setVSync(true);
+
+		graph = &addWindow("Population", GraphWidth, GraphHeight, 3);
+
+		for (int i = 0; i < GridSize * GridSize; ++i) {
+			cells[i] = pxr::math::pseudoRandomColor(i % GridSize, i / GridSize, 0).r() < 80 ? 1 : 0;
+		}
+	}
+
+	/**
+	 * @brief Advances the simulation and plots the population.
+	 */
+	void update() override {
+		int population = 0;
+		for (int y = 0; y < GridSize; ++y) {
+			for (int x = 0; x < GridSize; ++x) {
+				int neighbours = 0;
+				for (int dy = -1; dy <= 1; ++dy) {
+					for (int dx = -1; dx <= 1; ++dx) {
+						const int nx = (x + dx + GridSize) % GridSize;
+						const int ny = (y + dy + GridSize) % GridSize;
+						neighbours += (dx != 0 || dy != 0) ? cells[ny * GridSize + nx] : 0;
+					}
+				}
+				const bool alive = cells[y * GridSize + x] ? neighbours == 2 || neighbours == 3 : neighbours == 3;
+				next[y * GridSize + x] = alive ? 1 : 0;
+				population += alive ? 1 : 0;
+				drawPixel(x, y, alive ? pxr::Color::White : pxr::Color::Black);
+			}
+		}
+		cells = next;
+
+		if (isWindowOpen(*graph)) {
+			plotPopulation(population);
+		}
+	}
+
+	//--------------------------------------------------------------------------
+	// Helpers
+	//--------------------------------------------------------------------------
+
+	/**
+	 * @brief Draws one column of the scrolling population graph.
+	 */
+	void plotPopulation(int population) {
+		const int height = std::min(population * GraphHeight * 3 / (GridSize * GridSize), GraphHeight - 1);
+		const int top = GraphHeight - 1 - height;
+		for (int y = 0; y < GraphHeight; ++y) {
+			graph->setPixel(graphX, y, y >= top ? pxr::Color::Green : pxr::Color::Black);
+		}
+		graphX = (graphX + 1) % GraphWidth;
+		for (int y = 0; y < GraphHeight; ++y) {
+			graph->setPixel(graphX, y, pxr::Color::Red); // Cursor marking the newest sample.
+		}
+	}
+};
+
+/// @brief Macro that defines the entry point and launches the app.
+PXR_MAIN(PixelWindows)
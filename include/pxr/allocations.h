@@ -0,0 +1,81 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @file allocations.h
+ * @brief Heap allocation counts, per profiler zone and per frame.
+ *
+ * Builds configured with `-DPXR_TRACK_ALLOCATIONS=ON` replace the global
+ * `operator new` with one that counts every allocation and its size, and
+ * charges it to the innermost `PXR_PROFILE_ZONE` of the allocating thread.
+ * The App measures each frame with these counts and can fail frames that
+ * still allocate after a warm-up; see `App::setAllocationCheck()`. In other
+ * builds nothing is hooked and every count stays 0.
+ *
+ * Only allocations made through `new` are seen; direct calls to `malloc()`,
+ * including those inside system libraries, are not.
+ */
+
+namespace pxr {
+
+	/**
+	 * @brief Number and total size of allocations.
+	 */
+	struct AllocationCounts {
+		uint64_t count = 0; ///< Allocations made.
+		uint64_t bytes = 0; ///< Bytes requested by them.
+	};
+
+	/**
+	 * @brief Allocations charged to one zone.
+	 */
+	struct AllocationZoneStats {
+		const char *name = nullptr; ///< Zone name; "(no zone)" for allocations outside every zone.
+		uint64_t count = 0; ///< Allocations made while the zone was innermost.
+		uint64_t bytes = 0; ///< Bytes requested by them.
+	};
+
+	namespace allocations {
+
+		/**
+		 * @brief Returns true if this build counts allocations.
+		 */
+		[[nodiscard]] bool isTracking();
+
+		/**
+		 * @brief Returns the allocations of all threads since the process started.
+		 *
+		 * Never reset; subtract two readings to measure a stretch of code.
+		 */
+		[[nodiscard]] AllocationCounts getTotals();
+
+		/**
+		 * @brief Returns the allocations charged to each zone since the last reset(), summed over all threads.
+		 */
+		std::vector<AllocationZoneStats> getZones();
+
+		/**
+		 * @brief Clears the zone totals.
+		 */
+		void reset();
+
+		/**
+		 * @brief Formats the zone totals as a table with one zone per line.
+		 */
+		std::string formatReport();
+
+	} // namespace allocations
+
+} // namespace pxr
@@ -9,12 +9,22 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <span>
 #include <string>
+#include <vector>
+#include "allocations.h"
+#include "assets.h"
 #include "color.h"
+#include "command_buffer.h"
 #include "input_codes.h"
+#include "layer.h"
 #include "surface.h"
+#include "task.h"
 
 namespace pxr {
 
@@ -29,6 +39,9 @@ namespace pxr {
 	 */
 	class App {
 	public:
+		/// Receives a presented frame (window resolution, top row first) and its frame number.
+		using FrameCaptureCallback = std::function<void(const Surface &frame, uint64_t frameNumber)>;
+
 		/**
 		 * @brief Constructs a new App instance.
 		 */
@@ -74,6 +87,24 @@ namespace pxr {
 		 */
 		virtual void destroy();
 
+		/**
+		 * @brief Called before `AppHost` replaces this app with a reloaded build of its code.
+		 *
+		 * Return whatever the new instance needs to continue where this one left
+		 * off; it is passed to `loadState()` after the new instance's `setup()`.
+		 * Only plain data may be saved: pointers into this instance or its
+		 * library are invalid once the old library is unloaded.
+		 *
+		 * @return A serialized state blob; empty by default.
+		 */
+		virtual std::vector<uint8_t> saveState();
+
+		/**
+		 * @brief Called after a reload with the blob returned by the old instance's `saveState()`.
+		 * @param state The saved state; the default implementation ignores it.
+		 */
+		virtual void loadState(std::span<const uint8_t> state);
+
 		//--------------------------------------------------------------------------
 		// Setup-Time Configuration (must be called inside setup())
 		//--------------------------------------------------------------------------
@@ -103,6 +134,143 @@ namespace pxr {
 		 */
 		void setTitle(const std::string &title);
 
+		/**
+		 * @brief Chooses the platform backend that shows frames and delivers input.
+		 *
+		 * Available backends are `glfw` (window with OpenGL, the default), `null`
+		 * (headless, frames are discarded), `terminal` (ANSI truecolor or sixel on
+		 * standard output, see `PXR_TERMINAL` and `PXR_TERMINAL_FPS`) and, on Linux, `fbdev` (draws straight
+		 * into a framebuffer device on the CPU, see `PXR_FBDEV` and `PXR_FBDEV_MODE`) and `x11` (X11
+		 * window updated through MIT-SHM images, no OpenGL). The `PXR_BACKEND`
+		 * environment variable overrides this choice. GPU layer compositing is only
+		 * available with OpenGL; other backends composite layers on the CPU.
+		 *
+		 * @param name Backend name.
+		 */
+		void setBackend(const std::string &name);
+
+		/**
+		 * @brief Chooses where layers are composited.
+		 *
+		 * When enabled (the default), each layer is uploaded to its own GPU texture
+		 * only when it changes and all layers are blended in a single draw call.
+		 * When disabled, or when there are more layers than the GPU path supports,
+		 * layers are flattened on the CPU before upload.
+		 *
+		 * @param enabled True to composite layers on the GPU.
+		 */
+		void setGpuCompositing(bool enabled);
+
+		/**
+		 * @brief Runs `update()` only when something happens instead of every frame.
+		 *
+		 * While enabled, the app sleeps until input changes, the window system
+		 * asks for a repaint (the window was uncovered or resized) or a redraw is
+		 * requested with `requestRedraw()` or `requestRedrawIn()`. Frames whose
+		 * `update()` changed no pixels are neither uploaded nor presented, so an
+		 * idle app uses no CPU or GPU time; a repaint presents the last frame
+		 * again. `getDeltaTime()` includes the idle time.
+		 *
+		 * @param enabled True to render on demand, false (the default) to render continuously.
+		 */
+		void setOnDemandRendering(bool enabled);
+
+		/**
+		 * @brief Limits how long started tasks may run per frame.
+		 *
+		 * Once the slice is used up, tasks still waiting to be resumed continue
+		 * in the next frame. A single resumption is never interrupted, so keep
+		 * the code between two `co_await` expressions short.
+		 *
+		 * @param seconds Time per frame, or 0 for no limit. Default: 0.004 (4 ms).
+		 */
+		void setTaskTimeSlice(float seconds);
+
+		/**
+		 * @brief Limits how much loaded image data is handed to the app per frame.
+		 *
+		 * Finished loads are committed at the start of a frame, before `update()`,
+		 * until their decoded pixels exceed the budget; the rest wait for later
+		 * frames. At least one load is committed per frame.
+		 *
+		 * @param bytesPerFrame Decoded bytes per frame, or 0 (the default) for no limit.
+		 */
+		void setAssetCommitBudget(size_t bytesPerFrame);
+
+		/**
+		 * @brief Reloads images loaded with `loadImage()` when their files are rewritten.
+		 *
+		 * Files are watched with inotify on Linux; changes are collected once per
+		 * frame, decoded in the background and applied in place before `update()`,
+		 * so existing handles and surface references see the new pixels. A reload
+		 * that fails, for example on a half-saved file, keeps the previous image.
+		 * Has no effect on other systems.
+		 *
+		 * @param enabled True to watch loaded files, false (the default) to load them once.
+		 */
+		void setHotReload(bool enabled);
+
+		/**
+		 * @brief Limits how many bytes of pixel data are sent to the GPU per frame.
+		 *
+		 * Changed regions are queued and uploaded in row bands across frames, on-screen
+		 * content first, so very large or fully redrawn surfaces no longer cause
+		 * single-frame hitches. Content may appear a few frames late while the queue
+		 * drains.
+		 *
+		 * @param bytesPerFrame Upload budget in bytes, or 0 (the default) for no limit.
+		 */
+		void setUploadBudget(size_t bytesPerFrame);
+
+		/**
+		 * @brief Publishes every frame into a POSIX shared-memory ring.
+		 *
+		 * Other local processes can open the ring with `SharedFrameReader` and read
+		 * frames in place without blocking the app. Layers are flattened on the CPU
+		 * while this is enabled. Not available on Windows.
+		 *
+		 * @param name Shared-memory object name, e.g. "/my_app_frames".
+		 * @param slotCount Number of frames kept in the ring (at least 2).
+		 */
+		void setSharedFrameOutput(const std::string &name, int slotCount = 3);
+
+		/**
+		 * @brief Streams every frame to viewers connecting on a Unix domain socket.
+		 *
+		 * Viewers use `FrameStreamClient`. Only the 16x16 tiles whose content
+		 * changed are compressed and sent, on a background thread; a slow viewer
+		 * makes the stream skip frames instead of stalling the app. Layers are
+		 * flattened on the CPU while this is enabled. Not available on Windows.
+		 *
+		 * @param path Filesystem path of the socket, e.g. "/tmp/my_app.sock".
+		 */
+		void setFrameStreamOutput(const std::string &path);
+
+		/**
+		 * @brief Accepts keyboard and mouse events injected by other local processes.
+		 *
+		 * Creates a shared-memory event ring that a `SharedInputWriter` can open.
+		 * Injected events are applied alongside window input, so `isKeyPressed()`
+		 * and the other queries report them unchanged. Not available on Windows.
+		 *
+		 * @param name Shared-memory object name, e.g. "/my_app_input".
+		 * @param capacity Number of buffered events; rounded up to a power of two.
+		 */
+		void setSharedInput(const std::string &name, int capacity = 1024);
+
+		/**
+		 * @brief Fails any frame that allocates once the app has warmed up.
+		 *
+		 * Every frame from `warmupFrames` on must make no heap allocation, on
+		 * any thread. The first one that does prints the allocations per
+		 * profiler zone since warm-up and stops the app through PXR_ASSERT.
+		 * Needs a build with `PXR_TRACK_ALLOCATIONS`; elsewhere no allocation is
+		 * seen and the check never fails. See allocations.h.
+		 *
+		 * @param warmupFrames Frames allowed to allocate, such as the ones filling caches and pools.
+		 */
+		void setAllocationCheck(uint64_t warmupFrames);
+
 		//--------------------------------------------------------------------------
 		// Drawing
 		//--------------------------------------------------------------------------
@@ -148,6 +316,132 @@ namespace pxr {
 		 */
 		void drawSurface(const Surface &surface, int x = 0, int y = 0);
 
+		/**
+		 * @brief Returns the calling thread's command buffer for the main surface.
+		 *
+		 * Any thread may record draw commands while `update()` runs; recording
+		 * takes no locks. When `update()` returns, the commands are executed in
+		 * parallel, tile by tile, on top of what was drawn directly.
+		 *
+		 * Buffers are handed back when the frame's commands have run and may go
+		 * to another thread in the next frame, so call this again every frame
+		 * instead of keeping the reference.
+		 *
+		 * @return A buffer owned by the app, valid for the current frame only.
+		 */
+		CommandBuffer &getCommandBuffer();
+
+		//--------------------------------------------------------------------------
+		// Layers
+		//--------------------------------------------------------------------------
+
+		/**
+		 * @brief Creates a layer composited on top of the app surface.
+		 *
+		 * Layers are drawn in ascending z-order above the app surface. Draw into
+		 * `layer.getSurface()` directly; only changed regions are recomposited.
+		 *
+		 * @param width Layer width in pixels.
+		 * @param height Layer height in pixels.
+		 * @param zOrder Stacking order; higher values are drawn on top.
+		 * @return A reference that stays valid until removeLayer() is called.
+		 */
+		Layer &createLayer(int width, int height, int zOrder = 0);
+
+		/**
+		 * @brief Removes a layer previously created with createLayer().
+		 * @param layer The layer to remove.
+		 */
+		void removeLayer(Layer &layer);
+
+		//--------------------------------------------------------------------------
+		// Extra Windows
+		//--------------------------------------------------------------------------
+
+		/**
+		 * @brief Opens another window that shows a surface of its own.
+		 *
+		 * Draw into the returned surface directly. Its changed regions are uploaded
+		 * by the same frame loop and upload budget as the main window, and all
+		 * OpenGL windows share shader programs and buffers. Extra windows receive
+		 * no input and do not wait for vsync; closing one leaves its surface valid.
+		 * The `terminal` and `fbdev` backends support only the main window.
+		 *
+		 * @param title Window title.
+		 * @param width Surface width in pixels.
+		 * @param height Surface height in pixels.
+		 * @param pixelSize Integer scale from surface pixels to window pixels.
+		 * @return A surface that stays valid until the app exits.
+		 */
+		Surface &addWindow(const std::string &title, int width, int height, int pixelSize = 1);
+
+		/**
+		 * @brief Checks whether the window showing a surface returned by addWindow() is open.
+		 * @param surface The window's surface.
+		 * @return False before run() creates the window and after the user closed it.
+		 */
+		[[nodiscard]] bool isWindowOpen(const Surface &surface) const;
+
+		//--------------------------------------------------------------------------
+		// Tasks
+		//--------------------------------------------------------------------------
+
+		/**
+		 * @brief Starts a coroutine task resumed by the frame loop.
+		 *
+		 * The task first runs in the current frame, after `update()` (or in the
+		 * first frame if started during `setup()`). It is resumed on the main
+		 * thread whenever what it awaits is ready; unfinished tasks are destroyed
+		 * when the app exits. On demand, pending tasks keep frames coming.
+		 *
+		 * @param task The task; see task.h.
+		 */
+		void startTask(Task task);
+
+		/**
+		 * @brief Returns the number of started tasks that have not finished.
+		 */
+		[[nodiscard]] size_t getTaskCount() const;
+
+		//--------------------------------------------------------------------------
+		// Assets
+		//--------------------------------------------------------------------------
+
+		/**
+		 * @brief Starts loading an image in the background.
+		 *
+		 * Returns at once; the handle becomes ready or failed at the start of a
+		 * later frame. Loading a path that is already loaded or loading returns
+		 * the same image. On demand, pending loads keep frames coming. May be
+		 * called from `setup()` to overlap startup loads.
+		 *
+		 * @param path QOI or binary PPM/PGM file; see assets.h.
+		 * @return A handle that tracks the load.
+		 */
+		ImageHandle loadImage(const std::string &path);
+
+		/**
+		 * @brief Returns the number of images whose load has not been committed yet.
+		 */
+		[[nodiscard]] size_t getPendingAssetCount() const;
+
+		//--------------------------------------------------------------------------
+		// Frame Capture
+		//--------------------------------------------------------------------------
+
+		/**
+		 * @brief Streams every presented frame to a callback.
+		 *
+		 * Frames are read back from the GPU asynchronously, after all compositing,
+		 * and delivered on the main thread a few frames later. The frame surface is
+		 * only valid during the call. Frames are skipped rather than stalling the
+		 * pipeline if the callback cannot keep up. Backends without OpenGL deliver
+		 * each frame directly, right after it is presented.
+		 *
+		 * @param callback Function receiving the frames, or nullptr to stop capturing.
+		 */
+		void setFrameCaptureCallback(FrameCaptureCallback callback);
+
 		//--------------------------------------------------------------------------
 		// App Control
 		//--------------------------------------------------------------------------
@@ -157,6 +451,23 @@ namespace pxr {
 		 */
 		void exit();
 
+		/**
+		 * @brief Makes the next loop iteration call `update()` in on-demand mode.
+		 *
+		 * Calling it from `update()` keeps the app animating. Has no effect when
+		 * rendering continuously.
+		 */
+		void requestRedraw();
+
+		/**
+		 * @brief Schedules a call to `update()` after a delay in on-demand mode.
+		 *
+		 * Only the earliest pending request is kept; any redraw satisfies it.
+		 *
+		 * @param seconds Delay before the redraw.
+		 */
+		void requestRedrawIn(float seconds);
+
 		/**
 		 * @brief Returns whether the application is currently running.
 		 * @return True if running.
@@ -272,14 +583,50 @@ namespace pxr {
 		 */
 		[[nodiscard]] float getDeltaTime() const;
 
+		/**
+		 * @brief Returns the seconds from the start of the app to the end of its first presented frame.
+		 *
+		 * The phases in between are recorded as `startup.*` zones; see profiler.h.
+		 *
+		 * @return The time to the first frame, or 0 until it was presented.
+		 */
+		[[nodiscard]] float getStartupTime() const;
+
+		/**
+		 * @brief Returns the heap allocations made by all threads during the last frame.
+		 *
+		 * Always zero unless the build defines `PXR_TRACK_ALLOCATIONS`; see allocations.h.
+		 */
+		[[nodiscard]] AllocationCounts getFrameAllocations() const;
+
 	private:
+		friend class BatchRunner; // Steps headless instances frame by frame.
+		friend class AppHost; // Swaps instances when their library is rebuilt.
+
 		// Config state
 		int width = 400;
 		int height = 400;
 		int pixelSize = 1;
 		Color backgroundColor = Color::Black;
 		std::string title = "Pixel Runtime";
+		std::string backendName;
 		bool vsyncEnabled = true;
+		size_t uploadBudget = 0;
+		std::string sharedFrameName;
+		int sharedFrameSlots = 3;
+		std::string frameStreamPath;
+		std::string sharedInputName;
+		int sharedInputCapacity = 1024;
+		bool gpuCompositing = true;
+		bool onDemandRendering = false;
+		float taskTimeSlice = 0.004f;
+		size_t assetCommitBudget = 0;
+		bool hotReload = false;
+		bool allocationCheck = false;
+		uint64_t allocationWarmupFrames = 0;
+		bool headless = false; // Set by BatchRunner: null backend, no vsync, no waiting.
+		bool reloadable = false; // Set by AppHost: idle on-demand frames wake up to let it look for new code.
+		bool gpuCompositedLastFrame = false;
 		bool inSetupPhase = false;
 		bool shouldExit = false;
 
@@ -287,18 +634,133 @@ namespace pxr {
 		uint64_t frameCount = 0;
 		float deltaTime = 0.016f;
 		float fps = 0.0f;
+		float fixedDeltaTime = 0.0f; // Replaces the measured delta when positive.
+		std::chrono::steady_clock::time_point lastTime;
+		float fpsTimer = 0.0f;
+		int fpsCounter = 0;
+		std::chrono::steady_clock::time_point startTime; // Entry into start().
+		float startupTime = 0.0f; // Set once the first frame was presented.
+		AllocationCounts frameAllocations; // Made during the last frame.
+
+		// On-demand state
+		std::chrono::steady_clock::time_point nextRedraw; // Epoch: the first frame is drawn immediately.
+		uint64_t seenInputChanges = 0;
+		uint64_t seenWindowRefreshes = 0;
+		bool windowRefreshed = false; // The window needs the last frame again, changed or not.
+		bool presentedLastUpdate = true;
+
+		FrameCaptureCallback frameCaptureCallback;
 
 		// Core systems
 		std::unique_ptr<class Window> window;
-		std::unique_ptr<class Graphics> graphics;
+		std::unique_ptr<class Presenter> presenter;
+		class Graphics *graphics = nullptr; // Owned by the presenter; null without OpenGL.
 		std::unique_ptr<class Surface> surface;
 		std::unique_ptr<class Input> input;
+		std::unique_ptr<class Compositor> compositor;
+		std::unique_ptr<class UploadScheduler> uploads;
+		std::unique_ptr<class SharedFrameWriter> sharedFrames;
+		std::unique_ptr<class FrameStreamServer> frameStream;
+		std::unique_ptr<class CommandExecutor> commands;
+		std::unique_ptr<class TaskScheduler> tasks;
+		std::unique_ptr<class AssetLoader> assets;
+		std::vector<std::unique_ptr<struct ExtraWindow>> extraWindows;
+		const Surface *presentedSurface = nullptr;
+
+		/**
+		 * @brief Runs `setup()` and creates the window, presenter and other subsystems.
+		 */
+		void start();
+
+		/**
+		 * @brief Runs one iteration of the main loop.
+		 * @return False once the app exited or its window was closed.
+		 */
+		bool runFrame();
+
+		/**
+		 * @brief Runs `destroy()` and releases the subsystems created by `start()`.
+		 */
+		void finish();
+
+		/**
+		 * @brief Takes over the window, surface and GPU resources of a running instance.
+		 *
+		 * Runs `setup()` with drawing disabled, keeps the settings that shaped the
+		 * window and its outputs, replaces the previous instance's layers, extra
+		 * windows and tasks with the ones this instance creates, and finally
+		 * calls `loadState()`.
+		 *
+		 * @param previous Instance built from the old code; left without subsystems.
+		 * @param state Blob returned by `previous.saveState()`.
+		 */
+		void reloadFrom(App &previous, std::span<const uint8_t> state);
+
+		/**
+		 * @brief Creates the windows requested with addWindow().
+		 * @param backend Backend the main window was created with.
+		 */
+		void openExtraWindows(const struct Backend &backend);
 
 		/**
 		 * @brief Ensures certain methods are only called inside `setup()`.
 		 * @param funcName Name of the method that triggered the check.
 		 */
 		void enforceSetupCall(const char *funcName) const;
+
+		/**
+		 * @brief Sleeps until input changes or a requested redraw is due.
+		 * @param lastUpdate Start time of the previous update.
+		 * @return True if `update()` should run.
+		 */
+		bool waitForRedraw(std::chrono::steady_clock::time_point lastUpdate);
+
+		/**
+		 * @brief Returns true if the surface, the layers or pending uploads need a new frame.
+		 */
+		[[nodiscard]] bool hasFrameChanges() const;
+
+		/**
+		 * @brief Drops pending uploads after the presented source changed; extra windows are resent in full.
+		 */
+		void resetUploads();
+
+		/**
+		 * @brief Queues the changed regions of every open extra window.
+		 */
+		void enqueueExtraWindows();
+
+		/**
+		 * @brief Draws every open extra window.
+		 */
+		void presentExtraWindows();
+
+		/**
+		 * @brief Closes the extra windows the user asked to close.
+		 */
+		void closeRequestedWindows();
+
+		/**
+		 * @brief Destroys the window and presenter of an extra window, keeping its surface.
+		 */
+		void closeExtraWindow(struct ExtraWindow &extra);
+
+		/**
+		 * @brief Uploads the current frame and draws it, compositing layers if any.
+		 */
+		void presentFrame();
+
+		/**
+		 * @brief Sends the latest video frame of a layer fed by Layer::presentNv12() to its texture.
+		 * @param layer The layer showing NV12 frames.
+		 */
+		void presentLayerNv12(Layer &layer);
+
+		/**
+		 * @brief Queues the dirty region of a layer, prioritizing the part inside the viewport.
+		 * @param layer The layer whose surface changed.
+		 */
+		void enqueueLayerUpload(const Layer &layer);
 	};
 
 } // namespace pxr
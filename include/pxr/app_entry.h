@@ -49,3 +49,45 @@
 		}                                                                                                              \
 		return EXIT_SUCCESS;                                                                                           \
 	}
+
+/// Marks a function as visible to the dynamic loader.
+#ifdef _WIN32
+#define PXR_EXPORT_SYMBOL __declspec(dllexport)
+#else
+#define PXR_EXPORT_SYMBOL __attribute__((visibility("default")))
+#endif
+
+/**
+ * @brief Defines the entry point of an app that can also be reloaded by `AppHost`.
+ *
+ * Works like PXR_MAIN when the file is built as an executable. Built as a
+ * shared library that does not link the runtime, it can instead be started
+ * with `pxr_host path/to/library.so`, which reloads it whenever it is rebuilt;
+ * see app_host.h.
+ *
+ * @code
+ * class MyApp : public pxr::App {
+ *     int counter = 0;
+ *
+ *     std::vector<uint8_t> saveState() override {
+ *         const auto *bytes = reinterpret_cast<const uint8_t *>(&counter);
+ *         return {bytes, bytes + sizeof(counter)};
+ *     }
+ *
+ *     void loadState(std::span<const uint8_t> state) override {
+ *         if (state.size() == sizeof(counter)) {
+ *             std::memcpy(&counter, state.data(), sizeof(counter));
+ *         }
+ *     }
+ *     // setup() and update() as usual
+ * };
+ *
+ * PXR_RELOADABLE_MAIN(MyApp)
+ * @endcode
+ *
+ * @param AppClass Your application class that inherits from pxr::App.
+ */
+#define PXR_RELOADABLE_MAIN(AppClass)                                                                                  \
+	PXR_MAIN(AppClass)                                                                                                 \
+	extern "C" PXR_EXPORT_SYMBOL pxr::App *pxrCreateApp() { return new AppClass(); }                                   \
+	extern "C" PXR_EXPORT_SYMBOL void pxrDestroyApp(pxr::App *app) { delete app; }
@@ -0,0 +1,68 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "app.h"
+
+/**
+ * @file app_host.h
+ * @brief Running an app from a shared library that is reloaded when rebuilt.
+ *
+ * Build the app with `PXR_RELOADABLE_MAIN(AppClass)` as a shared library and
+ * start it through the `pxr_host` executable (or an `AppHost` of your own).
+ * When the library file is rewritten, the host loads the new build between
+ * two frames and moves the window, the surface, GPU resources, input and the
+ * asset loader over to a fresh instance; images its `setup()` loads again are
+ * ready at once. `App::saveState()` and `App::loadState()` carry the app's own
+ * data across.
+ *
+ * The library must not link the runtime itself: it uses the host's copy, so
+ * only one set of runtime objects exists. Layers, extra windows and tasks are
+ * recreated by the new code's `setup()`; setup-time settings that shape the
+ * window, such as its size or backend, keep their first values until restart.
+ * Changes are noticed through inotify, so reloading needs Linux; on macOS the
+ * library runs without reloading. Windows is not supported.
+ */
+
+namespace pxr {
+
+	/**
+	 * @brief Loads an app from a shared library and reloads it when the file changes.
+	 */
+	class AppHost {
+	public:
+		/**
+		 * @param libraryPath Shared library built with `PXR_RELOADABLE_MAIN`.
+		 */
+		explicit AppHost(std::string libraryPath);
+
+		/**
+		 * @brief Runs the app until it exits, reloading its library whenever it is rebuilt.
+		 *
+		 * A build that fails to load is reported on standard error and the
+		 * running code is kept until the next rebuild.
+		 *
+		 * @return EXIT_SUCCESS, or EXIT_FAILURE if the first load failed.
+		 */
+		int run();
+
+		/**
+		 * @brief Returns the number of successful reloads so far.
+		 */
+		[[nodiscard]] uint64_t getReloadCount() const;
+
+	private:
+		std::string libraryPath; ///< Library being watched.
+		uint64_t reloadCount = 0; ///< Successful reloads.
+	};
+
+} // namespace pxr
@@ -0,0 +1,116 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "surface.h"
+#include "types.h"
+
+/**
+ * @file assets.h
+ * @brief Handles to images loaded in the background.
+ *
+ * `App::loadImage()` returns immediately. The file is read asynchronously
+ * (through io_uring on Linux, otherwise on worker threads), decoded on a
+ * worker thread and handed to the app at the start of a later frame, within
+ * the budget set by `App::setAssetCommitBudget()`. Loading the same path again
+ * while a handle to it is alive returns the same image.
+ *
+ * With `App::setHotReload()`, images whose files are rewritten are decoded
+ * again in the background and updated in place at the start of a frame; only
+ * the pixels that changed are copied and marked dirty.
+ *
+ * Supported formats are QOI and binary PPM/PGM.
+ */
+
+namespace pxr {
+
+	/**
+	 * @brief Progress of a background load.
+	 */
+	enum class AssetState {
+		Loading, ///< Still being read or decoded.
+		Ready, ///< Decoded; the surface can be drawn.
+		Failed, ///< Could not be read or decoded; see getError().
+	};
+
+	/**
+	 * @brief Shared reference to an image loaded by `App::loadImage()`.
+	 *
+	 * Handles are cheap to copy; all copies see the same image. The state only
+	 * changes between frames, on the main thread, so a handle checked in
+	 * `update()` stays valid for the rest of the frame. A hot reload keeps the
+	 * same surface object unless the image changed size. Once the last handle to
+	 * an image is gone, its pixel memory is recycled for later loads.
+	 */
+	class ImageHandle {
+	public:
+		/**
+		 * @brief Creates an empty handle that refers to no image.
+		 */
+		ImageHandle() = default;
+
+		/**
+		 * @brief Returns the state of the load; an empty handle reports Failed.
+		 */
+		[[nodiscard]] AssetState getState() const;
+
+		/**
+		 * @brief Returns true once the image can be drawn.
+		 */
+		[[nodiscard]] bool isReady() const;
+
+		/**
+		 * @brief Returns true if the image could not be loaded.
+		 */
+		[[nodiscard]] bool isFailed() const;
+
+		/**
+		 * @brief Returns the decoded image; only valid when isReady().
+		 */
+		[[nodiscard]] const Surface &getSurface() const;
+
+		/**
+		 * @brief Returns why the load or the latest hot reload failed, or an empty string.
+		 */
+		[[nodiscard]] const std::string &getError() const;
+
+		/**
+		 * @brief Returns the path passed to `App::loadImage()`.
+		 */
+		[[nodiscard]] const std::string &getPath() const;
+
+		/**
+		 * @brief Returns how many times new content was committed.
+		 *
+		 * Starts at 1 when the image becomes ready and grows with every hot
+		 * reload that changed pixels, so callers caching derived data can
+		 * compare it with the version they last saw.
+		 */
+		[[nodiscard]] uint64_t getVersion() const;
+
+		/**
+		 * @brief Returns the pixels changed by the latest commit: the whole image
+		 * when it was first loaded or changed size, otherwise the bounding box of
+		 * the pixels a hot reload changed.
+		 */
+		[[nodiscard]] Rect getChangedRect() const;
+
+	private:
+		friend class AssetLoader;
+
+		explicit ImageHandle(std::shared_ptr<struct ImageRecord> record) : record(std::move(record)) {}
+
+		std::shared_ptr<struct ImageRecord> record; ///< Shared load state; null for an empty handle.
+	};
+
+} // namespace pxr
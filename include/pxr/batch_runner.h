@@ -0,0 +1,227 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+#include "app.h"
+
+/**
+ * @file batch_runner.h
+ * @brief Running many headless apps in one process.
+ *
+ * A BatchRunner creates a number of App instances, typically one per
+ * parameter combination of a sweep, and steps them on a work-stealing thread
+ * pool. Instances run on the `null` backend without vsync, so they are bound
+ * only by their own `update()` cost. Read-only data such as images or lookup
+ * tables can be loaded once through SharedAssets and used by every instance.
+ */
+
+namespace pxr {
+
+	/**
+	 * @brief Read-only assets loaded once and shared by every instance of a batch.
+	 *
+	 * Thread-safe: instances may request the same key concurrently; the loader
+	 * runs once and the others wait for its result.
+	 */
+	class SharedAssets {
+	public:
+		/**
+		 * @brief Returns the asset stored under a key, loading it on first use.
+		 * @param key Name of the asset.
+		 * @param loader Called once to produce the asset if the key is new.
+		 * @return The shared asset. Requesting a key with a different type is an error.
+		 */
+		template<typename T, typename Loader>
+		std::shared_ptr<const T> get(const std::string &key, Loader &&loader) {
+			auto asset = load(key, typeid(T), [&]() -> std::shared_ptr<const void> {
+				return std::make_shared<const T>(loader());
+			});
+			return std::static_pointer_cast<const T>(asset);
+		}
+
+		/**
+		 * @brief Returns true if an asset was loaded under a key.
+		 */
+		[[nodiscard]] bool contains(const std::string &key) const;
+
+		/**
+		 * @brief Releases every asset not in use by an instance.
+		 */
+		void clear();
+
+	private:
+		/**
+		 * @brief One asset and the flag guarding its loader.
+		 */
+		struct Entry {
+			std::once_flag loaded; ///< Runs the loader once.
+			std::shared_ptr<const void> asset; ///< Loaded value.
+			const std::type_info *type = nullptr; ///< Type the asset was loaded as.
+		};
+
+		/**
+		 * @brief Type-erased implementation of get().
+		 */
+		std::shared_ptr<const void> load(const std::string &key, const std::type_info &type,
+										 const std::function<std::shared_ptr<const void>()> &loader);
+
+		mutable std::mutex mutex; ///< Guards the map, not the entries.
+		std::unordered_map<std::string, std::shared_ptr<Entry>> entries; ///< Assets by key.
+	};
+
+	/**
+	 * @brief Time spent by one instance of a batch.
+	 */
+	struct BatchInstanceStats {
+		uint64_t frames = 0; ///< Frames the instance ran.
+		double frameSeconds = 0.0; ///< Wall time spent inside the instance's frames.
+		bool exited = false; ///< True if the app called `exit()` before its frame budget ran out.
+	};
+
+	/**
+	 * @brief Aggregated throughput of a batch run.
+	 */
+	struct BatchStats {
+		int instances = 0; ///< Number of instances run.
+		int threads = 0; ///< Threads used, including the calling thread.
+		uint64_t frames = 0; ///< Frames run by all instances together.
+		double setupSeconds = 0.0; ///< Wall time to create and set up every instance.
+		double runSeconds = 0.0; ///< Wall time of the frame loop.
+		double framesPerSecond = 0.0; ///< Frames of all instances per second of run time.
+		double slowestInstanceSeconds = 0.0; ///< Largest per-instance frame time.
+		int slowestInstance = -1; ///< Index of that instance.
+	};
+
+	/**
+	 * @brief Runs many headless App instances in parallel.
+	 *
+	 * Instances are created by a factory, set up, stepped and destroyed on a
+	 * thread pool. In lockstep mode every instance finishes frame N before any
+	 * instance starts frame N+1; in free-running mode each instance runs its
+	 * frames back to back and idle threads steal the remaining instances.
+	 *
+	 * Each frame advances `getDeltaTime()` by a fixed step (1/60 s by default),
+	 * so runs are reproducible regardless of machine load. Instances are
+	 * destroyed at the end of run(); override `App::destroy()` to record
+	 * results. An app must not touch other instances or global state without
+	 * its own synchronization.
+	 *
+	 * @code
+	 * pxr::BatchRunner runner;
+	 * runner.setFrameBudget(600);
+	 * const pxr::BatchStats stats = runner.run(64, [](int index, pxr::SharedAssets &assets) {
+	 *     return std::make_unique<Simulation>(index * 0.01f);
+	 * });
+	 * @endcode
+	 */
+	class BatchRunner {
+	public:
+		/// Creates the app of one instance from its index.
+		using Factory = std::function<std::unique_ptr<App>(int index, SharedAssets &assets)>;
+
+		/// Returns the frame budget of one instance from its index.
+		using FrameBudget = std::function<uint64_t(int index)>;
+
+		/**
+		 * @brief How instances advance relative to each other.
+		 */
+		enum class Mode {
+			Lockstep, ///< All instances advance one frame at a time together.
+			FreeRunning, ///< Each instance runs all its frames without waiting for the others.
+		};
+
+		/**
+		 * @brief Starts the thread pool.
+		 * @param threadCount Threads including the caller, or 0 for one per hardware thread.
+		 */
+		explicit BatchRunner(int threadCount = 0);
+
+		/**
+		 * @brief Stops the thread pool.
+		 */
+		~BatchRunner();
+
+		BatchRunner(const BatchRunner &) = delete;
+		BatchRunner &operator=(const BatchRunner &) = delete;
+
+		/**
+		 * @brief Selects lockstep or free-running execution. Default: free-running.
+		 */
+		void setMode(Mode mode);
+
+		/**
+		 * @brief Limits every instance to a number of frames.
+		 * @param frames Frames per instance, or 0 to run until the app calls `exit()`.
+		 */
+		void setFrameBudget(uint64_t frames);
+
+		/**
+		 * @brief Gives each instance its own frame limit.
+		 * @param budget Returns the frames of an instance, or 0 to run until the app calls `exit()`.
+		 */
+		void setFrameBudget(FrameBudget budget);
+
+		/**
+		 * @brief Sets the delta time reported to every frame.
+		 * @param seconds Fixed step in seconds, or 0 to report measured wall time.
+		 */
+		void setFixedDeltaTime(float seconds);
+
+		/**
+		 * @brief Creates, runs and destroys a batch of instances.
+		 * @param count Number of instances.
+		 * @param factory Called once per instance, possibly on several threads at once.
+		 * @return Throughput of the batch. Per-instance figures are available from getInstanceStats().
+		 */
+		BatchStats run(int count, const Factory &factory);
+
+		/**
+		 * @brief Returns the number of threads used, including the calling thread.
+		 */
+		[[nodiscard]] int getThreadCount() const;
+
+		/**
+		 * @brief Returns the per-instance figures of the last run().
+		 */
+		[[nodiscard]] const std::vector<BatchInstanceStats> &getInstanceStats() const;
+
+		/**
+		 * @brief Returns the assets shared by the instances. They persist across run() calls.
+		 */
+		SharedAssets &getAssets();
+
+	private:
+		/**
+		 * @brief Runs one frame of an instance and updates its figures.
+		 * @return False once the instance exited or ran out of frames.
+		 */
+		bool step(int index);
+
+		std::unique_ptr<class ThreadPool> pool;
+		SharedAssets assets;
+		Mode mode = Mode::FreeRunning;
+		FrameBudget frameBudget;
+		float fixedDeltaTime = 1.0f / 60.0f;
+
+		// State of the current run
+		std::vector<std::unique_ptr<App>> apps;
+		std::vector<uint64_t> budgets;
+		std::vector<BatchInstanceStats> instanceStats;
+	};
+
+} // namespace pxr
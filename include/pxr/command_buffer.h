@@ -0,0 +1,120 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "color.h"
+#include "surface.h"
+#include "types.h"
+
+/**
+ * @file command_buffer.h
+ * @brief Recording draw commands from any thread.
+ *
+ * Each thread records into its own CommandBuffer, so recording takes no
+ * locks. At the end of the frame the app sorts every buffer's commands into
+ * screen tiles and executes the tiles in parallel; a tile is only ever
+ * written by one thread, so no synchronization is needed while drawing.
+ */
+
+namespace pxr {
+
+	/**
+	 * @brief One recorded draw operation.
+	 */
+	struct DrawCommand {
+		/**
+		 * @brief Kind of operation.
+		 */
+		enum class Type : uint8_t {
+			Fill, ///< Fills `bounds` with `color`.
+			Line, ///< Draws a line from (x0, y0) to (x1, y1) in `color`.
+			Blit, ///< Copies `source` to (x0, y0), replacing the destination.
+			Sprite, ///< Alpha-blends `source` over the destination at (x0, y0).
+			Text, ///< Draws text at (x0, y0) in `color` with the built-in 5x7 font.
+		};
+
+		Type type = Type::Fill; ///< Operation to perform.
+		Rect bounds; ///< Every pixel the command may write, before clipping.
+		uint32_t color = 0; ///< Packed color (0xAARRGGBB).
+		int x0 = 0; ///< Start or origin x.
+		int y0 = 0; ///< Start or origin y.
+		int x1 = 0; ///< Line end x.
+		int y1 = 0; ///< Line end y.
+		const Surface *source = nullptr; ///< Blit or sprite pixels.
+		uint32_t textOffset = 0; ///< First character in the buffer's text storage.
+		uint32_t textLength = 0; ///< Number of characters.
+	};
+
+	/**
+	 * @brief A list of draw commands recorded by one thread.
+	 *
+	 * Commands of one buffer run in recording order and on top of anything the
+	 * app drew directly during `update()`. The order between buffers of
+	 * different threads is unspecified. Surfaces passed to blit() and sprite()
+	 * must stay alive and unchanged until the frame ends.
+	 */
+	class CommandBuffer {
+	public:
+		/**
+		 * @brief Fills a rectangle with a color.
+		 */
+		void fill(const Rect &rect, const Color &color);
+
+		/**
+		 * @brief Draws a one-pixel line between two points, both included.
+		 */
+		void line(int x0, int y0, int x1, int y1, const Color &color);
+
+		/**
+		 * @brief Copies a surface, replacing the destination pixels.
+		 */
+		void blit(const Surface &source, int x, int y);
+
+		/**
+		 * @brief Alpha-blends a surface over the destination.
+		 */
+		void sprite(const Surface &source, int x, int y);
+
+		/**
+		 * @brief Draws ASCII text with the built-in 5x7 font; '\n' starts a new line.
+		 */
+		void text(int x, int y, std::string_view text, const Color &color);
+
+		/**
+		 * @brief Returns the recorded commands.
+		 */
+		[[nodiscard]] const std::vector<DrawCommand> &getCommands() const;
+
+		/**
+		 * @brief Returns the characters referenced by text commands.
+		 */
+		[[nodiscard]] std::string_view getText(const DrawCommand &command) const;
+
+		/**
+		 * @brief Returns true if no commands were recorded.
+		 */
+		[[nodiscard]] bool isEmpty() const;
+
+		/**
+		 * @brief Drops every command, keeping the allocated storage.
+		 */
+		void clear();
+
+	private:
+		std::vector<DrawCommand> commands; ///< Commands in recording order.
+		std::string textStorage; ///< Characters of every text command.
+	};
+
+} // namespace pxr
@@ -0,0 +1,188 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "surface.h"
+#include "types.h"
+
+/**
+ * @file frame_stream.h
+ * @brief Streaming surfaces to viewers over a Unix domain socket.
+ *
+ * Frames are split into 16x16 tiles. The server hashes the tiles covered by
+ * each frame's damage, compresses only the tiles whose hash changed and sends
+ * them to every connected viewer, so bandwidth and CPU time follow the amount
+ * of changed content rather than the resolution. Viewers that connect late
+ * receive every tile once as a key frame.
+ */
+
+namespace pxr {
+
+	/**
+	 * @brief Serves frames to any number of local viewers.
+	 *
+	 * publish() only copies the damaged tiles into a bounded queue; hashing,
+	 * compression and socket writes happen on a worker thread. When the queue
+	 * is full the damage is carried over to the next publish(), so a slow
+	 * viewer costs frames, never producer time.
+	 */
+	class FrameStreamServer {
+	public:
+		/**
+		 * @brief Starts listening on a socket path.
+		 * @param path Filesystem path of the socket, e.g. "/tmp/pxr_stream.sock".
+		 * @param width Frame width in pixels.
+		 * @param height Frame height in pixels.
+		 * @param queueCapacity Maximum number of frames waiting for the worker.
+		 */
+		FrameStreamServer(const std::string &path, int width, int height, int queueCapacity = 4);
+
+		/**
+		 * @brief Stops the worker, disconnects viewers and removes the socket file.
+		 */
+		~FrameStreamServer();
+
+		FrameStreamServer(const FrameStreamServer &) = delete;
+		FrameStreamServer &operator=(const FrameStreamServer &) = delete;
+
+		/**
+		 * @brief Queues the changed part of a frame without waiting for the worker.
+		 * @param surface The frame. Must match the stream dimensions.
+		 * @param damage Region changed since the previous publish() call.
+		 * @param frameNumber Frame number sent with the tiles.
+		 */
+		void publish(const Surface &surface, const Rect &damage, uint64_t frameNumber);
+
+		/**
+		 * @brief Returns the number of frames dropped because the queue was full.
+		 */
+		[[nodiscard]] uint64_t getDroppedFrames() const;
+
+	private:
+		/**
+		 * @brief Tile-aligned pixels copied out of one published frame.
+		 */
+		struct Job {
+			Rect region; ///< Copied region, aligned to tile boundaries.
+			std::vector<uint32_t> pixels; ///< Region pixels, tightly packed.
+			uint64_t frameNumber = 0; ///< Producer frame number.
+		};
+
+		/**
+		 * @brief Accepts viewers and encodes queued frames until stopped.
+		 */
+		void run();
+
+		/**
+		 * @brief Accepts pending viewers and sends each one the current frame.
+		 */
+		void acceptViewers();
+
+		/**
+		 * @brief Copies a job into the mirror and sends the tiles whose content changed.
+		 */
+		void encodeJob(const Job &job);
+
+		/**
+		 * @brief Sends a message to every viewer, dropping the ones that fail.
+		 */
+		void broadcast(const std::vector<uint8_t> &message);
+
+		int width; ///< Frame width in pixels.
+		int height; ///< Frame height in pixels.
+		int tilesX; ///< Number of tile columns.
+		size_t queueCapacity; ///< Maximum number of queued jobs.
+
+		std::unique_ptr<class LocalSocket> listener; ///< Listening socket.
+		std::vector<std::unique_ptr<class LocalSocket>> viewers; ///< Connected viewers (worker thread only).
+		std::vector<uint32_t> mirror; ///< Last frame seen by the worker.
+		std::vector<uint64_t> tileHashes; ///< Content hash of every mirror tile.
+		std::vector<uint8_t> message; ///< Reused message buffer.
+
+		mutable std::mutex mutex; ///< Guards the members below.
+		std::condition_variable wakeUp; ///< Signals queued jobs or shutdown.
+		std::deque<Job> queue; ///< Jobs waiting for the worker.
+		std::vector<Job> spareJobs; ///< Finished jobs kept to reuse their buffers.
+		Rect carriedDamage; ///< Damage of frames dropped because the queue was full.
+		uint64_t droppedFrames = 0; ///< Frames not queued because the queue was full.
+		bool stopping = false; ///< Set when the worker should exit.
+
+		std::thread worker; ///< Encoder thread; started last, joined first.
+	};
+
+	/**
+	 * @brief Receives frames from a FrameStreamServer.
+	 */
+	class FrameStreamClient {
+	public:
+		/**
+		 * @brief Connects to a server and reads the stream dimensions.
+		 * @param path Socket path used by the server.
+		 */
+		explicit FrameStreamClient(const std::string &path);
+
+		/**
+		 * @brief Disconnects from the server.
+		 */
+		~FrameStreamClient();
+
+		FrameStreamClient(const FrameStreamClient &) = delete;
+		FrameStreamClient &operator=(const FrameStreamClient &) = delete;
+
+		/**
+		 * @brief Returns the frame width in pixels.
+		 */
+		[[nodiscard]] int getWidth() const;
+
+		/**
+		 * @brief Returns the frame height in pixels.
+		 */
+		[[nodiscard]] int getHeight() const;
+
+		/**
+		 * @brief Applies every complete frame received so far, without waiting.
+		 *
+		 * Changed tiles are written into the target and marked dirty.
+		 *
+		 * @param target Surface with the stream dimensions; keep passing the same one.
+		 * @param frameNumber Receives the newest frame number, if not null.
+		 * @return True if at least one frame was applied.
+		 */
+		bool poll(Surface &target, uint64_t *frameNumber = nullptr);
+
+		/**
+		 * @brief Returns whether the server is still connected.
+		 */
+		[[nodiscard]] bool isConnected() const;
+
+		/**
+		 * @brief Returns the number of bytes received so far.
+		 */
+		[[nodiscard]] uint64_t getBytesReceived() const;
+
+	private:
+		std::unique_ptr<class LocalSocket> socket; ///< Connection to the server.
+		std::vector<uint8_t> inbox; ///< Received bytes not yet decoded.
+		int width = 0; ///< Frame width in pixels.
+		int height = 0; ///< Frame height in pixels.
+		uint64_t bytesReceived = 0; ///< Total bytes received.
+		bool connected = true; ///< Cleared when the server disconnects.
+	};
+
+} // namespace pxr
@@ -0,0 +1,211 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "surface.h"
+#include "types.h"
+#include "yuv.h"
+
+namespace pxr {
+
+	/**
+	 * @brief Controls how a layer's pixels are combined with the pixels below it.
+	 */
+	enum class BlendMode : uint8_t {
+		Normal, ///< Source-over alpha blending.
+		Add, ///< Adds the source color (scaled by alpha) and saturates.
+		Multiply, ///< Multiplies the destination by the source color.
+		Replace, ///< Copies source pixels, ignoring their alpha (opacity still applies).
+	};
+
+	/**
+	 * @brief A drawable surface placed in the app's layer stack.
+	 *
+	 * Layers are created through `App::createLayer()` and composited on top of the
+	 * app surface in ascending z-order. Only the regions that changed since the last
+	 * frame (pixels drawn into the layer surface or changed layer properties) are
+	 * recomposited, so layers that stay untouched cost nothing per frame.
+	 */
+	class Layer {
+	public:
+		/**
+		 * @brief Constructs a layer with a transparent surface of the given size.
+		 * @param width Width of the layer surface in pixels.
+		 * @param height Height of the layer surface in pixels.
+		 * @param zOrder Stacking order; higher values are drawn on top.
+		 */
+		Layer(int width, int height, int zOrder = 0);
+
+		/**
+		 * @brief Returns the surface to draw into.
+		 */
+		[[nodiscard]] Surface &getSurface();
+
+		/**
+		 * @brief Returns the surface backing this layer.
+		 */
+		[[nodiscard]] const Surface &getSurface() const;
+
+		/**
+		 * @brief Shows a video frame in the layer instead of the surface pixels.
+		 *
+		 * The planes are copied, so the caller may reuse them right away. When
+		 * layers are composited on the GPU, the frame goes up at the next present
+		 * as luma and chroma planes, 1.5 bytes per pixel instead of 4, and a
+		 * shader converts it to RGB; the surface is neither converted nor
+		 * uploaded meanwhile. Without OpenGL (software, terminal and framebuffer
+		 * backends, headless apps) or with CPU compositing, the frame is
+		 * converted into the surface when the layer is composited.
+		 *
+		 * @param planes NV12 planes of the layer surface's size.
+		 * @param space Color space the frame was encoded in.
+		 */
+		void presentNv12(const YuvPlanes &planes, YuvColorSpace space = {});
+
+		/**
+		 * @brief Stops showing video frames; the layer shows its surface again, starting with the last frame.
+		 */
+		void stopNv12();
+
+		/**
+		 * @brief Returns whether the layer shows frames passed to presentNv12().
+		 */
+		[[nodiscard]] bool showsNv12() const;
+
+		/**
+		 * @brief Hands out the latest frame once, for an upload to the GPU.
+		 *
+		 * Called by the app when compositing on the GPU. The planes point into
+		 * the layer and stay valid until the next presentNv12().
+		 *
+		 * @param planes Receives the frame.
+		 * @param space Receives its color space.
+		 * @return False if there is no frame or it was already handed out.
+		 */
+		bool takeNv12Frame(YuvPlanes &planes, YuvColorSpace &space);
+
+		/**
+		 * @brief Converts the latest frame into the surface unless that was done already.
+		 *
+		 * Called by the app before compositing on the CPU.
+		 */
+		void resolveNv12();
+
+		/**
+		 * @brief Sets the stacking order. Higher values are drawn on top.
+		 * @param zOrder The new z-order.
+		 */
+		void setZOrder(int zOrder);
+
+		/**
+		 * @brief Sets the layer opacity.
+		 * @param opacity Opacity in the range [0, 1].
+		 */
+		void setOpacity(float opacity);
+
+		/**
+		 * @brief Sets how the layer is combined with the layers below it.
+		 * @param mode The blend mode.
+		 */
+		void setBlendMode(BlendMode mode);
+
+		/**
+		 * @brief Sets the position of the layer's top-left corner on the app surface.
+		 * @param x X offset in surface pixels.
+		 * @param y Y offset in surface pixels.
+		 */
+		void setOffset(int x, int y);
+
+		/**
+		 * @brief Sets an integer magnification for the layer.
+		 *
+		 * Each layer pixel covers `scale × scale` app surface pixels, which lets a
+		 * low-resolution layer (e.g. a HUD) be drawn at a fraction of the cost.
+		 *
+		 * @param scale Magnification factor, at least 1.
+		 */
+		void setScale(int scale);
+
+		/**
+		 * @brief Shows or hides the layer.
+		 * @param visible True to show the layer.
+		 */
+		void setVisible(bool visible);
+
+		/// @brief Returns the stacking order.
+		[[nodiscard]] int getZOrder() const;
+
+		/// @brief Returns the opacity in the range [0, 1].
+		[[nodiscard]] float getOpacity() const;
+
+		/// @brief Returns the opacity as an 8-bit value.
+		[[nodiscard]] uint8_t getOpacity8() const;
+
+		/// @brief Returns the blend mode.
+		[[nodiscard]] BlendMode getBlendMode() const;
+
+		/// @brief Returns the X offset on the app surface.
+		[[nodiscard]] int getOffsetX() const;
+
+		/// @brief Returns the Y offset on the app surface.
+		[[nodiscard]] int getOffsetY() const;
+
+		/// @brief Returns the integer magnification factor.
+		[[nodiscard]] int getScale() const;
+
+		/// @brief Returns whether the layer is visible.
+		[[nodiscard]] bool isVisible() const;
+
+		/**
+		 * @brief Returns the area covered by the layer, in app surface coordinates.
+		 */
+		[[nodiscard]] Rect getBounds() const;
+
+		/**
+		 * @brief Returns the app surface area that must be recomposited for this layer.
+		 *
+		 * This combines the layer surface's dirty region (scaled and moved to the
+		 * layer offset) with any damage caused by property changes since the last
+		 * composite.
+		 */
+		[[nodiscard]] Rect getDamage() const;
+
+		/**
+		 * @brief Clears the surface dirty region and pending property damage.
+		 *
+		 * Called by the compositor after the layer has been composited.
+		 */
+		void clearDamage();
+
+	private:
+		Surface surface; ///< Pixel content of the layer.
+		int zOrder = 0; ///< Stacking order.
+		uint8_t opacity = 255; ///< Opacity as 0–255.
+		BlendMode blendMode = BlendMode::Normal; ///< Blend mode.
+		int offsetX = 0; ///< X position on the app surface.
+		int offsetY = 0; ///< Y position on the app surface.
+		int scale = 1; ///< Integer magnification factor.
+		bool visible = true; ///< Visibility flag.
+		Rect propertyDamage; ///< App surface area invalidated by property changes.
+		std::vector<uint8_t> nv12Buffer; ///< Latest video frame, tightly packed NV12.
+		YuvColorSpace nv12Space; ///< Color space of the latest frame.
+		bool nv12 = false; ///< Whether the layer shows video frames.
+		bool nv12Uploaded = false; ///< Whether the latest frame was handed out for the GPU.
+		bool nv12Converted = false; ///< Whether the latest frame is in the surface.
+
+		/**
+		 * @brief Marks the current on-screen bounds as needing recomposition.
+		 */
+		void invalidateBounds();
+	};
+
+} // namespace pxr
@@ -0,0 +1,105 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file pixel_format.h
+ * @brief Conversions between Surface pixels and the layouts of files, devices and encoders.
+ *
+ * Every conversion goes through the Surface layout, Argb8888. Formats without
+ * alpha read as opaque and drop alpha when written. The row functions use the
+ * SIMD kernels picked for the running CPU, so converting a whole frame costs
+ * about as much as copying it.
+ */
+
+namespace pxr {
+
+	/**
+	 * @brief Memory layouts of a pixel.
+	 */
+	enum class PixelFormat : uint8_t {
+		Argb8888, ///< 32-bit 0xAARRGGBB words, the layout of Surface and Color; bytes B, G, R, A on little-endian.
+		Abgr8888, ///< 32-bit 0xAABBGGRR words; bytes R, G, B, A on little-endian.
+		Rgb888, ///< 24-bit, bytes in red, green, blue order.
+		Bgr888, ///< 24-bit, bytes in blue, green, red order.
+		Rgb565, ///< 16-bit words with 5 bits of red, 6 of green and 5 of blue.
+		Rgb555, ///< 16-bit words with 5 bits per channel; the top bit is written as 0.
+		Grey8, ///< 8-bit luma; reads as equal red, green and blue.
+		RgbaF32, ///< Four floats in red, green, blue, alpha order, from 0 to 1; out-of-range values are clamped.
+	};
+
+	/**
+	 * @brief Weights of red, green and blue when a pixel is reduced to luma.
+	 */
+	enum class LumaWeights : uint8_t {
+		Bt601, ///< ITU-R BT.601 (0.299, 0.587, 0.114), the usual weights of standard-definition video and JPEG.
+		Bt709, ///< ITU-R BT.709 (0.2126, 0.7152, 0.0722), the weights of HD video and sRGB.
+	};
+
+	namespace pixels {
+
+		/**
+		 * @brief Returns the size of one pixel of a format in bytes.
+		 */
+		[[nodiscard]] int getBytesPerPixel(PixelFormat format);
+
+		/**
+		 * @brief Converts a row of pixels.
+		 * @param dst Receives count pixels in dstFormat. May equal src when both formats have the same size.
+		 * @param dstFormat Layout written to dst.
+		 * @param src count pixels in srcFormat.
+		 * @param srcFormat Layout read from src.
+		 * @param count Number of pixels.
+		 * @param luma Weights used when converting to Grey8.
+		 */
+		void convertRow(void *dst, PixelFormat dstFormat, const void *src, PixelFormat srcFormat, int count,
+						LumaWeights luma = LumaWeights::Bt601);
+
+		/**
+		 * @brief Converts a rectangle of pixels, one row at a time.
+		 * @param dst First row of the destination.
+		 * @param dstStride Distance between destination rows in bytes.
+		 * @param dstFormat Layout written to dst.
+		 * @param src First row of the source.
+		 * @param srcStride Distance between source rows in bytes.
+		 * @param srcFormat Layout read from src.
+		 * @param width Pixels per row.
+		 * @param height Number of rows.
+		 * @param luma Weights used when converting to Grey8.
+		 */
+		void convertImage(void *dst, size_t dstStride, PixelFormat dstFormat, const void *src, size_t srcStride,
+						  PixelFormat srcFormat, int width, int height, LumaWeights luma = LumaWeights::Bt601);
+
+		/**
+		 * @brief Multiplies the color channels of Argb8888 pixels by their alpha.
+		 * @param dst Receives count pixels; may equal src.
+		 * @param src Straight-alpha pixels.
+		 * @param count Number of pixels.
+		 */
+		void premultiplyRow(uint32_t *dst, const uint32_t *src, int count);
+
+		/**
+		 * @brief Divides the color channels of premultiplied Argb8888 pixels by their alpha.
+		 *
+		 * Pixels with zero alpha become transparent black. Precision lost by
+		 * premultiplying is not recovered.
+		 *
+		 * @param dst Receives count pixels; may equal src.
+		 * @param src Premultiplied pixels.
+		 * @param count Number of pixels.
+		 */
+		void unpremultiplyRow(uint32_t *dst, const uint32_t *src, int count);
+
+	} // namespace pixels
+
+} // namespace pxr
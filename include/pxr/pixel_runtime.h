@@ -13,17 +13,45 @@
  * @brief Convenience umbrella include for the entire Pixel Runtime API.
  *
  * Including this file gives access to all core components of Pixel Runtime:
+ * - Allocation tracking per frame and zone (allocations.h)
  * - App lifecycle (app.h, app_entry.h)
+ * - Reloading app code from shared libraries (app_host.h)
+ * - Background image loading (assets.h)
+ * - Headless batch runs (batch_runner.h)
  * - Color utilities (color.h)
+ * - Multithreaded draw command recording (command_buffer.h)
+ * - Frame streaming over Unix sockets (frame_stream.h)
  * - Input codes (input_codes.h)
+ * - Layer stack (layer.h)
  * - Math (math.h)
+ * - Pixel format conversions (pixel_format.h)
+ * - Profiling zones (profiler.h)
+ * - Shared-memory frame output (shared_frame.h)
+ * - Shared-memory input injection (shared_input.h)
  * - Surface drawing (surface.h)
+ * - Coroutine tasks (task.h)
  * - Type definitions (types.h)
+ * - Y4M video playback (video_player.h)
+ * - YUV video frame conversions (yuv.h)
  */
+#include "pxr/allocations.h"
 #include "pxr/app.h"
 #include "pxr/app_entry.h"
+#include "pxr/app_host.h"
+#include "pxr/assets.h"
+#include "pxr/batch_runner.h"
 #include "pxr/color.h"
+#include "pxr/command_buffer.h"
+#include "pxr/frame_stream.h"
 #include "pxr/input_codes.h"
+#include "pxr/layer.h"
 #include "pxr/math.h"
+#include "pxr/pixel_format.h"
+#include "pxr/profiler.h"
+#include "pxr/shared_frame.h"
+#include "pxr/shared_input.h"
 #include "pxr/surface.h"
+#include "pxr/task.h"
 #include "pxr/types.h"
+#include "pxr/video_player.h"
+#include "pxr/yuv.h"
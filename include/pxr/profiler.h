@@ -0,0 +1,112 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @file profiler.h
+ * @brief Named timing zones for startup and frame profiling.
+ *
+ * Wrap a block in `PXR_PROFILE_ZONE("name")` to add its duration to the
+ * zone's totals. The runtime times its own startup phases (`startup.*`) and
+ * frame steps (`frame.*`) the same way. Set the `PXR_PROFILE` environment
+ * variable (to anything but an empty string or `0`) to print the collected
+ * zones when an app finishes.
+ *
+ * Zones may be entered on any thread and may nest. Names must be string
+ * literals or otherwise outlive the process's use of the profiler.
+ */
+
+namespace pxr {
+
+	/**
+	 * @brief Accumulated timings of one zone.
+	 */
+	struct ProfileZoneStats {
+		const char *name = nullptr; ///< Name passed to the zone.
+		uint64_t count = 0; ///< Number of times the zone was left.
+		double totalSeconds = 0.0; ///< Time spent in the zone, nested zones included.
+		double maxSeconds = 0.0; ///< Longest single visit.
+	};
+
+	/**
+	 * @brief Times the scope it lives in; use it through PXR_PROFILE_ZONE.
+	 */
+	class ProfileZone {
+	public:
+		/**
+		 * @param name Zone name; must stay valid for as long as the profiler is used.
+		 */
+		explicit ProfileZone(const char *name);
+
+		/**
+		 * @brief Adds the elapsed time to the zone's totals.
+		 */
+		~ProfileZone();
+
+		ProfileZone(const ProfileZone &) = delete;
+		ProfileZone &operator=(const ProfileZone &) = delete;
+
+		/**
+		 * @brief Returns the zone's name.
+		 */
+		[[nodiscard]] const char *getName() const;
+
+		/**
+		 * @brief Returns the innermost zone the calling thread is in, or nullptr.
+		 */
+		[[nodiscard]] static const ProfileZone *getCurrent();
+
+	private:
+		const char *name; ///< Zone name.
+		ProfileZone *parent; ///< Enclosing zone on this thread.
+		std::chrono::steady_clock::time_point start; ///< Entry time.
+	};
+
+	namespace profiler {
+
+		/**
+		 * @brief Returns the totals of every zone left so far, summed over all threads.
+		 */
+		std::vector<ProfileZoneStats> getZones();
+
+		/**
+		 * @brief Clears all totals.
+		 */
+		void reset();
+
+		/**
+		 * @brief Formats the totals as a table with one zone per line.
+		 */
+		std::string formatReport();
+
+	} // namespace profiler
+
+} // namespace pxr
+
+/// Pastes two tokens after expanding them; gives each zone variable a unique name.
+#define PXR_PROFILE_CONCAT_IMPL(a, b) a##b
+#define PXR_PROFILE_CONCAT(a, b) PXR_PROFILE_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Times the rest of the enclosing scope under the given zone name.
+ *
+ * @code
+ * void update() override {
+ *     PXR_PROFILE_ZONE("physics");
+ *     stepPhysics();
+ * }
+ * @endcode
+ */
+#define PXR_PROFILE_ZONE(name) const pxr::ProfileZone PXR_PROFILE_CONCAT(pxrProfileZone, __LINE__)(name)
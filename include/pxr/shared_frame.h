@@ -0,0 +1,189 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "surface.h"
+#include "types.h"
+
+/**
+ * @file shared_frame.h
+ * @brief Publishing surfaces to other local processes through POSIX shared memory.
+ *
+ * A producer writes frames into a ring of slots inside a shared-memory object.
+ * Each slot is guarded by a sequence lock: the sequence is odd while the slot is
+ * being written and even once the frame is complete. Consumers map the same
+ * object, read pixels in place and re-check the sequence afterwards, so they never
+ * copy frames and never block the producer.
+ */
+
+namespace pxr {
+
+	/**
+	 * @brief Header at the start of a shared frame ring.
+	 */
+	struct SharedFrameHeader {
+		static constexpr uint32_t Magic = 0x50585246; ///< "PXRF"
+		static constexpr uint32_t Version = 1; ///< Layout version.
+
+		uint32_t magic; ///< Always Magic once the ring is initialized.
+		uint32_t version; ///< Layout version.
+		uint32_t width; ///< Frame width in pixels.
+		uint32_t height; ///< Frame height in pixels.
+		uint32_t slotCount; ///< Number of slots in the ring.
+		uint32_t reserved; ///< Padding, always zero.
+		uint64_t slotStride; ///< Distance between slots in bytes.
+		std::atomic<uint64_t> latestSlot; ///< Index of the newest complete slot, or UINT64_MAX if none.
+		std::atomic<uint64_t> publishedFrames; ///< Number of frames published so far.
+	};
+
+	/**
+	 * @brief Header at the start of each slot; pixels follow at SharedFrameSlot::PixelOffset.
+	 */
+	struct SharedFrameSlot {
+		static constexpr size_t PixelOffset = 64; ///< Offset of the pixel data from the slot start.
+
+		std::atomic<uint64_t> sequence; ///< Sequence lock; odd while the slot is being written.
+		uint64_t frameNumber; ///< Producer frame number of the content.
+	};
+
+	static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared frames need lock-free 64-bit atomics.");
+
+	/**
+	 * @brief Publishes surfaces into a shared-memory ring.
+	 *
+	 * The ring is created when the writer is constructed and unlinked when it is
+	 * destroyed. Only rows that changed since a slot was last written are copied.
+	 */
+	class SharedFrameWriter {
+	public:
+		/**
+		 * @brief Creates (or replaces) a shared-memory ring.
+		 * @param name Shared-memory object name, e.g. "/my_app_frames".
+		 * @param width Frame width in pixels.
+		 * @param height Frame height in pixels.
+		 * @param slotCount Number of frames kept in the ring (at least 2).
+		 */
+		SharedFrameWriter(const std::string &name, int width, int height, int slotCount = 3);
+
+		/**
+		 * @brief Unmaps and unlinks the shared-memory object.
+		 */
+		~SharedFrameWriter();
+
+		SharedFrameWriter(const SharedFrameWriter &) = delete;
+		SharedFrameWriter &operator=(const SharedFrameWriter &) = delete;
+
+		/**
+		 * @brief Writes a frame into the next slot without waiting for readers.
+		 * @param surface The frame. Must match the ring dimensions.
+		 * @param damage Region changed since the previous publish() call.
+		 * @param frameNumber Frame number stored with the slot.
+		 */
+		void publish(const Surface &surface, const Rect &damage, uint64_t frameNumber);
+
+		/**
+		 * @brief Returns the shared-memory object name.
+		 */
+		[[nodiscard]] const std::string &getName() const;
+
+	private:
+		std::unique_ptr<class SharedMemory> memory; ///< Mapped shared-memory object.
+		SharedFrameHeader *header = nullptr; ///< Ring header inside the mapping.
+		std::vector<Rect> slotDamage; ///< Region each slot is missing relative to the newest frame.
+		uint32_t nextSlot = 0; ///< Slot written by the next publish().
+	};
+
+	/**
+	 * @brief A frame read in place from a shared-memory ring.
+	 *
+	 * The pixels point directly into shared memory. Call
+	 * SharedFrameReader::isStillValid() after using them to detect whether the
+	 * producer overwrote the slot in the meantime.
+	 */
+	struct SharedFrameView {
+		const uint32_t *pixels = nullptr; ///< Packed 0xAARRGGBB pixels, top row first.
+		int width = 0; ///< Frame width in pixels.
+		int height = 0; ///< Frame height in pixels.
+		uint64_t frameNumber = 0; ///< Producer frame number.
+		uint64_t sequence = 0; ///< Slot sequence observed when the view was acquired.
+		uint32_t slot = 0; ///< Slot index.
+	};
+
+	/**
+	 * @brief Consumes frames from a shared-memory ring created by SharedFrameWriter.
+	 */
+	class SharedFrameReader {
+	public:
+		/**
+		 * @brief Opens an existing ring.
+		 * @param name Shared-memory object name used by the producer.
+		 */
+		explicit SharedFrameReader(const std::string &name);
+
+		/**
+		 * @brief Unmaps the ring.
+		 */
+		~SharedFrameReader();
+
+		SharedFrameReader(const SharedFrameReader &) = delete;
+		SharedFrameReader &operator=(const SharedFrameReader &) = delete;
+
+		/**
+		 * @brief Returns the frame width in pixels.
+		 */
+		[[nodiscard]] int getWidth() const;
+
+		/**
+		 * @brief Returns the frame height in pixels.
+		 */
+		[[nodiscard]] int getHeight() const;
+
+		/**
+		 * @brief Acquires the newest complete frame without copying it.
+		 * @param view Receives the frame on success.
+		 * @return False if no frame has been published yet.
+		 */
+		bool acquireLatest(SharedFrameView &view) const;
+
+		/**
+		 * @brief Checks whether a view's slot is still unchanged.
+		 * @param view A view returned by acquireLatest().
+		 * @return True if the pixels read through the view were not overwritten.
+		 */
+		[[nodiscard]] bool isStillValid(const SharedFrameView &view) const;
+
+		/**
+		 * @brief Copies the newest complete frame into a surface.
+		 *
+		 * Retries if the producer overwrote the slot during the copy.
+		 *
+		 * @param target Surface with the ring dimensions.
+		 * @param frameNumber Receives the frame number, if not null.
+		 * @return False if no frame has been published yet.
+		 */
+		bool readInto(Surface &target, uint64_t *frameNumber = nullptr) const;
+
+	private:
+		std::unique_ptr<class SharedMemory> memory; ///< Mapped shared-memory object.
+		const SharedFrameHeader *header = nullptr; ///< Ring header inside the mapping.
+
+		/**
+		 * @brief Returns the slot header for an index.
+		 */
+		[[nodiscard]] const SharedFrameSlot *slotAt(uint64_t index) const;
+	};
+
+} // namespace pxr
@@ -0,0 +1,126 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "input_codes.h"
+
+/**
+ * @file shared_input.h
+ * @brief Injecting keyboard and mouse events from other local processes.
+ *
+ * The application creates a single-producer/single-consumer event ring in a POSIX
+ * shared-memory object (see App::setSharedInput()). Another process opens it with
+ * SharedInputWriter and pushes events; the application drains the ring once per
+ * frame and applies the events exactly like window-system input. The head and
+ * tail indices live on separate cache lines so producer and consumer never write
+ * to the same line.
+ */
+
+namespace pxr {
+
+	/**
+	 * @brief Kind of an injected input event.
+	 */
+	enum class SharedInputType : uint16_t {
+		Key = 1, ///< Key press or release; code is a KeyCode.
+		MouseButton = 2, ///< Mouse button press or release; code is a MouseButton.
+		MouseMove = 3, ///< Cursor moved to (x, y) in window-space pixels.
+	};
+
+	/**
+	 * @brief One event in a shared input ring.
+	 */
+	struct SharedInputEvent {
+		SharedInputType type; ///< Event kind.
+		uint16_t pressed; ///< 1 for press, 0 for release. Unused for MouseMove.
+		int32_t code; ///< Key code or mouse button index.
+		int32_t x; ///< Cursor X for MouseMove.
+		int32_t y; ///< Cursor Y for MouseMove.
+	};
+
+	static_assert(sizeof(SharedInputEvent) == 16, "SharedInputEvent layout must stay fixed.");
+
+	/**
+	 * @brief Header at the start of a shared input ring; events follow at SharedInputHeader::EventOffset.
+	 *
+	 * head counts events written by the producer, tail counts events consumed by
+	 * the application. Both only grow; the slot of an index is index & (capacity - 1).
+	 */
+	struct SharedInputHeader {
+		static constexpr uint32_t Magic = 0x50585249; ///< "PXRI"
+		static constexpr uint32_t Version = 1; ///< Layout version.
+		static constexpr size_t EventOffset = 192; ///< Offset of the event array from the ring start.
+
+		uint32_t magic; ///< Always Magic once the ring is initialized.
+		uint32_t version; ///< Layout version.
+		uint32_t capacity; ///< Number of event slots, a power of two.
+		uint32_t reserved; ///< Padding, always zero.
+		alignas(64) std::atomic<uint64_t> head; ///< Events written by the producer.
+		alignas(64) std::atomic<uint64_t> tail; ///< Events consumed by the application.
+	};
+
+	static_assert(sizeof(SharedInputHeader) <= SharedInputHeader::EventOffset, "Header overlaps events.");
+	static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared input needs lock-free 64-bit atomics.");
+
+	/**
+	 * @brief Pushes input events into a ring created by an application.
+	 *
+	 * Only one writer may be attached to a ring at a time. Pushing never blocks:
+	 * when the application falls behind and the ring is full, the event is rejected.
+	 */
+	class SharedInputWriter {
+	public:
+		/**
+		 * @brief Opens an existing ring.
+		 * @param name Shared-memory object name passed to App::setSharedInput().
+		 */
+		explicit SharedInputWriter(const std::string &name);
+
+		/**
+		 * @brief Unmaps the ring.
+		 */
+		~SharedInputWriter();
+
+		SharedInputWriter(const SharedInputWriter &) = delete;
+		SharedInputWriter &operator=(const SharedInputWriter &) = delete;
+
+		/**
+		 * @brief Appends an event.
+		 * @param event The event to append.
+		 * @return False if the ring is full.
+		 */
+		bool push(const SharedInputEvent &event);
+
+		/// @brief Pushes a key press.
+		bool pressKey(KeyCode key);
+
+		/// @brief Pushes a key release.
+		bool releaseKey(KeyCode key);
+
+		/// @brief Pushes a mouse button press.
+		bool pressMouse(MouseButton button);
+
+		/// @brief Pushes a mouse button release.
+		bool releaseMouse(MouseButton button);
+
+		/// @brief Pushes a cursor move to (x, y) in window-space pixels.
+		bool moveMouse(int x, int y);
+
+	private:
+		std::unique_ptr<class SharedMemory> memory; ///< Mapped shared-memory object.
+		SharedInputHeader *header = nullptr; ///< Ring header inside the mapping.
+		SharedInputEvent *events = nullptr; ///< Event slots inside the mapping.
+	};
+
+} // namespace pxr
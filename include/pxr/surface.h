@@ -20,7 +20,8 @@ namespace pxr {
 	 * @brief Represents a 2D pixel buffer for CPU-side rendering.
 	 *
 	 * The Surface class stores pixel data in a 1D array and allows manipulation
-	 * of individual pixels.
+	 * of individual pixels. It also tracks the bounding box of the pixels modified
+	 * since the last call to clearDirty(), so consumers can skip unchanged content.
 	 */
 	class Surface {
 	public:
@@ -66,12 +67,47 @@ namespace pxr {
 
 		/**
 		 * @brief Copies this surface's pixel data to another surface at a given offset.
+		 *
+		 * Pixels falling outside the target are clipped. The target may be this
+		 * surface itself, which scrolls its contents by the offset.
+		 *
 		 * @param target The destination surface.
 		 * @param dstX X offset on the destination surface.
 		 * @param dstY Y offset on the destination surface.
 		 */
 		void blitTo(Surface &target, int dstX = 0, int dstY = 0) const;
 
+		//--------------------------------------------------------------------------
+		// Dirty Tracking
+		//--------------------------------------------------------------------------
+
+		/**
+		 * @brief Returns true if any pixel changed since the last clearDirty().
+		 */
+		[[nodiscard]] bool isDirty() const;
+
+		/**
+		 * @brief Returns the bounding box of the pixels changed since the last clearDirty().
+		 * @return The dirty rectangle, or an empty rectangle if nothing changed.
+		 */
+		[[nodiscard]] Rect getDirtyRect() const;
+
+		/**
+		 * @brief Marks the whole surface as changed.
+		 */
+		void markDirty();
+
+		/**
+		 * @brief Marks a region as changed. The region is clipped to the surface bounds.
+		 * @param rect The changed region.
+		 */
+		void markDirty(const Rect &rect);
+
+		/**
+		 * @brief Resets the dirty region. Called once the changes have been consumed.
+		 */
+		void clearDirty();
+
 		/**
 		 * @brief Provides access to the raw 32-bit pixel buffer.
 		 * @return A const reference to the internal pixel data.
@@ -84,6 +120,16 @@ namespace pxr {
 		 */
 		[[nodiscard]] const uint32_t *data() const;
 
+		/**
+		 * @brief Returns a writable pointer to the internal pixel data.
+		 *
+		 * Writes through this pointer bypass dirty tracking; call markDirty()
+		 * for the modified region afterwards.
+		 *
+		 * @return Pointer to the pixel data array.
+		 */
+		[[nodiscard]] uint32_t *data();
+
 		/**
 		 * @brief Returns the width of the surface in pixels.
 		 * @return The surface width.
@@ -129,6 +175,7 @@ namespace pxr {
 		int width = 0; ///< Width of the surface in pixels.
 		int height = 0; ///< Height of the surface in pixels.
 		std::vector<uint32_t> pixels; ///< Pixel buffer stored as 32-bit packed RGBA.
+		Rect dirtyRect; ///< Bounding box of pixels changed since the last clearDirty().
 
 		/**
 		 * @brief Checks whether the given pixel coordinates are within bounds.
@@ -137,6 +184,13 @@ namespace pxr {
 		 * @return True if within bounds; false otherwise.
 		 */
 		[[nodiscard]] bool isInBounds(int x, int y) const;
+
+		/**
+		 * @brief Grows the dirty rectangle to include a single pixel.
+		 * @param x X-coordinate.
+		 * @param y Y-coordinate.
+		 */
+		void expandDirty(int x, int y);
 	};
 
 } // namespace pxr
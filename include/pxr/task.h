@@ -0,0 +1,267 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+/**
+ * @file task.h
+ * @brief Coroutine tasks resumed by the app's frame loop.
+ *
+ * A function returning Task may suspend with `co_await nextFrame()`,
+ * `co_await seconds(x)` or `co_await runOnWorker(fn)`, and may await other
+ * tasks. Tasks started with `App::startTask()` are resumed on the main thread
+ * after `update()`, within a per-frame time slice, so work like loading or
+ * procedural generation can be spread across frames without hitches.
+ *
+ * @code
+ * pxr::Task fadeIn(float &alpha) {
+ *     while (alpha < 1.0f) {
+ *         alpha += 0.05f;
+ *         co_await pxr::nextFrame();
+ *     }
+ * }
+ * @endcode
+ */
+
+namespace pxr {
+
+	class TaskScheduler;
+
+	namespace detail {
+
+		/// Allocates a coroutine frame from the calling thread's pool.
+		void *allocateTaskFrame(std::size_t size);
+
+		/// Returns a coroutine frame to the calling thread's pool.
+		void freeTaskFrame(void *frame, std::size_t size) noexcept;
+
+		/// Resumes a coroutine in the next frame.
+		void scheduleNextFrame(TaskScheduler &scheduler, std::coroutine_handle<> handle);
+
+		/// Resumes a coroutine once the given time has passed.
+		void scheduleAfter(TaskScheduler &scheduler, float seconds, std::coroutine_handle<> handle);
+
+		/// Runs a job on a worker thread, then resumes a coroutine on the main thread.
+		void scheduleOnWorker(TaskScheduler &scheduler, std::function<void()> job, std::coroutine_handle<> handle);
+
+	} // namespace detail
+
+	/**
+	 * @brief A coroutine scheduled by the app's frame loop.
+	 *
+	 * A task does nothing until it is started with `App::startTask()` or awaited
+	 * by a running task. Awaiting a task runs it to completion and rethrows any
+	 * exception it raised; an exception escaping a started task propagates out
+	 * of `App::run()`. Coroutine frames come from a pooled allocator, so
+	 * starting short tasks every frame does not hit the general-purpose heap.
+	 */
+	class [[nodiscard]] Task {
+	public:
+		/**
+		 * @brief Coroutine promise; not used directly.
+		 */
+		struct promise_type {
+			std::coroutine_handle<> continuation; ///< Task awaiting this one, if any.
+			TaskScheduler *scheduler = nullptr; ///< Scheduler resuming the task.
+			std::exception_ptr error; ///< Exception that ended the task.
+
+			Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+			std::suspend_always initial_suspend() noexcept { return {}; }
+
+			auto final_suspend() noexcept {
+				/// Hands control back to the awaiting task, or to the scheduler.
+				struct FinalAwaiter {
+					bool await_ready() noexcept { return false; }
+
+					std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+						const auto continuation = handle.promise().continuation;
+						return continuation ? continuation : std::noop_coroutine();
+					}
+
+					void await_resume() noexcept {}
+				};
+				return FinalAwaiter{};
+			}
+
+			void return_void() {}
+
+			void unhandled_exception() { error = std::current_exception(); }
+
+			static void *operator new(std::size_t size) { return detail::allocateTaskFrame(size); }
+
+			static void operator delete(void *frame, std::size_t size) noexcept { detail::freeTaskFrame(frame, size); }
+		};
+
+		Task(Task &&other) noexcept : handle(std::exchange(other.handle, {})) {}
+
+		Task &operator=(Task &&other) noexcept {
+			if (this != &other) {
+				if (handle) {
+					handle.destroy();
+				}
+				handle = std::exchange(other.handle, {});
+			}
+			return *this;
+		}
+
+		Task(const Task &) = delete;
+		Task &operator=(const Task &) = delete;
+
+		/**
+		 * @brief Destroys the coroutine if it is still owned by this object.
+		 */
+		~Task() {
+			if (handle) {
+				handle.destroy();
+			}
+		}
+
+		/**
+		 * @brief Returns true if the coroutine ran to completion.
+		 */
+		[[nodiscard]] bool isDone() const { return !handle || handle.done(); }
+
+		// Awaiting a task runs it as a child of the awaiting task.
+
+		bool await_ready() const noexcept { return isDone(); }
+
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> parent) noexcept {
+			handle.promise().continuation = parent;
+			handle.promise().scheduler = parent.promise().scheduler;
+			return handle;
+		}
+
+		void await_resume() const {
+			if (handle && handle.promise().error) {
+				std::rethrow_exception(handle.promise().error);
+			}
+		}
+
+	private:
+		friend class TaskScheduler;
+
+		explicit Task(std::coroutine_handle<promise_type> h) : handle(h) {}
+
+		std::coroutine_handle<promise_type> handle; ///< Owned coroutine.
+	};
+
+	//--------------------------------------------------------------------------
+	// Awaitables
+	//--------------------------------------------------------------------------
+
+	/**
+	 * @brief Awaitable returned by nextFrame().
+	 */
+	struct NextFrameAwaiter {
+		bool await_ready() const noexcept { return false; }
+
+		void await_suspend(std::coroutine_handle<Task::promise_type> handle) const {
+			detail::scheduleNextFrame(*handle.promise().scheduler, handle);
+		}
+
+		void await_resume() const noexcept {}
+	};
+
+	/**
+	 * @brief Awaitable returned by seconds().
+	 */
+	struct SecondsAwaiter {
+		float duration; ///< Time to wait in seconds.
+
+		bool await_ready() const noexcept { return duration <= 0.0f; }
+
+		void await_suspend(std::coroutine_handle<Task::promise_type> handle) const {
+			detail::scheduleAfter(*handle.promise().scheduler, duration, handle);
+		}
+
+		void await_resume() const noexcept {}
+	};
+
+	/**
+	 * @brief Awaitable returned by runOnWorker().
+	 */
+	template<typename Function>
+	class WorkerAwaiter {
+	public:
+		using Result = std::invoke_result_t<Function &>;
+
+		explicit WorkerAwaiter(Function f) : function(std::move(f)) {}
+
+		bool await_ready() const noexcept { return false; }
+
+		void await_suspend(std::coroutine_handle<Task::promise_type> handle) {
+			detail::scheduleOnWorker(
+					*handle.promise().scheduler,
+					[this] {
+						try {
+							if constexpr (std::is_void_v<Result>) {
+								function();
+							} else {
+								result.emplace(function());
+							}
+						} catch (...) {
+							error = std::current_exception();
+						}
+					},
+					handle);
+		}
+
+		Result await_resume() {
+			if (error) {
+				std::rethrow_exception(error);
+			}
+			if constexpr (!std::is_void_v<Result>) {
+				return std::move(*result);
+			}
+		}
+
+	private:
+		Function function; ///< Work to run off the main thread.
+		std::optional<std::conditional_t<std::is_void_v<Result>, std::monostate, Result>> result; ///< Its value.
+		std::exception_ptr error; ///< Exception thrown by the work.
+	};
+
+	/**
+	 * @brief Suspends the calling task until the next frame.
+	 */
+	inline NextFrameAwaiter nextFrame() { return {}; }
+
+	/**
+	 * @brief Suspends the calling task for a duration of app time.
+	 *
+	 * App time advances by `getDeltaTime()` every frame.
+	 *
+	 * @param duration Seconds to wait; zero or less resumes immediately.
+	 */
+	inline SecondsAwaiter seconds(float duration) { return SecondsAwaiter{duration}; }
+
+	/**
+	 * @brief Runs a function on a worker thread and resumes the task on the main thread.
+	 *
+	 * The function must not touch the app or its surfaces; pass results back as
+	 * its return value, which becomes the result of the `co_await` expression.
+	 *
+	 * @param function Callable taking no arguments.
+	 */
+	template<typename Function>
+	WorkerAwaiter<std::decay_t<Function>> runOnWorker(Function &&function) {
+		return WorkerAwaiter<std::decay_t<Function>>(std::forward<Function>(function));
+	}
+
+} // namespace pxr
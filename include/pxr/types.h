@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 namespace pxr {
 
 	/**
@@ -19,4 +21,58 @@ namespace pxr {
 		int height;
 	};
 
+	/**
+	 * @brief Represents an axis-aligned integer rectangle.
+	 *
+	 * A rectangle with a non-positive width or height is considered empty.
+	 */
+	struct Rect {
+		int x = 0;
+		int y = 0;
+		int width = 0;
+		int height = 0;
+
+		/// @brief Returns true if the rectangle covers no pixels.
+		[[nodiscard]] constexpr bool isEmpty() const { return width <= 0 || height <= 0; }
+
+		/// @brief Returns the exclusive right edge (x + width).
+		[[nodiscard]] constexpr int right() const { return x + width; }
+
+		/// @brief Returns the exclusive bottom edge (y + height).
+		[[nodiscard]] constexpr int bottom() const { return y + height; }
+
+		/// @brief Returns the number of pixels covered by the rectangle.
+		[[nodiscard]] constexpr long long area() const {
+			return isEmpty() ? 0 : static_cast<long long>(width) * height;
+		}
+
+		/// @brief Returns the bounding box of this rectangle and another one.
+		[[nodiscard]] constexpr Rect united(const Rect &other) const {
+			if (isEmpty())
+				return other;
+			if (other.isEmpty())
+				return *this;
+			const int left = std::min(x, other.x);
+			const int top = std::min(y, other.y);
+			return Rect{left, top, std::max(right(), other.right()) - left, std::max(bottom(), other.bottom()) - top};
+		}
+
+		/// @brief Returns the overlapping area of this rectangle and another one (empty if disjoint).
+		[[nodiscard]] constexpr Rect intersected(const Rect &other) const {
+			const int left = std::max(x, other.x);
+			const int top = std::max(y, other.y);
+			const int r = std::min(right(), other.right());
+			const int b = std::min(bottom(), other.bottom());
+			if (r <= left || b <= top)
+				return Rect{};
+			return Rect{left, top, r - left, b - top};
+		}
+
+		/// @brief Returns this rectangle moved by (dx, dy).
+		[[nodiscard]] constexpr Rect translated(int dx, int dy) const { return Rect{x + dx, y + dy, width, height}; }
+
+		/// @brief Equality operator.
+		[[nodiscard]] constexpr bool operator==(const Rect &other) const = default;
+	};
+
 } // namespace pxr
@@ -0,0 +1,208 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "layer.h"
+#include "yuv.h"
+
+/**
+ * @file video_player.h
+ * @brief Plays uncompressed Y4M video into a Layer.
+ *
+ * A background thread reads frames ahead into a small ring, interleaving their
+ * chroma into NV12, so the frame loop only hands a finished frame to
+ * Layer::presentNv12(). With OpenGL a shader converts it to RGB; other
+ * backends convert it on the CPU with yuv::toSurface(). Files
+ * of 32 MiB and more are memory-mapped for sequential access on POSIX
+ * systems; smaller ones (and every file on Windows) are read with plain reads.
+ * Only 4:2:0 chroma (the `C420`, `C420jpeg`, `C420paldv` and `C420mpeg2`
+ * tags, or none) is supported.
+ */
+
+namespace pxr {
+
+	/**
+	 * @brief Streams a Y4M file in step with the frame loop.
+	 *
+	 * Call update() once per frame with `App::getDeltaTime()`. When playback
+	 * falls behind, late frames are skipped, unconverted if they were not read
+	 * yet, so the video keeps its speed instead of slowing down.
+	 *
+	 * @code
+	 * void setup() override {
+	 *     video = std::make_unique<pxr::VideoPlayer>("clip.y4m");
+	 *     background = &createLayer(video->getWidth(), video->getHeight(), -1);
+	 * }
+	 * void update() override { video->update(getDeltaTime(), *background); }
+	 * @endcode
+	 */
+	class VideoPlayer {
+	public:
+		/**
+		 * @brief Opens a file, reads its header and starts reading ahead.
+		 * @param path Y4M file to play.
+		 * @param ringSize Number of frames kept ahead of playback, at least 2.
+		 */
+		explicit VideoPlayer(const std::string &path, int ringSize = 4);
+
+		/**
+		 * @brief Stops the reader thread and closes the file.
+		 */
+		~VideoPlayer();
+
+		VideoPlayer(const VideoPlayer &) = delete;
+		VideoPlayer &operator=(const VideoPlayer &) = delete;
+
+		/**
+		 * @brief Returns the frame width in pixels.
+		 */
+		[[nodiscard]] int getWidth() const;
+
+		/**
+		 * @brief Returns the frame height in pixels.
+		 */
+		[[nodiscard]] int getHeight() const;
+
+		/**
+		 * @brief Returns the frames per second given by the file.
+		 */
+		[[nodiscard]] double getFrameRate() const;
+
+		/**
+		 * @brief Restarts from the first frame at the end of the file instead of finishing.
+		 * @param enabled True to loop; false (the default) to stop after the last frame.
+		 */
+		void setLooping(bool enabled);
+
+		/**
+		 * @brief Sets the color space of frames read from now on.
+		 *
+		 * The default is limited range, or full range if the header says
+		 * `XCOLORRANGE=FULL`, with BT.709 for frames at least 720 pixels high
+		 * and BT.601 for smaller ones, the usual guess of players.
+		 *
+		 * @param space Color space the file was encoded in.
+		 */
+		void setColorSpace(YuvColorSpace space);
+
+		/**
+		 * @brief Advances playback and shows the frame that is due.
+		 *
+		 * The frame is passed to Layer::presentNv12() of the target, which shows
+		 * it instead of its surface pixels from then on.
+		 *
+		 * @param deltaTime Seconds since the previous call, normally `App::getDeltaTime()`.
+		 * @param target Layer of the video's size.
+		 * @return True if a new frame was shown.
+		 */
+		bool update(float deltaTime, Layer &target);
+
+		/**
+		 * @brief Returns the playback position in seconds, counted from the first update().
+		 */
+		[[nodiscard]] double getPosition() const;
+
+		/**
+		 * @brief Returns true once the last frame was shown; never while looping.
+		 */
+		[[nodiscard]] bool isFinished() const;
+
+		/**
+		 * @brief Returns the number of frames shown.
+		 */
+		[[nodiscard]] uint64_t getShownFrames() const;
+
+		/**
+		 * @brief Returns the number of frames skipped because they were late.
+		 */
+		[[nodiscard]] uint64_t getDroppedFrames() const;
+
+		/**
+		 * @brief Returns the number of frame bytes read from the file so far.
+		 */
+		[[nodiscard]] uint64_t getBytesRead() const;
+
+	private:
+		/**
+		 * @brief A frame waiting in the ring.
+		 */
+		struct Slot {
+			std::vector<uint8_t> frame; ///< NV12 planes, tightly packed.
+			YuvColorSpace space; ///< Color space the frame was read with.
+			uint64_t index = 0; ///< Position in the playback timeline; keeps counting across loops.
+		};
+
+		/**
+		 * @brief Maps the file, or opens it for reading when mapping does not apply.
+		 */
+		void openFile(const std::string &path);
+
+		/**
+		 * @brief Parses the stream header and finds the first frame.
+		 */
+		void readHeader();
+
+		/**
+		 * @brief Reads a line ending in a newline and moves offset past it.
+		 * @return False at the end of the file or if no newline follows soon enough.
+		 */
+		bool readLine(size_t &offset, std::string &line);
+
+		/**
+		 * @brief Returns count bytes of the file at offset, or nullptr if the file ends first.
+		 *
+		 * Points into the mapping, or into the staging buffer until the next call.
+		 */
+		const uint8_t *readBytes(size_t offset, size_t count);
+
+		/**
+		 * @brief Reads, skips and interleaves frames ahead of playback until stopped or at the end.
+		 */
+		void readLoop();
+
+		int width = 0; ///< Frame width in pixels.
+		int height = 0; ///< Frame height in pixels.
+		double frameRate = 0.0; ///< Frames per second.
+		size_t frameBytes = 0; ///< Size of the planes of one frame.
+		size_t firstFrame = 0; ///< Offset of the first frame header.
+		size_t fileSize = 0; ///< Size of the file in bytes.
+		const uint8_t *mapping = nullptr; ///< Whole file, if mapped.
+		std::ifstream file; ///< Open file, if not mapped; used by the reader thread only.
+		std::vector<uint8_t> staging; ///< Frame read from file; reader thread only.
+
+		double position = 0.0; ///< Playback time in seconds.
+		uint64_t shownFrames = 0; ///< Frames shown by update().
+		std::atomic<uint64_t> dueFrame{0}; ///< Timeline index of the frame to show now; older ones are late.
+		std::atomic<uint64_t> droppedFrames{0}; ///< Late frames skipped by either thread.
+		std::atomic<uint64_t> bytesRead{0}; ///< Frame bytes read by the reader thread.
+
+		mutable std::mutex mutex; ///< Guards the ring and the members below.
+		std::condition_variable slotFreed; ///< Signals a free slot or shutdown to the reader.
+		std::vector<Slot> ring; ///< Frames read ahead, in timeline order.
+		size_t head = 0; ///< Oldest slot.
+		size_t count = 0; ///< Slots holding frames.
+		YuvColorSpace colorSpace; ///< Space of the frames read next.
+		bool looping = false; ///< Whether the reader wraps at the end.
+		bool endOfStream = false; ///< Set when the reader reached the end without looping.
+		bool stopping = false; ///< Set by the destructor.
+
+		std::thread reader; ///< Runs readLoop(); started last, joined first.
+	};
+
+} // namespace pxr
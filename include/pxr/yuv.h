@@ -0,0 +1,119 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file yuv.h
+ * @brief Conversions between Surface pixels and 4:2:0 YUV, the layout of video decoders and encoders.
+ *
+ * Luma keeps full resolution; each chroma sample covers a 2x2 block, so a
+ * frame takes 1.5 bytes per pixel instead of 4. Converting to YUV averages
+ * each block; converting back repeats each sample over its block. Both
+ * directions use the SIMD kernels and split large images into bands of rows
+ * run on worker threads. Alpha is dropped, and YUV reads as opaque.
+ *
+ * To display frames, pass NV12 planes to Layer::presentNv12(): with OpenGL a
+ * shader converts them, otherwise they go through toSurface().
+ */
+
+namespace pxr {
+
+	class Surface;
+
+	/**
+	 * @brief Arrangement of the chroma planes.
+	 */
+	enum class YuvLayout : uint8_t {
+		I420, ///< Separate U and V planes, as written by most software codecs.
+		Nv12, ///< One plane of interleaved U, V pairs, as written by most hardware decoders.
+	};
+
+	/**
+	 * @brief Weights of red, green and blue in luma.
+	 */
+	enum class YuvMatrix : uint8_t {
+		Bt601, ///< ITU-R BT.601, standard-definition video.
+		Bt709, ///< ITU-R BT.709, HD video.
+	};
+
+	/**
+	 * @brief Range of the encoded values.
+	 */
+	enum class YuvRange : uint8_t {
+		Limited, ///< Luma from 16 to 235 and chroma from 16 to 240, the usual range of video.
+		Full, ///< Every value from 0 to 255, as in JPEG.
+	};
+
+	/**
+	 * @brief Matrix and range together; must match how the video was encoded.
+	 */
+	struct YuvColorSpace {
+		YuvMatrix matrix = YuvMatrix::Bt601; ///< Weights of the color channels.
+		YuvRange range = YuvRange::Limited; ///< Range of the values.
+	};
+
+	/**
+	 * @brief Planes of a 4:2:0 image. Chroma planes are (width + 1) / 2 by (height + 1) / 2 samples.
+	 *
+	 * The planes are not owned; see yuv::wrapBuffer() for one tightly packed buffer.
+	 */
+	struct YuvPlanes {
+		YuvLayout layout = YuvLayout::I420; ///< Arrangement of the chroma planes.
+		int width = 0; ///< Width of the image in pixels.
+		int height = 0; ///< Height of the image in pixels.
+		uint8_t *y = nullptr; ///< Luma plane.
+		size_t yStride = 0; ///< Distance between luma rows in bytes.
+		uint8_t *u = nullptr; ///< U plane, or the interleaved UV plane for Nv12.
+		size_t uStride = 0; ///< Distance between rows of u in bytes.
+		uint8_t *v = nullptr; ///< V plane; unused for Nv12.
+		size_t vStride = 0; ///< Distance between rows of v in bytes.
+	};
+
+	namespace yuv {
+
+		/**
+		 * @brief Returns the size of a tightly packed image in bytes, the same for both layouts.
+		 */
+		[[nodiscard]] size_t getBufferSize(int width, int height);
+
+		/**
+		 * @brief Describes the planes of a tightly packed image, as stored in Y4M files and by most decoders.
+		 *
+		 * The luma plane comes first, then the U and V planes, or the UV plane.
+		 *
+		 * @param layout Arrangement of the chroma planes.
+		 * @param buffer Start of the image; at least getBufferSize() bytes.
+		 * @param width Width of the image in pixels.
+		 * @param height Height of the image in pixels.
+		 */
+		[[nodiscard]] YuvPlanes wrapBuffer(YuvLayout layout, uint8_t *buffer, int width, int height);
+
+		/**
+		 * @brief Converts a surface to YUV.
+		 * @param src Source pixels; must have the size of dst.
+		 * @param dst Planes to write.
+		 * @param space Color space to encode in.
+		 */
+		void fromSurface(const Surface &src, const YuvPlanes &dst, YuvColorSpace space = {});
+
+		/**
+		 * @brief Converts YUV to opaque pixels and marks the surface dirty.
+		 * @param src Planes to read.
+		 * @param dst Destination surface; must have the size of src.
+		 * @param space Color space the planes were encoded in.
+		 */
+		void toSurface(const YuvPlanes &src, Surface &dst, YuvColorSpace space = {});
+
+	} // namespace yuv
+
+} // namespace pxr
@@ -0,0 +1,252 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "pxr/allocations.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include "pxr/profiler.h"
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace pxr {
+
+	namespace {
+
+		/**
+		 * @brief Counters of one zone.
+		 *
+		 * Every member is constant-initialized, so the tables below are ready
+		 * before any constructor runs and allocates.
+		 */
+		struct ZoneCounters {
+			std::atomic<const char *> name{nullptr}; ///< Claimed once, then never changes.
+			std::atomic<uint64_t> count{0};
+			std::atomic<uint64_t> bytes{0};
+		};
+
+		/// Slots of the zone table; a power of two. Apps rarely use more than a few dozen zone names.
+		constexpr size_t ZoneSlots = 256;
+
+		/// Open-addressed by name pointer. The hook cannot allocate, so the table has a fixed size.
+		ZoneCounters zoneTable[ZoneSlots];
+
+		ZoneCounters outsideZones; ///< Allocations made outside every zone.
+		ZoneCounters tableFull; ///< Allocations of zones that found no free slot.
+
+		std::atomic<uint64_t> totalCount{0};
+		std::atomic<uint64_t> totalBytes{0};
+
+		/// Adds a sample to the entry of the same name; a linear scan, like the profiler's.
+		void accumulate(std::vector<AllocationZoneStats> &zones, const AllocationZoneStats &sample) {
+			auto it = std::find_if(zones.begin(), zones.end(), [&sample](const AllocationZoneStats &stats) {
+				return stats.name == sample.name || std::strcmp(stats.name, sample.name) == 0;
+			});
+			if (it == zones.end()) {
+				it = zones.insert(zones.end(), AllocationZoneStats{sample.name});
+			}
+			it->count += sample.count;
+			it->bytes += sample.bytes;
+		}
+
+		AllocationZoneStats readCounters(const ZoneCounters &counters, const char *name) {
+			const uint64_t count = counters.count.load(std::memory_order_relaxed);
+			return {name, count, counters.bytes.load(std::memory_order_relaxed)};
+		}
+
+		void clearCounters(ZoneCounters &counters) {
+			counters.count.store(0, std::memory_order_relaxed);
+			counters.bytes.store(0, std::memory_order_relaxed);
+		}
+
+#ifdef PXR_TRACK_ALLOCATIONS
+		/// Returns the counters of a zone name, claiming a slot for a new one.
+		ZoneCounters &findCounters(const char *name) {
+			if (!name) {
+				return outsideZones;
+			}
+			// Names are mostly string literals, so the pointer identifies the zone; see getZones() for duplicates.
+			const size_t hash = (reinterpret_cast<uintptr_t>(name) >> 3) * 0x9E3779B97F4A7C15ull >> 32;
+			for (size_t probe = 0; probe < ZoneSlots; ++probe) {
+				ZoneCounters &counters = zoneTable[(hash + probe) & (ZoneSlots - 1)];
+				const char *owner = counters.name.load(std::memory_order_acquire);
+				if (!owner && counters.name.compare_exchange_strong(owner, name, std::memory_order_acq_rel)) {
+					return counters;
+				}
+				if (owner == name) {
+					return counters;
+				}
+			}
+			return tableFull;
+		}
+
+		/// Counts one allocation; called by the replaced operator new, so it must not allocate.
+		void recordAllocation(size_t size) {
+			totalCount.fetch_add(1, std::memory_order_relaxed);
+			totalBytes.fetch_add(size, std::memory_order_relaxed);
+			const ProfileZone *zone = ProfileZone::getCurrent();
+			ZoneCounters &counters = findCounters(zone ? zone->getName() : nullptr);
+			counters.count.fetch_add(1, std::memory_order_relaxed);
+			counters.bytes.fetch_add(size, std::memory_order_relaxed);
+		}
+#endif
+
+	} // namespace
+
+	namespace allocations {
+
+		bool isTracking() {
+#ifdef PXR_TRACK_ALLOCATIONS
+			return true;
+#else
+			return false;
+#endif
+		}
+
+		AllocationCounts getTotals() {
+			return {totalCount.load(std::memory_order_relaxed), totalBytes.load(std::memory_order_relaxed)};
+		}
+
+		std::vector<AllocationZoneStats> getZones() {
+			std::vector<AllocationZoneStats> zones;
+			for (const ZoneCounters &counters: zoneTable) {
+				const char *name = counters.name.load(std::memory_order_acquire);
+				if (name && counters.count.load(std::memory_order_relaxed) > 0) {
+					accumulate(zones, readCounters(counters, name));
+				}
+			}
+			for (const AllocationZoneStats &extra:
+				 {readCounters(outsideZones, "(no zone)"), readCounters(tableFull, "(other zones)")}) {
+				if (extra.count > 0) {
+					accumulate(zones, extra);
+				}
+			}
+			return zones;
+		}
+
+		void reset() {
+			for (ZoneCounters &counters: zoneTable) {
+				clearCounters(counters);
+			}
+			clearCounters(outsideZones);
+			clearCounters(tableFull);
+		}
+
+		std::string formatReport() {
+			std::string report = "zone                          allocations       bytes\n";
+			char line[160];
+			for (const AllocationZoneStats &zone: getZones()) {
+				std::snprintf(line, sizeof(line), "%-28s %12llu %11llu\n", zone.name,
+							  static_cast<unsigned long long>(zone.count), static_cast<unsigned long long>(zone.bytes));
+				report += line;
+			}
+			return report;
+		}
+
+	} // namespace allocations
+
+} // namespace pxr
+
+#ifdef PXR_TRACK_ALLOCATIONS
+
+//--------------------------------------------------------------------------
+// Replaced global allocation functions
+//--------------------------------------------------------------------------
+
+namespace {
+
+	/// Allocates like the standard operator new: retries through the new-handler, then throws.
+	void *allocate(std::size_t size, std::size_t alignment) {
+		pxr::recordAllocation(size);
+		size = std::max<std::size_t>(size, 1);
+		while (true) {
+			void *memory = nullptr;
+			if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+				memory = std::malloc(size);
+			} else {
+#ifdef _WIN32
+				memory = _aligned_malloc(size, alignment);
+#else
+				// aligned_alloc() wants a multiple of the alignment.
+				memory = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+			}
+			if (memory) {
+				return memory;
+			}
+			const std::new_handler handler = std::get_new_handler();
+			if (!handler) {
+				throw std::bad_alloc();
+			}
+			handler();
+		}
+	}
+
+	void *allocateNoThrow(std::size_t size, std::size_t alignment) noexcept {
+		try {
+			return allocate(size, alignment);
+		} catch (...) {
+			return nullptr;
+		}
+	}
+
+	void release(void *memory, std::size_t alignment) noexcept {
+#ifdef _WIN32
+		if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+			_aligned_free(memory);
+			return;
+		}
+#else
+		(void) alignment;
+#endif
+		std::free(memory);
+	}
+
+	constexpr std::size_t toSize(std::align_val_t alignment) { return static_cast<std::size_t>(alignment); }
+
+} // namespace
+
+void *operator new(std::size_t size) { return allocate(size, 0); }
+void *operator new[](std::size_t size) { return allocate(size, 0); }
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept { return allocateNoThrow(size, 0); }
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept { return allocateNoThrow(size, 0); }
+void *operator new(std::size_t size, std::align_val_t align) { return allocate(size, toSize(align)); }
+void *operator new[](std::size_t size, std::align_val_t align) { return allocate(size, toSize(align)); }
+void *operator new(std::size_t size, std::align_val_t align, const std::nothrow_t &) noexcept {
+	return allocateNoThrow(size, toSize(align));
+}
+void *operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t &) noexcept {
+	return allocateNoThrow(size, toSize(align));
+}
+
+void operator delete(void *memory) noexcept { release(memory, 0); }
+void operator delete[](void *memory) noexcept { release(memory, 0); }
+void operator delete(void *memory, std::size_t) noexcept { release(memory, 0); }
+void operator delete[](void *memory, std::size_t) noexcept { release(memory, 0); }
+void operator delete(void *memory, const std::nothrow_t &) noexcept { release(memory, 0); }
+void operator delete[](void *memory, const std::nothrow_t &) noexcept { release(memory, 0); }
+void operator delete(void *memory, std::align_val_t align) noexcept { release(memory, toSize(align)); }
+void operator delete[](void *memory, std::align_val_t align) noexcept { release(memory, toSize(align)); }
+void operator delete(void *memory, std::size_t, std::align_val_t align) noexcept { release(memory, toSize(align)); }
+void operator delete[](void *memory, std::size_t, std::align_val_t align) noexcept { release(memory, toSize(align)); }
+void operator delete(void *memory, std::align_val_t align, const std::nothrow_t &) noexcept {
+	release(memory, toSize(align));
+}
+void operator delete[](void *memory, std::align_val_t align, const std::nothrow_t &) noexcept {
+	release(memory, toSize(align));
+}
+
+#endif // PXR_TRACK_ALLOCATIONS
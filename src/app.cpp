@@ -10,16 +10,60 @@
 
 #include "pxr/app.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <future>
 #include <memory>
+#include <string_view>
+#include <utility>
 
+#include "asset_loader.h"
+#include "backend.h"
+#include "command_executor.h"
+#include "compositor.h"
 #include "error_handling.h"
 #include "graphics.h"
 #include "input.h"
-#include "window.h"
+#include "pixel_kernels.h"
+#include "pxr/frame_stream.h"
+#include "pxr/profiler.h"
+#include "pxr/shared_frame.h"
+#include "shared_input.h"
+#include "task_scheduler.h"
+#include "upload_scheduler.h"
 
 namespace pxr {
 
+	namespace {
+
+		/// Minimum spacing of on-demand updates that presented nothing.
+		constexpr auto IdleRedrawInterval = std::chrono::microseconds(16667);
+
+		/// How often an idle on-demand app looks for changed asset files.
+		constexpr auto HotReloadPollInterval = std::chrono::milliseconds(100);
+
+		/// Whether PXR_PROFILE asks for the exit report; unset, empty and "0" leave it off.
+		bool isProfileReportEnabled() {
+			const char *env = std::getenv("PXR_PROFILE");
+			return env && *env && std::string_view(env) != "0";
+		}
+
+	} // namespace
+
+	/**
+	 * @brief A window opened with App::addWindow() and the surface it shows.
+	 */
+	struct ExtraWindow {
+		std::string title; ///< Window title.
+		int pixelSize = 1; ///< Scale from surface pixels to window pixels.
+		std::unique_ptr<Surface> surface; ///< Content drawn by the app; outlives the window.
+		std::unique_ptr<Window> window; ///< Null before run() and once the window was closed.
+		std::unique_ptr<Presenter> presenter; ///< Presenter created for the window.
+	};
+
 	App::App() = default;
 	App::~App() = default;
 
@@ -28,54 +72,291 @@ namespace pxr {
 	//--------------------------------------------------------------------------
 
 	void App::run() {
-		using Clock = std::chrono::steady_clock;
-		auto lastTime = Clock::now();
-		float fpsTimer = 0.0f;
-		int fpsCounter = 0;
+		start();
+		while (runFrame()) {
+		}
+		finish();
+	}
 
-		inSetupPhase = true;
-		setup();
-		inSetupPhase = false;
+	//--------------------------------------------------------------------------
+	// Main Loop
+	//--------------------------------------------------------------------------
+
+	void App::start() {
+		startTime = std::chrono::steady_clock::now();
+		// Batch instances already run in parallel; their commands execute on the calling thread.
+		commands = std::make_unique<CommandExecutor>(headless ? 1 : 0);
+		tasks = std::make_unique<TaskScheduler>(headless ? 1 : 0);
+		assets = std::make_unique<AssetLoader>(headless ? 1 : 0);
+
+		{
+			PXR_PROFILE_ZONE("startup.setup");
+			inSetupPhase = true;
+			setup();
+			inSetupPhase = false;
+		}
 
-		window = std::make_unique<Window>();
+		if (hotReload) {
+			assets->enableHotReload();
+		}
+
+		if (headless) {
+			// Batch instances never show anything and must not sleep between frames.
+			vsyncEnabled = false;
+			onDemandRendering = false;
+		}
+		const Backend &backend = headless ? *BackendRegistry::find("null") : BackendRegistry::select(backendName);
+		window = backend.createWindow();
+		presenter = backend.createPresenter();
 		input = std::make_unique<Input>();
-		graphics = std::make_unique<Graphics>();
-		surface = std::make_unique<Surface>(width, height, backgroundColor);
+		uploads = std::make_unique<UploadScheduler>();
+		uploads->setBudget(uploadBudget);
+
+		// The frame buffers are filled and the shared outputs opened while the window and its context are
+		// created; images requested in setup() are already loading on the asset workers.
+		const auto createBuffers = [this] {
+			PXR_PROFILE_ZONE("startup.buffers");
+			surface = std::make_unique<Surface>(width, height, backgroundColor);
+			if (!sharedFrameName.empty()) {
+				sharedFrames = std::make_unique<SharedFrameWriter>(sharedFrameName, width, height, sharedFrameSlots);
+			}
+			if (!frameStreamPath.empty()) {
+				frameStream = std::make_unique<FrameStreamServer>(frameStreamPath, width, height);
+			}
+		};
+		std::future<void> buffers;
+		if (headless) {
+			createBuffers(); // Batch instances start by the hundred; a thread each would cost more than it saves.
+		} else {
+			buffers = std::async(std::launch::async, createBuffers);
+		}
+
+		{
+			PXR_PROFILE_ZONE("startup.window");
+			window->create(width * pixelSize, height * pixelSize, title, vsyncEnabled);
+		}
+		if (auto source = window->createInputSource(*input)) {
+			input->addSource(std::move(source));
+		}
+		if (!sharedInputName.empty()) {
+			input->addSource(std::make_unique<SharedInputSource>(sharedInputName, sharedInputCapacity));
+		}
+		if (buffers.valid()) {
+			buffers.get(); // Rethrows a failure to open a shared output.
+		}
+		{
+			PXR_PROFILE_ZONE("startup.presenter");
+			presenter->initialize(*window, *surface, pixelSize);
+		}
+		graphics = presenter->getGraphics();
 
-		window->create(surface->getWidth() * pixelSize, surface->getHeight() * pixelSize, title, vsyncEnabled);
-		input->initialize(window->getHandle());
-		graphics->initialize(*surface);
+		openExtraWindows(backend);
+		window->makeCurrent();
+		if (graphics && frameCaptureCallback) {
+			graphics->setReadbackCallback(frameCaptureCallback);
+		}
 
-		while (!shouldExit && !window->shouldClose()) {
-			auto currentTime = Clock::now();
-			std::chrono::duration<float> delta = currentTime - lastTime;
-			deltaTime = delta.count();
-			lastTime = currentTime;
+		lastTime = std::chrono::steady_clock::now();
+	}
 
+	bool App::runFrame() {
+		if (shouldExit || window->shouldClose()) {
+			return false;
+		}
+		if (allocationCheck && frameCount == allocationWarmupFrames) {
+			allocations::reset(); // The report of a failing frame then shows only what came after warm-up.
+		}
+		const AllocationCounts allocationsBefore = allocations::getTotals();
+		closeRequestedWindows();
+		assets->pollChanges();
+		if (onDemandRendering) {
+			if (!waitForRedraw(lastTime)) {
+				return true;
+			}
+		} else {
 			window->pollEvents();
 			input->poll();
+		}
+
+		const auto currentTime = std::chrono::steady_clock::now();
+		const std::chrono::duration<float> delta = currentTime - lastTime;
+		deltaTime = fixedDeltaTime > 0.0f ? fixedDeltaTime : delta.count();
+		lastTime = currentTime;
 
+		{
+			PXR_PROFILE_ZONE("frame.assets");
+			assets->commit(assetCommitBudget);
+		}
+		{
+			PXR_PROFILE_ZONE("frame.update");
 			update();
+		}
+		{
+			PXR_PROFILE_ZONE("frame.tasks");
+			tasks->run(deltaTime, taskTimeSlice);
+		}
+		{
+			PXR_PROFILE_ZONE("frame.commands");
+			commands->execute(*surface);
+		}
 
-			graphics->upload(*surface);
-			graphics->render(pixelSize);
+		// On demand, an update that changed nothing is neither uploaded nor presented.
+		presentedLastUpdate = !onDemandRendering || windowRefreshed || hasFrameChanges();
+		windowRefreshed = false;
+		if (presentedLastUpdate) {
+			PXR_PROFILE_ZONE("frame.present");
+			presentFrame();
+			if (graphics) {
+				graphics->captureFrame(frameCount);
+			} else if (frameCaptureCallback && presentedSurface) {
+				// Without a GPU the presented frame already lives in memory.
+				frameCaptureCallback(*presentedSurface, frameCount);
+			}
 			window->swapBuffers();
+			presentExtraWindows();
+			if (startupTime == 0.0f) {
+				startupTime = std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count();
+			}
+		}
 
-			frameCount++;
-			fpsCounter++;
-			fpsTimer += deltaTime;
+		frameCount++;
+		fpsCounter++;
+		fpsTimer += deltaTime;
+
+		const AllocationCounts allocationsAfter = allocations::getTotals();
+		frameAllocations.count = allocationsAfter.count - allocationsBefore.count;
+		frameAllocations.bytes = allocationsAfter.bytes - allocationsBefore.bytes;
+		if (allocationCheck && frameCount > allocationWarmupFrames && frameAllocations.count > 0) {
+			std::fprintf(stderr, "[Pixel Runtime] Frame %llu made %llu allocations (%llu bytes) after warm-up\n%s",
+						 static_cast<unsigned long long>(frameCount - 1),
+						 static_cast<unsigned long long>(frameAllocations.count),
+						 static_cast<unsigned long long>(frameAllocations.bytes), allocations::formatReport().c_str());
+			PXR_ASSERT(false, "A frame allocated after warm-up; see App::setAllocationCheck().");
+		}
 
-			if (fpsTimer >= 1.0f) {
-				fps = static_cast<float>(fpsCounter) / fpsTimer;
-				fpsCounter = 0;
-				fpsTimer = 0.0f;
-			}
+		if (fpsTimer >= 1.0f) {
+			fps = static_cast<float>(fpsCounter) / fpsTimer;
+			fpsCounter = 0;
+			fpsTimer = 0.0f;
 		}
+		return !shouldExit && !window->shouldClose();
+	}
 
+	void App::finish() {
+		if (!headless && isProfileReportEnabled()) {
+			std::fprintf(stderr, "[Pixel Runtime] First frame after %.2f ms, %s pixel kernels\n%s",
+						 startupTime * 1000.0f, kernels::getKernelPathName(), profiler::formatReport().c_str());
+			if (allocations::isTracking()) {
+				std::fprintf(stderr, "%s", allocations::formatReport().c_str());
+			}
+		}
+		if (graphics) {
+			graphics->pollReadbacks(true);
+		}
+		tasks.reset(); // Joins the task and asset workers before the cleanup hook runs.
+		assets.reset();
 		destroy();
+		sharedFrames.reset();
+		frameStream.reset();
+		input.reset();
+		for (auto &extra: extraWindows) {
+			closeExtraWindow(*extra);
+		}
+		window->makeCurrent();
+		graphics = nullptr;
+		presenter.reset();
 		window->destroy();
 	}
 
+	void App::reloadFrom(App &previous, std::span<const uint8_t> state) {
+		// Everything the old code created goes first, while the old library is still loaded.
+		if (previous.graphics) {
+			previous.graphics->pollReadbacks(true);
+			previous.graphics->setReadbackCallback(nullptr);
+		}
+		previous.tasks.reset();
+		for (auto &extra: previous.extraWindows) {
+			previous.closeExtraWindow(*extra);
+		}
+		previous.window->makeCurrent();
+		if (previous.compositor) {
+			for (Layer *layer: previous.compositor->getDrawOrder()) {
+				if (previous.graphics) {
+					previous.graphics->releaseSurface(layer->getSurface());
+				}
+				previous.uploads->cancel(layer->getSurface());
+			}
+			previous.compositor.reset();
+		}
+
+		// Drawing calls are no-ops without a surface, as during the first setup(), so the kept frame survives.
+		commands = std::move(previous.commands);
+		assets = std::move(previous.assets);
+		tasks = std::make_unique<TaskScheduler>(previous.headless ? 1 : 0);
+		inSetupPhase = true;
+		setup();
+		inSetupPhase = false;
+
+		// Settings that shaped the window and its outputs need a restart to change.
+		width = previous.width;
+		height = previous.height;
+		pixelSize = previous.pixelSize;
+		backendName = previous.backendName;
+		sharedFrameName = previous.sharedFrameName;
+		sharedFrameSlots = previous.sharedFrameSlots;
+		frameStreamPath = previous.frameStreamPath;
+		sharedInputName = previous.sharedInputName;
+		sharedInputCapacity = previous.sharedInputCapacity;
+		headless = previous.headless;
+		reloadable = previous.reloadable;
+		if (headless) {
+			vsyncEnabled = false;
+			onDemandRendering = false;
+		}
+
+		window = std::move(previous.window);
+		presenter = std::move(previous.presenter);
+		graphics = std::exchange(previous.graphics, nullptr);
+		surface = std::move(previous.surface);
+		input = std::move(previous.input);
+		uploads = std::move(previous.uploads);
+		sharedFrames = std::move(previous.sharedFrames);
+		frameStream = std::move(previous.frameStream);
+
+		frameCount = previous.frameCount;
+		deltaTime = previous.deltaTime;
+		fps = previous.fps;
+		fixedDeltaTime = previous.fixedDeltaTime;
+		lastTime = previous.lastTime;
+		fpsTimer = previous.fpsTimer;
+		fpsCounter = previous.fpsCounter;
+		startTime = previous.startTime;
+		startupTime = previous.startupTime;
+		seenInputChanges = previous.seenInputChanges;
+
+		if (title != previous.title) {
+			window->setTitle(title);
+		}
+		if (vsyncEnabled != previous.vsyncEnabled) {
+			window->setVSync(vsyncEnabled);
+		}
+		uploads->setBudget(uploadBudget);
+		if (hotReload) {
+			assets->enableHotReload();
+		}
+		const Backend &backend = headless ? *BackendRegistry::find("null") : BackendRegistry::select(backendName);
+		openExtraWindows(backend);
+		window->makeCurrent();
+		if (graphics && frameCaptureCallback) {
+			graphics->setReadbackCallback(frameCaptureCallback);
+		}
+		// The next frame resends the kept surface to whichever path presents it.
+		presentedSurface = nullptr;
+		gpuCompositedLastFrame = false;
+
+		loadState(state);
+	}
+
 	//--------------------------------------------------------------------------
 	// Lifecycle
 	//--------------------------------------------------------------------------
@@ -84,6 +365,10 @@ namespace pxr {
 		// Optional cleanup hook
 	}
 
+	std::vector<uint8_t> App::saveState() { return {}; }
+
+	void App::loadState(std::span<const uint8_t>) {}
+
 	//--------------------------------------------------------------------------
 	// Setup-Time Configuration
 	//--------------------------------------------------------------------------
@@ -109,12 +394,89 @@ namespace pxr {
 		title = t;
 	}
 
+	void App::setBackend(const std::string &name) {
+		enforceSetupCall("setBackend");
+		backendName = name;
+	}
+
+	void App::setUploadBudget(size_t bytesPerFrame) {
+		enforceSetupCall("setUploadBudget");
+		uploadBudget = bytesPerFrame;
+	}
+
+	void App::setSharedFrameOutput(const std::string &name, int slotCount) {
+		enforceSetupCall("setSharedFrameOutput");
+		sharedFrameName = name;
+		sharedFrameSlots = slotCount;
+	}
+
+	void App::setFrameStreamOutput(const std::string &path) {
+		enforceSetupCall("setFrameStreamOutput");
+		frameStreamPath = path;
+	}
+
+	void App::setSharedInput(const std::string &name, int capacity) {
+		enforceSetupCall("setSharedInput");
+		sharedInputName = name;
+		sharedInputCapacity = capacity;
+	}
+
+	void App::setAllocationCheck(uint64_t warmupFrames) {
+		enforceSetupCall("setAllocationCheck");
+		allocationCheck = true;
+		allocationWarmupFrames = warmupFrames;
+	}
+
+	void App::setGpuCompositing(bool enabled) {
+		enforceSetupCall("setGpuCompositing");
+		gpuCompositing = enabled;
+	}
+
+	void App::setOnDemandRendering(bool enabled) {
+		enforceSetupCall("setOnDemandRendering");
+		onDemandRendering = enabled;
+	}
+
+	void App::setTaskTimeSlice(float seconds) {
+		enforceSetupCall("setTaskTimeSlice");
+		taskTimeSlice = seconds;
+	}
+
+	void App::setAssetCommitBudget(size_t bytesPerFrame) {
+		enforceSetupCall("setAssetCommitBudget");
+		assetCommitBudget = bytesPerFrame;
+	}
+
+	void App::setHotReload(bool enabled) {
+		enforceSetupCall("setHotReload");
+		hotReload = enabled;
+	}
+
+	//--------------------------------------------------------------------------
+	// Frame Capture
+	//--------------------------------------------------------------------------
+
+	void App::setFrameCaptureCallback(FrameCaptureCallback callback) {
+		frameCaptureCallback = std::move(callback);
+		if (graphics) {
+			graphics->setReadbackCallback(frameCaptureCallback);
+		}
+	}
+
 	//--------------------------------------------------------------------------
 	// App Control
 	//--------------------------------------------------------------------------
 
 	void App::exit() { shouldExit = true; }
 
+	void App::requestRedraw() { nextRedraw = std::min(nextRedraw, std::chrono::steady_clock::now()); }
+
+	void App::requestRedrawIn(float seconds) {
+		const auto delay = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+				std::chrono::duration<float>(std::max(seconds, 0.0f)));
+		nextRedraw = std::min(nextRedraw, std::chrono::steady_clock::now() + delay);
+	}
+
 	bool App::isRunning() const { return !shouldExit && !window->shouldClose(); }
 
 	bool App::isInSetupPhase() const { return inSetupPhase; }
@@ -168,6 +530,77 @@ namespace pxr {
 		}
 	}
 
+	CommandBuffer &App::getCommandBuffer() {
+		PXR_ASSERT(commands != nullptr, "getCommandBuffer() is only available once the app runs.");
+		return commands->getThreadBuffer();
+	}
+
+	//--------------------------------------------------------------------------
+	// Layers
+	//--------------------------------------------------------------------------
+
+	Layer &App::createLayer(int w, int h, int zOrder) {
+		if (!compositor) {
+			compositor = std::make_unique<Compositor>();
+		}
+		return compositor->createLayer(w, h, zOrder);
+	}
+
+	void App::removeLayer(Layer &layer) {
+		PXR_ASSERT(compositor != nullptr, "removeLayer() called before any layer was created.");
+		if (graphics) {
+			graphics->releaseSurface(layer.getSurface());
+		}
+		if (uploads) {
+			uploads->cancel(layer.getSurface());
+		}
+		compositor->removeLayer(layer);
+	}
+
+	//--------------------------------------------------------------------------
+	// Extra Windows
+	//--------------------------------------------------------------------------
+
+	Surface &App::addWindow(const std::string &windowTitle, int windowWidth, int windowHeight, int windowPixelSize) {
+		enforceSetupCall("addWindow");
+		PXR_ASSERT(windowWidth > 0 && windowHeight > 0 && windowPixelSize > 0, "Window dimensions must be positive.");
+
+		auto extra = std::make_unique<ExtraWindow>();
+		extra->title = windowTitle;
+		extra->pixelSize = windowPixelSize;
+		extra->surface = std::make_unique<Surface>(windowWidth, windowHeight, backgroundColor);
+		extraWindows.push_back(std::move(extra));
+		return *extraWindows.back()->surface;
+	}
+
+	bool App::isWindowOpen(const Surface &windowSurface) const {
+		return std::ranges::any_of(extraWindows, [&](const auto &extra) {
+			return extra->surface.get() == &windowSurface && extra->window != nullptr;
+		});
+	}
+
+	//--------------------------------------------------------------------------
+	// Tasks
+	//--------------------------------------------------------------------------
+
+	void App::startTask(Task task) {
+		PXR_ASSERT(tasks != nullptr, "startTask() is only available once the app runs.");
+		tasks->start(std::move(task));
+	}
+
+	size_t App::getTaskCount() const { return tasks ? tasks->getTaskCount() : 0; }
+
+	//--------------------------------------------------------------------------
+	// Assets
+	//--------------------------------------------------------------------------
+
+	ImageHandle App::loadImage(const std::string &path) {
+		PXR_ASSERT(assets != nullptr, "loadImage() is only available once the app runs.");
+		return assets->load(path);
+	}
+
+	size_t App::getPendingAssetCount() const { return assets ? assets->getPendingCount() : 0; }
+
 	//--------------------------------------------------------------------------
 	// Input Handling
 	//--------------------------------------------------------------------------
@@ -194,6 +627,10 @@ namespace pxr {
 
 	float App::getDeltaTime() const { return deltaTime; }
 
+	float App::getStartupTime() const { return startupTime; }
+
+	AllocationCounts App::getFrameAllocations() const { return frameAllocations; }
+
 	//--------------------------------------------------------------------------
 	// Internal Helpers
 	//--------------------------------------------------------------------------
@@ -202,4 +639,302 @@ namespace pxr {
 		PXR_ASSERT(inSetupPhase, (std::string(funcName) + " must be called inside setup()").c_str());
 	}
 
+	bool App::waitForRedraw(std::chrono::steady_clock::time_point lastUpdate) {
+		using Clock = std::chrono::steady_clock;
+		constexpr Clock::time_point Never = Clock::time_point::max();
+
+		Clock::time_point redrawAt = nextRedraw;
+		if (const auto wait = tasks->getSecondsUntilResume()) {
+			// Task time advances by the delta of the next update, which is measured from the last one.
+			const auto delay = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(*wait));
+			redrawAt = std::min(redrawAt, lastUpdate + delay);
+		}
+		if (const auto wait = presenter->getSecondsUntilFlush()) {
+			// Output held back by the presenter's rate cap goes out with a present, not with the next change.
+			const auto delay = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(*wait));
+			redrawAt = std::min(redrawAt, Clock::now() + delay);
+		}
+		if (assets->hasCompletions()) {
+			redrawAt = std::min(redrawAt, lastUpdate);
+		} else if (assets->getPendingCount() > 0) {
+			// Loads finish on other threads, which cannot wake a sleeping window; poll for them instead.
+			redrawAt = std::min(redrawAt, lastUpdate + IdleRedrawInterval);
+		}
+		if (!presentedLastUpdate && redrawAt != Never) {
+			// Nothing paces updates that draw nothing; keep redraw requests from spinning the CPU.
+			redrawAt = std::max(redrawAt, lastUpdate + IdleRedrawInterval);
+		}
+
+		const auto now = Clock::now();
+		Clock::time_point wakeUp = redrawAt;
+		if (!sharedInputName.empty()) {
+			// Injected input cannot wake the window system; look for it at frame rate instead.
+			wakeUp = std::min(wakeUp, now + IdleRedrawInterval);
+		}
+		if (hotReload || reloadable) {
+			// File changes cannot wake the window system either; look for them between frames.
+			wakeUp = std::min(wakeUp, now + HotReloadPollInterval);
+		}
+		if (wakeUp == Never) {
+			window->waitEvents(-1.0);
+		} else if (wakeUp > now) {
+			window->waitEvents(std::chrono::duration<double>(wakeUp - now).count());
+		} else {
+			window->pollEvents();
+		}
+		input->poll();
+
+		const uint64_t changes = input->getChangeCount();
+		const bool inputChanged = changes != seenInputChanges;
+		seenInputChanges = changes;
+		const uint64_t refreshes = window->getRefreshCount();
+		windowRefreshed = windowRefreshed || refreshes != seenWindowRefreshes;
+		seenWindowRefreshes = refreshes;
+		if (!inputChanged && !windowRefreshed && Clock::now() < redrawAt) {
+			return false;
+		}
+		nextRedraw = Never;
+		return true;
+	}
+
+	bool App::hasFrameChanges() const {
+		if (!surface->getDirtyRect().isEmpty() || !uploads->isIdle() || presenter->getSecondsUntilFlush().has_value()) {
+			return true;
+		}
+		for (const auto &extra: extraWindows) {
+			if (extra->window && !extra->surface->getDirtyRect().isEmpty()) {
+				return true;
+			}
+		}
+		if (compositor && compositor->hasLayers()) {
+			return compositor->hasDamage();
+		}
+		// Without layers, the bare surface must be presented again once after the last layer is removed.
+		return presentedSurface != surface.get();
+	}
+
+	void App::resetUploads() {
+		uploads->clear();
+		for (auto &extra: extraWindows) {
+			extra->surface->markDirty();
+		}
+	}
+
+	void App::enqueueExtraWindows() {
+		// One scheduler and budget for every window; all uploads run in the main window's context.
+		for (auto &extra: extraWindows) {
+			if (extra->window) {
+				uploads->enqueue(*extra->surface, extra->surface->getDirtyRect(), UploadPriority::Visible);
+				extra->surface->clearDirty();
+			}
+		}
+	}
+
+	void App::presentExtraWindows() {
+		if (extraWindows.empty()) {
+			return;
+		}
+		for (auto &extra: extraWindows) {
+			if (!extra->window) {
+				continue;
+			}
+			extra->window->makeCurrent();
+			extra->presenter->present();
+			extra->window->swapBuffers();
+		}
+		window->makeCurrent();
+	}
+
+	void App::closeRequestedWindows() {
+		bool closed = false;
+		for (auto &extra: extraWindows) {
+			if (extra->window && extra->window->shouldClose()) {
+				closeExtraWindow(*extra);
+				closed = true;
+			}
+		}
+		if (closed) {
+			window->makeCurrent();
+		}
+	}
+
+	void App::openExtraWindows(const Backend &backend) {
+		PXR_ASSERT(extraWindows.empty() || backend.multipleWindows, "The selected backend shows a single window.");
+		for (auto &extra: extraWindows) {
+			extra->window = backend.createWindow();
+			extra->presenter = backend.createPresenter();
+			// Only the main window waits for vsync; otherwise every extra window would add a frame of latency.
+			extra->window->create(extra->surface->getWidth() * extra->pixelSize,
+								  extra->surface->getHeight() * extra->pixelSize, extra->title, false);
+			extra->presenter->initialize(*extra->window, *extra->surface, extra->pixelSize);
+			extra->surface->markDirty();
+		}
+	}
+
+	void App::closeExtraWindow(ExtraWindow &extra) {
+		if (!extra.window) {
+			return;
+		}
+		uploads->cancel(*extra.surface);
+		extra.window->makeCurrent();
+		extra.presenter.reset();
+		extra.window->destroy();
+		extra.window.reset();
+	}
+
+	void App::presentFrame() {
+		// Layer textures and the presented texture are filled through the same scheduler.
+		const auto uploadFn = [this](const Surface &src, const Rect &rect) {
+			for (const auto &extra: extraWindows) {
+				if (extra->surface.get() == &src) {
+					extra->presenter->upload(src, rect);
+					return;
+				}
+			}
+			if (gpuCompositedLastFrame) {
+				graphics->uploadSurfaceRect(src, rect);
+			} else {
+				presenter->upload(src, rect);
+			}
+		};
+
+		static const std::vector<Layer *> noLayers;
+		const bool hasLayers = compositor && compositor->hasLayers();
+		const auto &layers = hasLayers ? compositor->getDrawOrder() : noLayers;
+
+		// Shared-memory and stream output need the flattened frame on the CPU, so they disable GPU compositing.
+		const auto visibleLayers = std::ranges::count_if(layers, &Layer::isVisible);
+		const bool useGpu = hasLayers && graphics && gpuCompositing && !sharedFrames && !frameStream &&
+							visibleLayers + 1 <= graphics->getMaxLayers();
+
+		if (!useGpu) {
+			if (hasLayers && gpuCompositedLastFrame) {
+				// Layer damage was consumed by the GPU path; rebuild the CPU composite from scratch.
+				compositor->invalidate();
+			}
+			for (Layer *layer: layers) {
+				if (layer->isVisible()) {
+					layer->resolveNv12();
+				}
+			}
+			Surface &frame = hasLayers ? compositor->composite(*surface) : *surface;
+			if (&frame != presentedSurface) {
+				// Switching sources (GPU compositing, CPU compositing or none): resend everything.
+				resetUploads();
+				frame.markDirty();
+				presentedSurface = &frame;
+				gpuCompositedLastFrame = false;
+			}
+
+			const Rect damage = frame.getDirtyRect();
+			if (sharedFrames) {
+				sharedFrames->publish(frame, damage, frameCount);
+			}
+			if (frameStream) {
+				frameStream->publish(frame, damage, frameCount);
+			}
+			uploads->enqueue(frame, damage, UploadPriority::Visible);
+			frame.clearDirty();
+			enqueueExtraWindows();
+			uploads->process(uploadFn);
+			if (graphics && !extraWindows.empty()) {
+				graphics->fenceUploads();
+			}
+			presenter->present();
+			return;
+		}
+
+		if (!gpuCompositedLastFrame) {
+			// Pending uploads target the presented texture; start over with layer textures.
+			resetUploads();
+			gpuCompositedLastFrame = true;
+			presentedSurface = nullptr;
+		}
+
+		graphics->clearLayers();
+		if (graphics->ensureSurfaceTexture(*surface)) {
+			surface->markDirty();
+		}
+		uploads->enqueue(*surface, surface->getDirtyRect(), UploadPriority::Visible);
+		surface->clearDirty();
+		graphics->addLayer(LayerDraw{surface.get(), 0, 0, 1, 1.0f, BlendMode::Replace});
+
+		for (Layer *layer: layers) {
+			Surface &layerSurface = layer->getSurface();
+			if (layer->showsNv12()) {
+				presentLayerNv12(*layer);
+			} else {
+				if (graphics->ensureSurfaceTexture(layerSurface)) {
+					layerSurface.markDirty();
+				}
+				enqueueLayerUpload(*layer);
+			}
+			layer->clearDamage();
+
+			if (layer->isVisible()) {
+				graphics->addLayer(LayerDraw{&layerSurface, layer->getOffsetX(), layer->getOffsetY(), layer->getScale(),
+											 layer->getOpacity(), layer->getBlendMode()});
+			}
+		}
+
+		compositor->clearRemovedDamage();
+		enqueueExtraWindows();
+		uploads->process(uploadFn);
+		if (!extraWindows.empty()) {
+			graphics->fenceUploads();
+		}
+		graphics->renderLayers();
+	}
+
+	void App::presentLayerNv12(Layer &layer) {
+		const Surface &src = layer.getSurface();
+		YuvPlanes planes;
+		YuvColorSpace space;
+		if (layer.isVisible() && layer.takeNv12Frame(planes, space)) {
+			// The frame replaces whatever surface pixels were still queued for the texture.
+			uploads->cancel(src);
+			graphics->uploadSurfaceNv12(src, planes, space);
+		} else if (graphics->ensureSurfaceTexture(src)) {
+			// New texture without a new frame: send the last one converted on the CPU.
+			layer.resolveNv12();
+			uploads->enqueue(src, Rect{0, 0, src.getWidth(), src.getHeight()}, UploadPriority::Visible);
+		}
+	}
+
+	void App::enqueueLayerUpload(const Layer &layer) {
+		const Surface &src = layer.getSurface();
+		const Rect dirty = src.getDirtyRect();
+		if (dirty.isEmpty() || layer.showsNv12()) {
+			return;
+		}
+		if (!layer.isVisible()) {
+			uploads->enqueue(src, dirty, UploadPriority::Hidden);
+			return;
+		}
+
+		// Map the viewport into layer pixels and send the on-screen part of the dirty region first.
+		const int scale = layer.getScale();
+		const int left = static_cast<int>(std::floor(static_cast<float>(-layer.getOffsetX()) / scale));
+		const int top = static_cast<int>(std::floor(static_cast<float>(-layer.getOffsetY()) / scale));
+		const Rect viewport{left, top, surface->getWidth() / scale + 2, surface->getHeight() / scale + 2};
+
+		const Rect onScreen = dirty.intersected(viewport);
+		if (onScreen.isEmpty()) {
+			uploads->enqueue(src, dirty, UploadPriority::Offscreen);
+			return;
+		}
+		uploads->enqueue(src, onScreen, UploadPriority::Visible);
+
+		// The remainder of the dirty rectangle, split into up to four bands around the on-screen part.
+		const Rect bands[] = {
+				Rect{dirty.x, dirty.y, dirty.width, onScreen.y - dirty.y},
+				Rect{dirty.x, onScreen.bottom(), dirty.width, dirty.bottom() - onScreen.bottom()},
+				Rect{dirty.x, onScreen.y, onScreen.x - dirty.x, onScreen.height},
+				Rect{onScreen.right(), onScreen.y, dirty.right() - onScreen.right(), onScreen.height},
+		};
+		for (const Rect &band: bands) {
+			uploads->enqueue(src, band, UploadPriority::Offscreen);
+		}
+	}
+
 } // namespace pxr
@@ -0,0 +1,151 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "pxr/app_host.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <utility>
+#include "file_watcher.h"
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#include <unistd.h>
+#endif
+
+namespace pxr {
+
+	namespace {
+
+		using CreateAppFunction = App *(*)();
+		using DestroyAppFunction = void (*)(App *);
+
+		/**
+		 * @brief A loaded build of an app library and the instance created from it.
+		 *
+		 * The instance is destroyed before the library is closed, since its
+		 * destructor and virtual functions live in the library.
+		 */
+		class AppLibrary {
+		public:
+			/**
+			 * @brief Loads a private copy of the library.
+			 *
+			 * The dynamic loader returns the already loaded image when the same
+			 * path is opened twice, so every build is copied to a unique name first.
+			 *
+			 * @return The library, or nullptr with a description in error.
+			 */
+			static std::unique_ptr<AppLibrary> open(const std::string &path, std::string &error) {
+#ifdef _WIN32
+				(void) path;
+				error = "Reloadable apps require Linux or macOS.";
+				return nullptr;
+#else
+				static int loadCount = 0;
+				const std::string name = "pxr_host_" + std::to_string(getpid()) + "_" + std::to_string(loadCount++) +
+										 std::filesystem::path(path).extension().string();
+				const std::filesystem::path copy = std::filesystem::temp_directory_path() / name;
+				std::error_code ec;
+				std::filesystem::copy_file(path, copy, std::filesystem::copy_options::overwrite_existing, ec);
+				if (ec) {
+					error = "Cannot copy " + path + ": " + ec.message();
+					return nullptr;
+				}
+				void *handle = dlopen(copy.c_str(), RTLD_NOW | RTLD_LOCAL);
+				std::filesystem::remove(copy, ec); // The mapping stays valid; nothing is left behind in /tmp.
+				if (!handle) {
+					error = dlerror();
+					return nullptr;
+				}
+
+				std::unique_ptr<AppLibrary> library(new AppLibrary());
+				library->handle = handle;
+				library->createApp = reinterpret_cast<CreateAppFunction>(dlsym(handle, "pxrCreateApp"));
+				library->destroyApp = reinterpret_cast<DestroyAppFunction>(dlsym(handle, "pxrDestroyApp"));
+				if (!library->createApp || !library->destroyApp) {
+					error = path + " does not export an app; build it with PXR_RELOADABLE_MAIN.";
+					return nullptr;
+				}
+				return library;
+#endif
+			}
+
+			~AppLibrary() {
+				if (app) {
+					destroyApp(app);
+				}
+#ifndef _WIN32
+				if (handle) {
+					dlclose(handle);
+				}
+#endif
+			}
+
+			AppLibrary(const AppLibrary &) = delete;
+			AppLibrary &operator=(const AppLibrary &) = delete;
+
+			/**
+			 * @brief Creates the app instance; called once per library.
+			 */
+			App &createInstance() {
+				app = createApp();
+				return *app;
+			}
+
+		private:
+			AppLibrary() = default;
+
+			void *handle = nullptr; ///< dlopen() handle.
+			CreateAppFunction createApp = nullptr; ///< Exported by PXR_RELOADABLE_MAIN.
+			DestroyAppFunction destroyApp = nullptr; ///< Exported by PXR_RELOADABLE_MAIN.
+			App *app = nullptr; ///< Instance created from this library.
+		};
+
+	} // namespace
+
+	AppHost::AppHost(std::string libraryPath) : libraryPath(std::move(libraryPath)) {}
+
+	int AppHost::run() {
+		std::string error;
+		std::unique_ptr<AppLibrary> library = AppLibrary::open(libraryPath, error);
+		if (!library) {
+			std::cerr << "[Pixel Runtime] " << error << '\n';
+			return EXIT_FAILURE;
+		}
+		FileWatcher watcher;
+		watcher.watch(libraryPath);
+
+		App *app = &library->createInstance();
+		app->reloadable = true;
+		app->start();
+		while (app->runFrame()) {
+			if (watcher.poll().empty()) {
+				continue;
+			}
+			std::unique_ptr<AppLibrary> next = AppLibrary::open(libraryPath, error);
+			if (!next) {
+				std::cerr << "[Pixel Runtime] Reload failed, keeping the running code: " << error << '\n';
+				continue;
+			}
+			App &fresh = next->createInstance();
+			fresh.reloadFrom(*app, app->saveState());
+			app = &fresh;
+			library = std::move(next); // Destroys the old instance, then unloads its code.
+			++reloadCount;
+		}
+		app->finish();
+		return EXIT_SUCCESS;
+	}
+
+	uint64_t AppHost::getReloadCount() const { return reloadCount; }
+
+} // namespace pxr
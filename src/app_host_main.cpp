@@ -0,0 +1,30 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include "pxr/app_host.h"
+
+/**
+ * @brief Entry point of pxr_host: runs an app library and reloads it when it is rebuilt.
+ */
+int main(int argc, char **argv) {
+	if (argc != 2) {
+		std::cerr << "Usage: " << argv[0] << " <app library>\n";
+		return EXIT_FAILURE;
+	}
+	try {
+		pxr::AppHost host(argv[1]);
+		return host.run();
+	} catch (const std::exception &e) {
+		std::cerr << "Fatal error: " << e.what() << '\n';
+		return EXIT_FAILURE;
+	}
+}
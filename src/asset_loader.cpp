@@ -0,0 +1,371 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "asset_loader.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include "error_handling.h"
+#include "file_reader.h"
+#include "file_watcher.h"
+#include "image_codecs.h"
+
+namespace pxr {
+
+	namespace {
+
+		/// Pixel memory of released images kept for later loads.
+		constexpr size_t SurfacePoolCapacity = size_t{64} << 20;
+
+		/// Bytes of pixel memory used by a surface.
+		size_t byteSize(const Surface &surface) {
+			return static_cast<size_t>(surface.getWidth()) * surface.getHeight() * sizeof(uint32_t);
+		}
+
+		/// Reads a whole file on the calling thread.
+		bool readFile(const std::string &path, std::vector<uint8_t> &data, std::string &error) {
+			std::ifstream file(path, std::ios::binary);
+			if (!file) {
+				error = "Cannot open " + path;
+				return false;
+			}
+			data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+			if (file.bad()) {
+				error = "Cannot read " + path;
+				return false;
+			}
+			return true;
+		}
+
+		/// Returns the bounding box of the pixels that differ between two surfaces of the same size.
+		Rect findChanges(const Surface &before, const Surface &after) {
+			const int width = after.getWidth();
+			int left = width;
+			int right = 0;
+			int top = -1;
+			int bottom = 0;
+			for (int y = 0; y < after.getHeight(); ++y) {
+				const uint32_t *a = before.data() + static_cast<size_t>(y) * width;
+				const uint32_t *b = after.data() + static_cast<size_t>(y) * width;
+				if (std::equal(a, a + width, b)) {
+					continue;
+				}
+				const int first = static_cast<int>(std::mismatch(a, a + width, b).first - a);
+				int last = width;
+				while (a[last - 1] == b[last - 1]) {
+					--last;
+				}
+				left = std::min(left, first);
+				right = std::max(right, last);
+				top = top < 0 ? y : top;
+				bottom = y + 1;
+			}
+			return top < 0 ? Rect{} : Rect{left, top, right - left, bottom - top};
+		}
+
+		/// Shared by every empty handle.
+		const std::string EmptyString;
+
+	} // namespace
+
+	//--------------------------------------------------------------------------
+	// ImageHandle
+	//--------------------------------------------------------------------------
+
+	AssetState ImageHandle::getState() const { return record ? record->state : AssetState::Failed; }
+
+	bool ImageHandle::isReady() const { return getState() == AssetState::Ready; }
+
+	bool ImageHandle::isFailed() const { return getState() == AssetState::Failed; }
+
+	const Surface &ImageHandle::getSurface() const {
+		PXR_ASSERT(isReady(), "getSurface() called on an image that is not loaded.");
+		return *record->surface;
+	}
+
+	const std::string &ImageHandle::getError() const { return record ? record->error : EmptyString; }
+
+	const std::string &ImageHandle::getPath() const { return record ? record->path : EmptyString; }
+
+	uint64_t ImageHandle::getVersion() const { return record ? record->version : 0; }
+
+	Rect ImageHandle::getChangedRect() const { return record ? record->changedRect : Rect{}; }
+
+	//--------------------------------------------------------------------------
+	// SurfacePool
+	//--------------------------------------------------------------------------
+
+	std::unique_ptr<Surface> SurfacePool::acquire(int width, int height) {
+		{
+			std::lock_guard lock(mutex);
+			auto it = free.find({width, height});
+			if (it != free.end()) {
+				std::unique_ptr<Surface> surface = std::move(it->second.back());
+				it->second.pop_back();
+				if (it->second.empty()) {
+					free.erase(it);
+				}
+				size -= byteSize(*surface);
+				return surface;
+			}
+		}
+		return std::make_unique<Surface>(width, height);
+	}
+
+	void SurfacePool::release(std::unique_ptr<Surface> surface) {
+		const size_t bytes = byteSize(*surface);
+		std::lock_guard lock(mutex);
+		if (size + bytes <= capacity) {
+			size += bytes;
+			free[{surface->getWidth(), surface->getHeight()}].push_back(std::move(surface));
+		}
+	}
+
+	ImageRecord::~ImageRecord() {
+		if (surface) {
+			if (auto target = pool.lock()) {
+				target->release(std::move(surface));
+			}
+		}
+	}
+
+	//--------------------------------------------------------------------------
+	// AssetLoader
+	//--------------------------------------------------------------------------
+
+	AssetLoader::AssetLoader(int workerCount) :
+		pool(std::make_shared<SurfacePool>(SurfacePoolCapacity)), workerCount(workerCount) {
+		if (this->workerCount <= 0) {
+			// Leave one hardware thread to the frame loop.
+			this->workerCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+		}
+	}
+
+	AssetLoader::~AssetLoader() {
+		reader.reset(); // Its callbacks queue jobs, so it must finish first.
+		watcher.reset();
+		{
+			std::lock_guard lock(mutex);
+			stopping = true;
+			jobs.clear();
+		}
+		wakeUp.notify_all();
+		for (auto &worker: workers) {
+			worker.join();
+		}
+	}
+
+	ImageHandle AssetLoader::load(const std::string &path) {
+		const std::string key = std::filesystem::path(path).lexically_normal().string();
+		if (auto it = records.find(key); it != records.end()) {
+			if (auto record = it->second.lock()) {
+				return ImageHandle(std::move(record));
+			}
+		}
+		if (records.size() >= purgeThreshold) {
+			std::erase_if(records, [](const auto &entry) { return entry.second.expired(); });
+			purgeThreshold = std::max<size_t>(64, records.size() * 2);
+		}
+
+		auto record = std::make_shared<ImageRecord>();
+		record->path = path;
+		record->pool = pool;
+		records[key] = record;
+		if (watcher) {
+			watcher->watch(key);
+		}
+		startLoad(record);
+		return ImageHandle(std::move(record));
+	}
+
+	void AssetLoader::startLoad(const std::shared_ptr<ImageRecord> &record) {
+		record->loading = true;
+		++pendingCount;
+		if (!readerProbed) {
+			reader = FileReader::create();
+			readerProbed = true;
+		}
+		// Only this load touches the record's surface until it is committed, so workers may read it.
+		const Surface *previous = record->surface.get();
+		if (reader) {
+			reader->read(record->path, [this, record, previous](std::vector<uint8_t> data, std::string error) {
+				enqueue(Job{record, std::move(data), std::move(error), true, previous});
+			});
+		} else {
+			enqueue(Job{record, {}, {}, false, previous});
+		}
+	}
+
+	void AssetLoader::commit(size_t budgetBytes) {
+		std::vector<Completion> &ready = committing;
+		{
+			std::lock_guard lock(mutex);
+			size_t bytes = 0;
+			while (!completions.empty()) {
+				Completion &next = completions.front();
+				size_t size = next.surface ? byteSize(*next.surface) : 0;
+				if (next.sameSize) {
+					size = static_cast<size_t>(next.changedRect.area()) * sizeof(uint32_t); // Only these are copied.
+				}
+				if (budgetBytes > 0 && !ready.empty() && bytes + size > budgetBytes) {
+					break;
+				}
+				bytes += size;
+				ready.push_back(std::move(next));
+				completions.pop_front();
+			}
+		}
+
+		for (Completion &completion: ready) {
+			ImageRecord &record = *completion.record;
+			record.loading = false;
+			--pendingCount;
+			if (!completion.surface) {
+				// A failed reload, for example of a half-written file, keeps the last good content.
+				record.error = std::move(completion.error);
+				record.state = record.surface ? AssetState::Ready : AssetState::Failed;
+			} else if (completion.sameSize) {
+				// Copy only the changed pixels so the surface object, and references to it, stay the same.
+				const Rect &changed = completion.changedRect;
+				const int width = record.surface->getWidth();
+				for (int y = changed.y; y < changed.bottom(); ++y) {
+					const size_t row = static_cast<size_t>(y) * width + changed.x;
+					std::copy_n(completion.surface->data() + row, changed.width, record.surface->data() + row);
+				}
+				if (!changed.isEmpty()) {
+					record.surface->markDirty(changed);
+					record.changedRect = changed;
+					++record.version;
+				}
+				record.error.clear();
+				pool->release(std::move(completion.surface));
+			} else {
+				if (record.surface) {
+					pool->release(std::move(record.surface));
+				}
+				record.surface = std::move(completion.surface);
+				record.changedRect = Rect{0, 0, record.surface->getWidth(), record.surface->getHeight()};
+				record.error.clear();
+				record.state = AssetState::Ready;
+				++record.version;
+			}
+			if (record.reloadRequested) {
+				record.reloadRequested = false;
+				startLoad(completion.record);
+			}
+		}
+		// Records without handles are destroyed here, returning their surfaces to the pool.
+		ready.clear();
+	}
+
+	size_t AssetLoader::getPendingCount() const { return pendingCount; }
+
+	bool AssetLoader::hasCompletions() const {
+		std::lock_guard lock(mutex);
+		return !completions.empty();
+	}
+
+	void AssetLoader::enableHotReload() {
+		if (watcher) {
+			return;
+		}
+		watcher = std::make_unique<FileWatcher>();
+		for (const auto &[key, record]: records) {
+			if (!record.expired()) {
+				watcher->watch(key);
+			}
+		}
+	}
+
+	void AssetLoader::pollChanges() {
+		if (!watcher) {
+			return;
+		}
+		for (const std::string &key: watcher->poll()) {
+			const auto it = records.find(key);
+			const auto record = it != records.end() ? it->second.lock() : nullptr;
+			if (!record) {
+				continue; // No handle left; the next load reads the file anyway.
+			}
+			if (record->loading) {
+				record->reloadRequested = true;
+			} else {
+				startLoad(record);
+			}
+		}
+	}
+
+	void AssetLoader::enqueue(Job job) {
+		{
+			std::lock_guard lock(mutex);
+			if (stopping) {
+				return;
+			}
+			if (workers.empty()) {
+				for (int i = 0; i < workerCount; ++i) {
+					workers.emplace_back(&AssetLoader::workerLoop, this);
+				}
+			}
+			jobs.push_back(std::move(job));
+		}
+		wakeUp.notify_one();
+	}
+
+	void AssetLoader::workerLoop() {
+		std::unique_lock lock(mutex);
+		for (;;) {
+			wakeUp.wait(lock, [this] { return stopping || !jobs.empty(); });
+			if (stopping) {
+				return;
+			}
+			Job job = std::move(jobs.front());
+			jobs.pop_front();
+
+			lock.unlock();
+			Completion completion = process(job);
+			job = Job(); // Frees the file contents outside the lock.
+			lock.lock();
+
+			completions.push_back(std::move(completion));
+		}
+	}
+
+	AssetLoader::Completion AssetLoader::process(Job &job) {
+		Completion completion;
+		completion.record = job.record;
+		completion.error = std::move(job.error);
+		if (!job.read && !readFile(job.record->path, job.data, completion.error)) {
+			return completion;
+		}
+		if (!completion.error.empty()) {
+			return completion;
+		}
+
+		codecs::ImageInfo info;
+		if (!codecs::readImageInfo(job.data, info, completion.error)) {
+			completion.error = job.record->path + ": " + completion.error;
+			return completion;
+		}
+		std::unique_ptr<Surface> surface = pool->acquire(info.width, info.height);
+		if (!codecs::decodeImage(job.data, *surface, completion.error)) {
+			completion.error = job.record->path + ": " + completion.error;
+			pool->release(std::move(surface));
+			return completion;
+		}
+		if (job.previous && job.previous->getWidth() == info.width && job.previous->getHeight() == info.height) {
+			completion.changedRect = findChanges(*job.previous, *surface);
+			completion.sameSize = true;
+		}
+		completion.surface = std::move(surface);
+		return completion;
+	}
+
+} // namespace pxr
@@ -0,0 +1,203 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "pxr/assets.h"
+#include "pxr/surface.h"
+
+namespace pxr {
+
+	class FileReader;
+	class FileWatcher;
+
+	/**
+	 * @brief Recycles decoded image surfaces by size.
+	 *
+	 * Shared by the loader and its image records, so surfaces released after the
+	 * loader is gone are simply freed.
+	 */
+	class SurfacePool {
+	public:
+		/**
+		 * @param capacity Bytes of pixel memory kept for reuse.
+		 */
+		explicit SurfacePool(size_t capacity) : capacity(capacity) {}
+
+		/**
+		 * @brief Returns a surface of the given size with undefined content.
+		 */
+		std::unique_ptr<Surface> acquire(int width, int height);
+
+		/**
+		 * @brief Keeps a surface for reuse, or frees it if the pool is full.
+		 */
+		void release(std::unique_ptr<Surface> surface);
+
+	private:
+		std::mutex mutex; ///< Guards the members below; surfaces are acquired on worker threads.
+		std::map<std::pair<int, int>, std::vector<std::unique_ptr<Surface>>> free; ///< Idle surfaces by size.
+		size_t capacity; ///< Byte limit of the idle surfaces.
+		size_t size = 0; ///< Bytes held by the idle surfaces.
+	};
+
+	/**
+	 * @brief Shared state behind every ImageHandle to one path.
+	 *
+	 * The path and pool never change. The other members are only written by
+	 * the main thread when a load is committed, so handles need no locking.
+	 */
+	struct ImageRecord {
+		std::string path; ///< Path as passed to App::loadImage().
+		AssetState state = AssetState::Loading; ///< Progress of the load.
+		std::unique_ptr<Surface> surface; ///< Decoded pixels once ready.
+		std::string error; ///< Failure description.
+		uint64_t version = 0; ///< Number of times new content was committed.
+		Rect changedRect; ///< Pixels changed by the last commit.
+		bool loading = true; ///< True while a load or reload is in flight.
+		bool reloadRequested = false; ///< Set if the file changed while loading; reloads after the commit.
+		std::weak_ptr<SurfacePool> pool; ///< Receives the surface when the last handle is gone.
+
+		~ImageRecord();
+	};
+
+	/**
+	 * @brief Reads and decodes images in the background for the app.
+	 *
+	 * Files are read through a FileReader when io_uring is available and on the
+	 * worker threads otherwise. Workers decode into pooled surfaces and queue
+	 * the results; commit() hands them to their handles on the main thread.
+	 */
+	class AssetLoader {
+	public:
+		/**
+		 * @param workerCount Decoding threads, or 0 for one per hardware thread but one.
+		 */
+		explicit AssetLoader(int workerCount = 0);
+
+		/**
+		 * @brief Waits for file reads in flight, then stops the workers; unfinished loads stay Loading.
+		 */
+		~AssetLoader();
+
+		AssetLoader(const AssetLoader &) = delete;
+		AssetLoader &operator=(const AssetLoader &) = delete;
+
+		/**
+		 * @brief Starts loading an image, or returns the handle of a load of the same path.
+		 */
+		ImageHandle load(const std::string &path);
+
+		/**
+		 * @brief Hands finished loads to their handles; call on the main thread.
+		 *
+		 * At least one load is committed per call, so a large image cannot stall
+		 * the queue.
+		 *
+		 * @param budgetBytes Decoded bytes to commit, or 0 for no limit.
+		 */
+		void commit(size_t budgetBytes);
+
+		/**
+		 * @brief Returns the number of loads not yet committed.
+		 */
+		[[nodiscard]] size_t getPendingCount() const;
+
+		/**
+		 * @brief Returns true if commit() has finished loads to hand out.
+		 */
+		[[nodiscard]] bool hasCompletions() const;
+
+		/**
+		 * @brief Watches the files of current and future loads for changes.
+		 */
+		void enableHotReload();
+
+		/**
+		 * @brief Starts reloading images whose files changed since the last call.
+		 *
+		 * Changes are coalesced: an image changed several times reloads once,
+		 * and an image changed while loading reloads after the load commits.
+		 */
+		void pollChanges();
+
+	private:
+		/**
+		 * @brief A file waiting for a worker; without data, the worker reads it first.
+		 */
+		struct Job {
+			std::shared_ptr<ImageRecord> record; ///< Load the job belongs to.
+			std::vector<uint8_t> data; ///< File contents, if already read.
+			std::string error; ///< Read error, if any.
+			bool read = false; ///< True if data and error are set.
+			const Surface *previous = nullptr; ///< Content being replaced by a reload.
+		};
+
+		/**
+		 * @brief A decoded image waiting for commit().
+		 */
+		struct Completion {
+			std::shared_ptr<ImageRecord> record; ///< Load to finish.
+			std::unique_ptr<Surface> surface; ///< Decoded pixels, or null on failure.
+			std::string error; ///< Failure description.
+			Rect changedRect; ///< Pixels that differ from the previous content.
+			bool sameSize = false; ///< True if the previous content has the same size.
+		};
+
+		/**
+		 * @brief Reads and decodes a record's file in the background.
+		 */
+		void startLoad(const std::shared_ptr<ImageRecord> &record);
+
+		/**
+		 * @brief Queues a job, starting the workers on first use.
+		 */
+		void enqueue(Job job);
+
+		/**
+		 * @brief Runs jobs until the loader is destroyed.
+		 */
+		void workerLoop();
+
+		/**
+		 * @brief Reads and decodes one image.
+		 */
+		Completion process(Job &job);
+
+		std::shared_ptr<SurfacePool> pool; ///< Recycled surfaces.
+		std::unique_ptr<FileReader> reader; ///< Asynchronous reads; null when io_uring is unavailable.
+		bool readerProbed = false; ///< Set once creating the reader was attempted.
+		std::unique_ptr<FileWatcher> watcher; ///< Reports changed files; null unless hot reload is on.
+		std::unordered_map<std::string, std::weak_ptr<ImageRecord>> records; ///< Live loads by normalized path.
+		size_t purgeThreshold = 64; ///< Map size at which expired records are dropped.
+		size_t pendingCount = 0; ///< Loads started and not yet committed.
+		std::vector<Completion> committing; ///< Taken by commit(); a member so frames without loads never allocate.
+		int workerCount; ///< Threads started on the first job.
+
+		mutable std::mutex mutex; ///< Guards the members below.
+		std::condition_variable wakeUp; ///< Signals new jobs or shutdown.
+		std::deque<Job> jobs; ///< Jobs not yet picked up by a worker.
+		std::deque<Completion> completions; ///< Results in completion order.
+		bool stopping = false; ///< Set when the workers should exit.
+		std::vector<std::thread> workers; ///< Decoding threads.
+	};
+
+} // namespace pxr
@@ -0,0 +1,87 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "backend.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include "error_handling.h"
+#include "gl_presenter.h"
+#include "glfw_window.h"
+#include "null_backend.h"
+#include "terminal_presenter.h"
+#ifdef __linux__
+#include "fbdev_presenter.h"
+#endif
+#ifdef PXR_HAS_X11_SHM
+#include "x11_shm_presenter.h"
+#endif
+
+namespace pxr {
+
+	std::vector<Backend> &BackendRegistry::backends() {
+		static std::vector<Backend> table = {
+				Backend{"glfw", [] { return std::make_unique<GlfwWindow>(); },
+						[] { return std::make_unique<GlPresenter>(); }},
+				Backend{"null", [] { return std::make_unique<NullWindow>(); },
+						[] { return std::make_unique<NullPresenter>(); }},
+				Backend{"terminal", [] { return std::make_unique<NullWindow>(); },
+						[] { return std::make_unique<TerminalPresenter>(); }, false},
+#ifdef __linux__
+				Backend{"fbdev", [] { return std::make_unique<NullWindow>(); },
+						[] { return std::make_unique<FbdevPresenter>(); }, false},
+#endif
+#ifdef PXR_HAS_X11_SHM
+				Backend{"x11", [] { return std::make_unique<GlfwWindow>(GlfwWindow::ClientApi::X11); },
+						[] { return std::make_unique<X11ShmPresenter>(); }},
+#endif
+		};
+		return table;
+	}
+
+	void BackendRegistry::add(Backend backend) {
+		auto &table = backends();
+		const auto it = std::ranges::find(table, backend.name, &Backend::name);
+		if (it != table.end()) {
+			*it = std::move(backend);
+		} else {
+			table.push_back(std::move(backend));
+		}
+	}
+
+	const Backend *BackendRegistry::find(const std::string &name) {
+		const auto &table = backends();
+		const auto it = std::ranges::find(table, name, &Backend::name);
+		return it != table.end() ? &*it : nullptr;
+	}
+
+	const Backend &BackendRegistry::select(const std::string &requested) {
+		const char *env = std::getenv("PXR_BACKEND");
+		const std::string name = env && *env ? env : requested.empty() ? "glfw" : requested;
+
+		const Backend *backend = find(name);
+		if (!backend) {
+			std::string known;
+			for (const auto &entry: getNames()) {
+				known += known.empty() ? entry : ", " + entry;
+			}
+			PXR_ASSERT(false, ("Unknown backend \"" + name + "\" (available: " + known + ")").c_str());
+		}
+		return *backend;
+	}
+
+	std::vector<std::string> BackendRegistry::getNames() {
+		std::vector<std::string> names;
+		for (const auto &backend: backends()) {
+			names.push_back(backend.name);
+		}
+		return names;
+	}
+
+} // namespace pxr
@@ -0,0 +1,78 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "presenter.h"
+#include "window.h"
+
+namespace pxr {
+
+	/**
+	 * @brief A named pairing of window and presenter implementations.
+	 */
+	struct Backend {
+		std::string name; ///< Name used by App::setBackend() and PXR_BACKEND.
+		std::function<std::unique_ptr<Window>()> createWindow; ///< Creates the window.
+		std::function<std::unique_ptr<Presenter>()> createPresenter; ///< Creates the presenter.
+		bool multipleWindows = true; ///< Whether several windows can be shown at once (see App::addWindow()).
+	};
+
+	/**
+	 * @brief Table of available platform backends.
+	 *
+	 * The built-in backends are:
+	 * - `glfw`: GLFW window with OpenGL presentation (the default).
+	 * - `null`: no window and no output, for headless runs.
+	 * - `terminal`: truecolor half blocks or sixel graphics on standard output.
+	 * - `fbdev`: Linux framebuffer device, drawn on the CPU (Linux only).
+	 * - `x11`: GLFW window presented through X11 MIT-SHM images, drawn on the CPU
+	 *   (when built with `PXR_WITH_X11_SHM`).
+	 */
+	class BackendRegistry {
+	public:
+		/**
+		 * @brief Adds a backend, replacing any backend with the same name.
+		 * @param backend The backend to add.
+		 */
+		static void add(Backend backend);
+
+		/**
+		 * @brief Looks up a backend by name.
+		 * @return The backend, or nullptr if no backend has that name.
+		 */
+		static const Backend *find(const std::string &name);
+
+		/**
+		 * @brief Picks the backend to run with.
+		 *
+		 * The `PXR_BACKEND` environment variable overrides the requested name;
+		 * with neither set, `glfw` is used. Unknown names are fatal.
+		 *
+		 * @param requested Name chosen by the app, or empty for the default.
+		 */
+		static const Backend &select(const std::string &requested);
+
+		/**
+		 * @brief Returns the names of all registered backends.
+		 */
+		static std::vector<std::string> getNames();
+
+	private:
+		/**
+		 * @brief Returns the backend table, filled with the built-in backends on first use.
+		 */
+		static std::vector<Backend> &backends();
+	};
+
+} // namespace pxr
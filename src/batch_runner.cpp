@@ -0,0 +1,191 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "pxr/batch_runner.h"
+
+#include <chrono>
+#include <utility>
+#include "error_handling.h"
+#include "thread_pool.h"
+
+namespace pxr {
+
+	namespace {
+
+		using Clock = std::chrono::steady_clock;
+
+		double secondsSince(Clock::time_point start) {
+			return std::chrono::duration<double>(Clock::now() - start).count();
+		}
+
+	} // namespace
+
+	//--------------------------------------------------------------------------
+	// Shared Assets
+	//--------------------------------------------------------------------------
+
+	bool SharedAssets::contains(const std::string &key) const {
+		std::lock_guard lock(mutex);
+		const auto it = entries.find(key);
+		return it != entries.end() && it->second->asset;
+	}
+
+	void SharedAssets::clear() {
+		std::lock_guard lock(mutex);
+		entries.clear();
+	}
+
+	std::shared_ptr<const void> SharedAssets::load(const std::string &key, const std::type_info &type,
+												   const std::function<std::shared_ptr<const void>()> &loader) {
+		std::shared_ptr<Entry> entry;
+		{
+			std::lock_guard lock(mutex);
+			auto &slot = entries[key];
+			if (!slot) {
+				slot = std::make_shared<Entry>();
+			}
+			entry = slot;
+		}
+
+		// Loading happens outside the map lock so different keys load in parallel.
+		std::call_once(entry->loaded, [&] {
+			entry->asset = loader();
+			entry->type = &type;
+		});
+		PXR_ASSERT(*entry->type == type, ("Shared asset \"" + key + "\" was loaded with a different type.").c_str());
+		return entry->asset;
+	}
+
+	//--------------------------------------------------------------------------
+	// Batch Runner
+	//--------------------------------------------------------------------------
+
+	BatchRunner::BatchRunner(int threadCount) : pool(std::make_unique<ThreadPool>(threadCount)) {}
+
+	BatchRunner::~BatchRunner() = default;
+
+	void BatchRunner::setMode(Mode newMode) { mode = newMode; }
+
+	void BatchRunner::setFrameBudget(uint64_t frames) {
+		frameBudget = [frames](int) { return frames; };
+	}
+
+	void BatchRunner::setFrameBudget(FrameBudget budget) { frameBudget = std::move(budget); }
+
+	void BatchRunner::setFixedDeltaTime(float seconds) { fixedDeltaTime = seconds; }
+
+	int BatchRunner::getThreadCount() const { return pool->getThreadCount(); }
+
+	const std::vector<BatchInstanceStats> &BatchRunner::getInstanceStats() const { return instanceStats; }
+
+	SharedAssets &BatchRunner::getAssets() { return assets; }
+
+	BatchStats BatchRunner::run(int count, const Factory &factory) {
+		PXR_ASSERT(count >= 0, "BatchRunner::run() needs a non-negative instance count.");
+		PXR_ASSERT(static_cast<bool>(factory), "BatchRunner::run() needs a factory.");
+
+		BatchStats stats;
+		stats.instances = count;
+		stats.threads = pool->getThreadCount();
+		apps.clear();
+		apps.resize(count);
+		budgets.assign(count, 0);
+		instanceStats.assign(count, {});
+
+		// Instances are finished and destroyed even if one of them throws.
+		std::vector<char> started(count, false); // Not vector<bool>: written from several threads.
+		auto finishAll = [&] {
+			pool->parallelFor(count, [&](int index) {
+				if (started[index]) {
+					apps[index]->finish();
+				}
+				apps[index].reset();
+			});
+			apps.clear();
+		};
+
+		try {
+			const auto setupStart = Clock::now();
+			pool->parallelFor(count, [&](int index) {
+				apps[index] = factory(index, assets);
+				PXR_ASSERT(apps[index] != nullptr, "BatchRunner factory returned no app.");
+				App &app = *apps[index];
+				app.headless = true;
+				app.fixedDeltaTime = fixedDeltaTime;
+				budgets[index] = frameBudget ? frameBudget(index) : 0;
+				app.start();
+				started[index] = true;
+			});
+			stats.setupSeconds = secondsSince(setupStart);
+
+			const auto runStart = Clock::now();
+			if (mode == Mode::Lockstep) {
+				std::vector<int> live(count);
+				for (int i = 0; i < count; ++i) {
+					live[i] = i;
+				}
+				std::vector<char> running(count);
+				while (!live.empty()) {
+					pool->parallelFor(static_cast<int>(live.size()),
+									  [&](int slot) { running[live[slot]] = step(live[slot]); });
+					std::erase_if(live, [&](int index) { return !running[index]; });
+				}
+			} else {
+				pool->parallelFor(count, [&](int index) {
+					while (step(index)) {
+					}
+				});
+			}
+			stats.runSeconds = secondsSince(runStart);
+		} catch (...) {
+			finishAll();
+			throw;
+		}
+		finishAll();
+
+		for (int i = 0; i < count; ++i) {
+			const BatchInstanceStats &instance = instanceStats[i];
+			stats.frames += instance.frames;
+			if (instance.frameSeconds > stats.slowestInstanceSeconds || stats.slowestInstance < 0) {
+				stats.slowestInstanceSeconds = instance.frameSeconds;
+				stats.slowestInstance = i;
+			}
+		}
+		if (stats.runSeconds > 0.0) {
+			stats.framesPerSecond = static_cast<double>(stats.frames) / stats.runSeconds;
+		}
+		return stats;
+	}
+
+	bool BatchRunner::step(int index) {
+		BatchInstanceStats &instance = instanceStats[index];
+		const uint64_t budget = budgets[index];
+		if (budget > 0 && instance.frames >= budget) {
+			return false;
+		}
+
+		App &app = *apps[index];
+		if (!app.isRunning()) {
+			instance.exited = true;
+			return false;
+		}
+
+		const auto frameStart = Clock::now();
+		const bool running = app.runFrame();
+		instance.frameSeconds += secondsSince(frameStart);
+		instance.frames++;
+
+		if (!running) {
+			instance.exited = true;
+			return false;
+		}
+		return budget == 0 || instance.frames < budget;
+	}
+
+} // namespace pxr
@@ -0,0 +1,38 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include "pxr/types.h"
+
+/**
+ * @brief Built-in 5x7 bitmap font for printable ASCII.
+ */
+namespace pxr::font {
+
+	constexpr int GlyphWidth = 5; ///< Glyph width in pixels.
+	constexpr int GlyphHeight = 7; ///< Glyph height in pixels.
+	constexpr int Advance = 6; ///< Horizontal distance between glyph origins.
+	constexpr int LineHeight = 9; ///< Vertical distance between lines.
+
+	/**
+	 * @brief Returns the rows of a glyph, top first; bit 4 is the leftmost pixel.
+	 *
+	 * Characters outside printable ASCII map to '?'.
+	 */
+	const uint8_t *glyph(char c);
+
+	/**
+	 * @brief Returns the area covered by a text drawn at (x, y), honouring '\n'.
+	 */
+	Rect measure(std::string_view text, int x, int y);
+
+} // namespace pxr::font
@@ -0,0 +1,86 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "pxr/command_buffer.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include "bitmap_font.h"
+
+namespace pxr {
+
+	void CommandBuffer::fill(const Rect &rect, const Color &color) {
+		if (rect.isEmpty()) {
+			return;
+		}
+		DrawCommand command;
+		command.type = DrawCommand::Type::Fill;
+		command.bounds = rect;
+		command.color = color.toUInt32();
+		commands.push_back(command);
+	}
+
+	void CommandBuffer::line(int x0, int y0, int x1, int y1, const Color &color) {
+		DrawCommand command;
+		command.type = DrawCommand::Type::Line;
+		command.bounds = Rect{std::min(x0, x1), std::min(y0, y1), std::abs(x1 - x0) + 1, std::abs(y1 - y0) + 1};
+		command.color = color.toUInt32();
+		command.x0 = x0;
+		command.y0 = y0;
+		command.x1 = x1;
+		command.y1 = y1;
+		commands.push_back(command);
+	}
+
+	void CommandBuffer::blit(const Surface &source, int x, int y) {
+		DrawCommand command;
+		command.type = DrawCommand::Type::Blit;
+		command.bounds = Rect{x, y, source.getWidth(), source.getHeight()};
+		command.x0 = x;
+		command.y0 = y;
+		command.source = &source;
+		commands.push_back(command);
+	}
+
+	void CommandBuffer::sprite(const Surface &source, int x, int y) {
+		blit(source, x, y);
+		commands.back().type = DrawCommand::Type::Sprite;
+	}
+
+	void CommandBuffer::text(int x, int y, std::string_view characters, const Color &color) {
+		const Rect bounds = font::measure(characters, x, y);
+		if (bounds.isEmpty()) {
+			return;
+		}
+		DrawCommand command;
+		command.type = DrawCommand::Type::Text;
+		command.bounds = bounds;
+		command.color = color.toUInt32();
+		command.x0 = x;
+		command.y0 = y;
+		command.textOffset = static_cast<uint32_t>(textStorage.size());
+		command.textLength = static_cast<uint32_t>(characters.size());
+		textStorage.append(characters);
+		commands.push_back(command);
+	}
+
+	const std::vector<DrawCommand> &CommandBuffer::getCommands() const { return commands; }
+
+	std::string_view CommandBuffer::getText(const DrawCommand &command) const {
+		return std::string_view(textStorage).substr(command.textOffset, command.textLength);
+	}
+
+	bool CommandBuffer::isEmpty() const { return commands.empty(); }
+
+	void CommandBuffer::clear() {
+		commands.clear();
+		textStorage.clear();
+	}
+
+} // namespace pxr
@@ -0,0 +1,241 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "command_executor.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include "bitmap_font.h"
+#include "pixel_kernels.h"
+#include "thread_pool.h"
+
+namespace pxr {
+
+	namespace {
+
+		/**
+		 * @brief Draws the part of a line inside a clip rectangle.
+		 *
+		 * Every pixel is computed from its step index alone, so the pieces drawn
+		 * by different tiles join up exactly.
+		 */
+		void drawLine(Surface &target, const DrawCommand &command, const Rect &clip) {
+			const int dx = command.x1 - command.x0;
+			const int dy = command.y1 - command.y0;
+			const bool xMajor = std::abs(dx) >= std::abs(dy);
+			const int64_t major = std::abs(xMajor ? dx : dy);
+			const int64_t minor = std::abs(xMajor ? dy : dx);
+			const int majorStep = (xMajor ? dx : dy) < 0 ? -1 : 1;
+			const int minorStep = (xMajor ? dy : dx) < 0 ? -1 : 1;
+			const int majorStart = xMajor ? command.x0 : command.y0;
+			const int minorStart = xMajor ? command.y0 : command.x0;
+
+			// Only steps whose major coordinate falls inside the clip are visited.
+			const int clipLow = xMajor ? clip.x : clip.y;
+			const int clipHigh = (xMajor ? clip.right() : clip.bottom()) - 1;
+			int64_t first = majorStep > 0 ? clipLow - majorStart : majorStart - clipHigh;
+			int64_t last = majorStep > 0 ? clipHigh - majorStart : majorStart - clipLow;
+			first = std::max<int64_t>(first, 0);
+			last = std::min<int64_t>(last, major);
+
+			uint32_t *pixels = target.data();
+			const int width = target.getWidth();
+			for (int64_t k = first; k <= last; ++k) {
+				const int along = majorStart + static_cast<int>(k) * majorStep;
+				const int64_t offset = major > 0 ? (2 * k * minor + major) / (2 * major) : 0;
+				const int across = minorStart + static_cast<int>(offset) * minorStep;
+				const int x = xMajor ? along : across;
+				const int y = xMajor ? across : along;
+				if (x >= clip.x && x < clip.right() && y >= clip.y && y < clip.bottom()) {
+					pixels[y * width + x] = command.color;
+				}
+			}
+		}
+
+		/**
+		 * @brief Draws the glyphs of a text command inside a clip rectangle.
+		 */
+		void drawText(Surface &target, const DrawCommand &command, std::string_view text, const Rect &clip) {
+			uint32_t *pixels = target.data();
+			const int width = target.getWidth();
+			int originX = command.x0;
+			int originY = command.y0;
+			for (const char c: text) {
+				if (c == '\n') {
+					originX = command.x0;
+					originY += font::LineHeight;
+					continue;
+				}
+				const Rect area = Rect{originX, originY, font::GlyphWidth, font::GlyphHeight}.intersected(clip);
+				if (!area.isEmpty()) {
+					const uint8_t *rows = font::glyph(c);
+					for (int y = area.y; y < area.bottom(); ++y) {
+						const uint8_t row = rows[y - originY];
+						for (int x = area.x; x < area.right(); ++x) {
+							if (row & (0x10 >> (x - originX))) {
+								pixels[y * width + x] = command.color;
+							}
+						}
+					}
+				}
+				originX += font::Advance;
+			}
+		}
+
+		/**
+		 * @brief Runs one command clipped to a rectangle of the target.
+		 */
+		void executeCommand(Surface &target, const CommandBuffer &buffer, const DrawCommand &command,
+							const Rect &clip) {
+			const Rect area = command.bounds.intersected(clip);
+			if (area.isEmpty()) {
+				return;
+			}
+			uint32_t *pixels = target.data();
+			const int width = target.getWidth();
+
+			switch (command.type) {
+				case DrawCommand::Type::Fill:
+					for (int y = area.y; y < area.bottom(); ++y) {
+						kernels::fillRow(pixels + y * width + area.x, command.color, area.width);
+					}
+					break;
+				case DrawCommand::Type::Line:
+					drawLine(target, command, area);
+					break;
+				case DrawCommand::Type::Blit:
+				case DrawCommand::Type::Sprite: {
+					const uint32_t *source = command.source->data();
+					const int sourceWidth = command.source->getWidth();
+					for (int y = area.y; y < area.bottom(); ++y) {
+						uint32_t *dst = pixels + y * width + area.x;
+						const uint32_t *src = source + (y - command.y0) * sourceWidth + (area.x - command.x0);
+						if (command.type == DrawCommand::Type::Blit) {
+							kernels::copyRow(dst, src, area.width);
+						} else {
+							kernels::blendRow(dst, src, area.width, 255, BlendMode::Normal);
+						}
+					}
+					break;
+				}
+				case DrawCommand::Type::Text:
+					drawText(target, command, buffer.getText(command), area);
+					break;
+			}
+		}
+
+	} // namespace
+
+	CommandExecutor::CommandExecutor(int threads) : threadCount(threads) {}
+
+	CommandExecutor::~CommandExecutor() {
+		Node *node = head.load(std::memory_order_acquire);
+		while (node) {
+			Node *next = node->next;
+			delete node;
+			node = next;
+		}
+	}
+
+	CommandBuffer &CommandExecutor::getThreadBuffer() {
+		const auto id = std::this_thread::get_id();
+		Node *const first = head.load(std::memory_order_acquire);
+		for (Node *node = first; node; node = node->next) {
+			if (node->owner.load(std::memory_order_relaxed) == id) {
+				return node->buffer;
+			}
+		}
+		for (Node *node = first; node; node = node->next) {
+			std::thread::id unowned;
+			if (node->owner.compare_exchange_strong(unowned, id, std::memory_order_acquire)) {
+				return node->buffer;
+			}
+		}
+
+		auto *node = new Node;
+		node->owner.store(id, std::memory_order_relaxed);
+		node->next = head.load(std::memory_order_relaxed);
+		while (!head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+		}
+		return node->buffer;
+	}
+
+	Rect CommandExecutor::execute(Surface &target) {
+		active.clear();
+		for (Node *node = head.load(std::memory_order_acquire); node; node = node->next) {
+			if (!node->buffer.isEmpty()) {
+				active.push_back(node);
+			}
+		}
+		if (active.empty()) {
+			release();
+			return Rect{};
+		}
+		if (!pool) {
+			pool = std::make_unique<ThreadPool>(threadCount);
+		}
+
+		const Rect area{0, 0, target.getWidth(), target.getHeight()};
+		tilesX = (area.width + TileSize - 1) / TileSize;
+		tilesY = (area.height + TileSize - 1) / TileSize;
+		pool->parallelFor(static_cast<int>(active.size()), [&](int index) { bin(*active[index], area); });
+		pool->parallelFor(tilesX * tilesY, [&](int tile) { executeTile(target, tile); });
+
+		Rect damage;
+		for (Node *node: active) {
+			damage = damage.united(node->damage);
+			node->buffer.clear();
+		}
+		release();
+		target.markDirty(damage);
+		return damage;
+	}
+
+	void CommandExecutor::release() {
+		for (Node *node = head.load(std::memory_order_acquire); node; node = node->next) {
+			node->owner.store(std::thread::id{}, std::memory_order_release);
+		}
+	}
+
+	void CommandExecutor::bin(Node &node, const Rect &area) {
+		const size_t tileCount = static_cast<size_t>(tilesX) * tilesY;
+		if (node.tiles.size() != tileCount) {
+			node.tiles.assign(tileCount, {});
+		}
+		node.damage = Rect{};
+
+		const auto &commands = node.buffer.getCommands();
+		for (size_t i = 0; i < commands.size(); ++i) {
+			const Rect bounds = commands[i].bounds.intersected(area);
+			if (bounds.isEmpty()) {
+				continue;
+			}
+			node.damage = node.damage.united(bounds);
+			for (int ty = bounds.y / TileSize; ty <= (bounds.bottom() - 1) / TileSize; ++ty) {
+				for (int tx = bounds.x / TileSize; tx <= (bounds.right() - 1) / TileSize; ++tx) {
+					node.tiles[ty * tilesX + tx].push_back(static_cast<uint32_t>(i));
+				}
+			}
+		}
+	}
+
+	void CommandExecutor::executeTile(Surface &target, int tile) {
+		const Rect tileRect{(tile % tilesX) * TileSize, (tile / tilesX) * TileSize, TileSize, TileSize};
+		const Rect clip = tileRect.intersected(Rect{0, 0, target.getWidth(), target.getHeight()});
+		for (Node *node: active) {
+			auto &indices = node->tiles[tile];
+			const auto &commands = node->buffer.getCommands();
+			for (const uint32_t index: indices) {
+				executeCommand(target, node->buffer, commands[index], clip);
+			}
+			indices.clear();
+		}
+	}
+
+} // namespace pxr
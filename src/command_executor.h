@@ -0,0 +1,100 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "pxr/command_buffer.h"
+#include "pxr/surface.h"
+#include "pxr/types.h"
+
+namespace pxr {
+
+	/**
+	 * @brief Hands out per-thread command buffers and executes them tile by tile.
+	 *
+	 * Buffers live in a lock-free list. A thread looks for the buffer it owns,
+	 * otherwise claims an unowned one with a compare-and-swap, and only appends
+	 * a new buffer if every buffer is taken. execute() releases all buffers, so
+	 * the list never grows beyond the number of threads recording in one frame,
+	 * even when the app starts new threads every frame.
+	 *
+	 * execute() runs in two parallel passes. First every buffer sorts
+	 * its commands into the screen tiles they touch, preserving their order.
+	 * Then every tile runs the commands of all buffers clipped to itself.
+	 */
+	class CommandExecutor {
+	public:
+		/// Side length of a screen tile in pixels.
+		static constexpr int TileSize = 64;
+
+		/**
+		 * @param threadCount Threads used to execute, or 0 for one per hardware thread.
+		 */
+		explicit CommandExecutor(int threadCount = 0);
+
+		~CommandExecutor();
+
+		CommandExecutor(const CommandExecutor &) = delete;
+		CommandExecutor &operator=(const CommandExecutor &) = delete;
+
+		/**
+		 * @brief Returns the calling thread's buffer for the current frame.
+		 */
+		CommandBuffer &getThreadBuffer();
+
+		/**
+		 * @brief Draws every recorded command into a surface and clears the buffers.
+		 *
+		 * No thread may record while this runs.
+		 *
+		 * @return Area of the surface that was drawn to.
+		 */
+		Rect execute(Surface &target);
+
+	private:
+		/**
+		 * @brief A thread's buffer and the tile bins of its commands.
+		 */
+		struct Node {
+			std::atomic<std::thread::id> owner; ///< Thread recording into the buffer; default id if unowned.
+			CommandBuffer buffer; ///< Recorded commands.
+			std::vector<std::vector<uint32_t>> tiles; ///< Command indices per tile, in recording order.
+			Rect damage; ///< Clipped bounds of every command.
+			Node *next = nullptr; ///< Next buffer in the list.
+		};
+
+		/**
+		 * @brief Marks every buffer unowned so that any thread can claim it next frame.
+		 */
+		void release();
+
+		/**
+		 * @brief Sorts a buffer's commands into the tiles they touch.
+		 */
+		void bin(Node &node, const Rect &area);
+
+		/**
+		 * @brief Runs every command touching one tile, clipped to it.
+		 */
+		void executeTile(Surface &target, int tile);
+
+		std::atomic<Node *> head = nullptr; ///< Most recently added buffer.
+		int threadCount = 0; ///< Requested pool size.
+		std::unique_ptr<class ThreadPool> pool; ///< Created on the first frame with commands.
+		std::vector<Node *> active; ///< Buffers with commands in the current execute().
+		int tilesX = 0; ///< Tile columns of the current target.
+		int tilesY = 0; ///< Tile rows of the current target.
+	};
+
+} // namespace pxr
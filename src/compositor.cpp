@@ -0,0 +1,133 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "compositor.h"
+
+#include <algorithm>
+#include "error_handling.h"
+#include "pixel_kernels.h"
+
+namespace pxr {
+
+	Layer &Compositor::createLayer(int width, int height, int zOrder) {
+		layers.push_back(std::make_unique<Layer>(width, height, zOrder));
+		return *layers.back();
+	}
+
+	void Compositor::removeLayer(Layer &layer) {
+		auto it = std::ranges::find_if(layers, [&](const auto &owned) { return owned.get() == &layer; });
+		PXR_ASSERT(it != layers.end(), "removeLayer() called with a layer that is not in the stack.");
+
+		if (layer.isVisible()) {
+			removedDamage = removedDamage.united(layer.getBounds());
+		}
+		std::erase(drawOrder, &layer);
+		layers.erase(it);
+	}
+
+	bool Compositor::hasLayers() const { return !layers.empty(); }
+
+	const std::vector<Layer *> &Compositor::getDrawOrder() {
+		drawOrder.clear();
+		for (const auto &layer: layers) {
+			drawOrder.push_back(layer.get());
+		}
+		// Stable insertion sort: layers are few and rarely reordered, and unlike stable_sort it needs no buffer,
+		// so frames do not allocate.
+		for (size_t i = 1; i < drawOrder.size(); ++i) {
+			Layer *layer = drawOrder[i];
+			size_t j = i;
+			for (; j > 0 && drawOrder[j - 1]->getZOrder() > layer->getZOrder(); --j) {
+				drawOrder[j] = drawOrder[j - 1];
+			}
+			drawOrder[j] = layer;
+		}
+		return drawOrder;
+	}
+
+	void Compositor::invalidate() { invalidated = true; }
+
+	void Compositor::clearRemovedDamage() { removedDamage = Rect{}; }
+
+	bool Compositor::hasDamage() const {
+		if (invalidated || !removedDamage.isEmpty()) {
+			return true;
+		}
+		return std::ranges::any_of(layers, [](const auto &layer) { return !layer->getDamage().isEmpty(); });
+	}
+
+	Surface &Compositor::composite(Surface &base) {
+		const Rect bounds{0, 0, base.getWidth(), base.getHeight()};
+
+		Rect damage = base.getDirtyRect().united(removedDamage);
+		if (!output || output->getWidth() != bounds.width || output->getHeight() != bounds.height) {
+			output = std::make_unique<Surface>(bounds.width, bounds.height);
+			invalidated = true;
+		}
+		if (invalidated) {
+			damage = bounds;
+			invalidated = false;
+		}
+		for (const auto &layer: layers) {
+			damage = damage.united(layer->getDamage());
+		}
+		damage = damage.intersected(bounds);
+
+		if (damage.isEmpty()) {
+			return *output;
+		}
+
+		const int stride = bounds.width;
+		uint32_t *dst = output->data();
+		for (int y = damage.y; y < damage.bottom(); ++y) {
+			kernels::copyRow(dst + y * stride + damage.x, base.data() + y * stride + damage.x, damage.width);
+		}
+
+		for (Layer *layer: getDrawOrder()) {
+			if (!layer->isVisible() || layer->getOpacity8() == 0) {
+				continue;
+			}
+			const Rect area = damage.intersected(layer->getBounds());
+			if (area.isEmpty()) {
+				continue;
+			}
+
+			const Surface &src = layer->getSurface();
+			const int scale = layer->getScale();
+			const int localX = area.x - layer->getOffsetX();
+			if (scale > 1) {
+				scaledRow.resize(area.width);
+			}
+			for (int y = area.y; y < area.bottom(); ++y) {
+				const uint32_t *srcRow = src.data() + ((y - layer->getOffsetY()) / scale) * src.getWidth();
+				if (scale == 1) {
+					srcRow += localX;
+				} else {
+					// Replicate magnified pixels into a scratch row so the blend kernel stays 1:1.
+					for (int i = 0; i < area.width; ++i) {
+						scaledRow[i] = srcRow[(localX + i) / scale];
+					}
+					srcRow = scaledRow.data();
+				}
+				kernels::blendRow(dst + y * stride + area.x, srcRow, area.width, layer->getOpacity8(),
+								  layer->getBlendMode());
+			}
+		}
+
+		output->markDirty(damage);
+		base.clearDirty();
+		for (const auto &layer: layers) {
+			layer->clearDamage();
+		}
+		removedDamage = Rect{};
+
+		return *output;
+	}
+
+} // namespace pxr
@@ -0,0 +1,96 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "pxr/layer.h"
+#include "pxr/surface.h"
+
+namespace pxr {
+
+	/**
+	 * @brief Flattens the app surface and its layer stack into a single surface.
+	 *
+	 * The compositor owns the layers and an output surface. Each frame it collects
+	 * the damage reported by the base surface and every layer, and recomposites
+	 * only the bounding box of that damage. When nothing changed, compositing is a
+	 * handful of rectangle checks.
+	 */
+	class Compositor {
+	public:
+		/**
+		 * @brief Creates a new layer and adds it to the stack.
+		 * @param width Layer width in pixels.
+		 * @param height Layer height in pixels.
+		 * @param zOrder Stacking order; higher values are drawn on top.
+		 * @return A reference that stays valid until the layer is removed.
+		 */
+		Layer &createLayer(int width, int height, int zOrder);
+
+		/**
+		 * @brief Removes a layer from the stack and destroys it.
+		 * @param layer The layer to remove. Must have been created by this compositor.
+		 */
+		void removeLayer(Layer &layer);
+
+		/**
+		 * @brief Returns true if at least one layer exists.
+		 */
+		[[nodiscard]] bool hasLayers() const;
+
+		/**
+		 * @brief Returns the layers in ascending z-order (ties keep creation order).
+		 */
+		[[nodiscard]] const std::vector<Layer *> &getDrawOrder();
+
+		/**
+		 * @brief Composites the base surface and all visible layers.
+		 *
+		 * Only the union of the damaged regions is recomposited. The damage of the
+		 * base surface and of every layer is consumed, and the recomposited area is
+		 * added to the output surface's dirty region.
+		 *
+		 * @param base The app surface, drawn below every layer.
+		 * @return The composited surface, sized like the base surface.
+		 */
+		Surface &composite(Surface &base);
+
+		/**
+		 * @brief Forces the next composite() to redraw the whole output.
+		 *
+		 * Used when damage was consumed elsewhere (e.g. by GPU compositing).
+		 */
+		void invalidate();
+
+		/**
+		 * @brief Forgets the area uncovered by removed layers.
+		 *
+		 * Used after a frame was composited elsewhere (e.g. on the GPU).
+		 */
+		void clearRemovedDamage();
+
+		/**
+		 * @brief Returns true if a layer or the stack itself changed since the last composite().
+		 *
+		 * The base surface is not considered.
+		 */
+		[[nodiscard]] bool hasDamage() const;
+
+	private:
+		std::vector<std::unique_ptr<Layer>> layers; ///< Owned layers in creation order.
+		std::vector<Layer *> drawOrder; ///< Layers sorted by z-order.
+		std::unique_ptr<Surface> output; ///< Composited result.
+		Rect removedDamage; ///< Area uncovered by removed layers.
+		bool invalidated = false; ///< Whether the next composite must redraw everything.
+		std::vector<uint32_t> scaledRow; ///< Scratch row for magnified layers.
+	};
+
+} // namespace pxr
@@ -0,0 +1,117 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "cpu_features.h"
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define PXR_CPU_X86 1
+#ifdef _MSC_VER
+#include <immintrin.h>
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64) || defined(__arm__)
+#define PXR_CPU_ARM 1
+#if defined(__linux__)
+#include <sys/auxv.h>
+#endif
+#endif
+
+namespace pxr {
+
+	namespace {
+
+#ifdef PXR_CPU_X86
+		/// Registers returned by one CPUID leaf.
+		struct CpuidResult {
+			uint32_t eax = 0;
+			uint32_t ebx = 0;
+			uint32_t ecx = 0;
+			uint32_t edx = 0;
+		};
+
+		CpuidResult cpuid(uint32_t leaf, uint32_t subleaf = 0) {
+			CpuidResult result;
+#ifdef _MSC_VER
+			int registers[4];
+			__cpuidex(registers, static_cast<int>(leaf), static_cast<int>(subleaf));
+			result.eax = registers[0];
+			result.ebx = registers[1];
+			result.ecx = registers[2];
+			result.edx = registers[3];
+#else
+			__cpuid_count(leaf, subleaf, result.eax, result.ebx, result.ecx, result.edx);
+#endif
+			return result;
+		}
+
+		/// Reads XCR0, the register states the operating system saves.
+		uint64_t readXcr0() {
+#ifdef _MSC_VER
+			return _xgetbv(0);
+#else
+			uint32_t low = 0;
+			uint32_t high = 0;
+			__asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+			return (static_cast<uint64_t>(high) << 32) | low;
+#endif
+		}
+
+		CpuFeatures probe() {
+			CpuFeatures features;
+			const uint32_t maxLeaf = cpuid(0).eax;
+			if (maxLeaf < 1) {
+				return features;
+			}
+			const CpuidResult leaf1 = cpuid(1);
+			features.sse2 = (leaf1.edx & (1u << 26)) != 0;
+
+			// Wider registers are only usable if the OS enabled XSAVE and saves their state.
+			const bool osxsave = (leaf1.ecx & (1u << 27)) != 0;
+			const bool avx = (leaf1.ecx & (1u << 28)) != 0;
+			if (!osxsave || !avx || maxLeaf < 7) {
+				return features;
+			}
+			const uint64_t xcr0 = readXcr0();
+			const bool ymmState = (xcr0 & 0x6) == 0x6; // SSE and AVX state.
+			const bool zmmState = (xcr0 & 0xE6) == 0xE6; // Plus opmask and both halves of the ZMM registers.
+
+			const CpuidResult leaf7 = cpuid(7);
+			features.avx2 = ymmState && (leaf7.ebx & (1u << 5)) != 0;
+			const bool avx512f = (leaf7.ebx & (1u << 16)) != 0;
+			const bool avx512bw = (leaf7.ebx & (1u << 30)) != 0;
+			features.avx512bw = features.avx2 && zmmState && avx512f && avx512bw;
+			return features;
+		}
+#elif defined(PXR_CPU_ARM)
+		CpuFeatures probe() {
+			CpuFeatures features;
+#if defined(__aarch64__) || defined(_M_ARM64)
+			features.neon = true; // Advanced SIMD is part of the 64-bit architecture.
+#elif defined(__linux__) && defined(__ARM_NEON)
+			constexpr unsigned long HwcapNeon = 1ul << 12; // HWCAP_NEON on 32-bit ARM.
+			features.neon = (getauxval(AT_HWCAP) & HwcapNeon) != 0;
+#endif
+			return features;
+		}
+#else
+		CpuFeatures probe() { return {}; }
+#endif
+
+	} // namespace
+
+	const CpuFeatures &getCpuFeatures() {
+		static const CpuFeatures features = probe();
+		return features;
+	}
+
+} // namespace pxr
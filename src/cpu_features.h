@@ -0,0 +1,32 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+namespace pxr {
+
+	/**
+	 * @brief Instruction set extensions the pixel kernels can use on this machine.
+	 *
+	 * An extension is only reported when both the CPU and the operating system
+	 * support it; AVX registers, for example, must also be saved on context switches.
+	 */
+	struct CpuFeatures {
+		bool sse2 = false; ///< x86 SSE2.
+		bool avx2 = false; ///< x86 AVX2.
+		bool avx512bw = false; ///< x86 AVX-512 Foundation and Byte/Word instructions.
+		bool neon = false; ///< ARM Advanced SIMD.
+	};
+
+	/**
+	 * @brief Returns the features of the CPU, probed with CPUID or the ELF auxiliary vector on first use.
+	 */
+	const CpuFeatures &getCpuFeatures();
+
+} // namespace pxr
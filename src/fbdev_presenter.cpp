@@ -0,0 +1,173 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "fbdev_presenter.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <linux/fb.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "error_handling.h"
+#include "pxr/pixel_format.h"
+
+namespace pxr {
+
+	FbdevPresenter::FbdevPresenter() {
+		const char *path = std::getenv("PXR_FBDEV");
+		devicePath = path && *path ? path : "/dev/fb0";
+	}
+
+	FbdevPresenter::~FbdevPresenter() {
+		if (mapping) {
+			munmap(mapping, mappingSize);
+		}
+		if (fd >= 0) {
+			close(fd);
+		}
+	}
+
+	void FbdevPresenter::initialize(Window &, const Surface &surface, int pixelSize) {
+		const char *mode = std::getenv("PXR_FBDEV_MODE");
+		if (mode && *mode) {
+			openFake(mode);
+		} else {
+			openDevice();
+		}
+
+		// Start from a black screen on every page.
+		std::memset(mapping, 0, mappingSize);
+
+		shadowWidth = std::min(screenWidth, surface.getWidth() * pixelSize);
+		shadowHeight = std::min(screenHeight, surface.getHeight() * pixelSize);
+		shadow.assign(static_cast<size_t>(shadowWidth) * shadowHeight, 0);
+		setTarget(shadow.data(), shadowWidth, shadowWidth, shadowHeight, pixelSize);
+	}
+
+	void FbdevPresenter::openDevice() {
+		fd = open(devicePath.c_str(), O_RDWR | O_CLOEXEC);
+		PXR_ASSERT(fd >= 0, ("Failed to open framebuffer device " + devicePath).c_str());
+
+		fb_var_screeninfo var{};
+		PXR_ASSERT(ioctl(fd, FBIOGET_VSCREENINFO, &var) == 0, "Failed to query framebuffer device.");
+
+		// Ask for a virtual screen two pages tall; drivers that cannot pan simply refuse.
+		if (var.yres_virtual < var.yres * 2) {
+			fb_var_screeninfo doubled = var;
+			doubled.yres_virtual = var.yres * 2;
+			if (ioctl(fd, FBIOPUT_VSCREENINFO, &doubled) == 0) {
+				ioctl(fd, FBIOGET_VSCREENINFO, &var);
+			}
+		}
+
+		fb_fix_screeninfo fix{};
+		PXR_ASSERT(ioctl(fd, FBIOGET_FSCREENINFO, &fix) == 0, "Failed to query framebuffer device.");
+
+		if (var.bits_per_pixel == 32 && var.red.offset == 16 && var.blue.offset == 0) {
+			format = PixelFormat::Argb8888;
+		} else if (var.bits_per_pixel == 32 && var.red.offset == 0 && var.blue.offset == 16) {
+			format = PixelFormat::Abgr8888;
+		} else if (var.bits_per_pixel == 24 && var.red.offset == 16 && var.blue.offset == 0) {
+			format = PixelFormat::Bgr888;
+		} else if (var.bits_per_pixel == 24 && var.red.offset == 0 && var.blue.offset == 16) {
+			format = PixelFormat::Rgb888;
+		} else if (var.bits_per_pixel == 16 && var.red.offset == 11 && var.green.length == 6 && var.blue.offset == 0) {
+			format = PixelFormat::Rgb565;
+		} else if (var.bits_per_pixel == 16 && var.red.offset == 10 && var.green.length == 5 && var.blue.offset == 0) {
+			format = PixelFormat::Rgb555;
+		} else {
+			PXR_ASSERT(false, "Unsupported framebuffer pixel format.");
+		}
+
+		bytesPerPixel = static_cast<int>(var.bits_per_pixel / 8);
+		lineLength = fix.line_length;
+		screenWidth = static_cast<int>(var.xres);
+		screenHeight = static_cast<int>(var.yres);
+		originX = static_cast<int>(var.xoffset);
+		mappingSize = fix.smem_len;
+
+		const bool canFlip = var.yres_virtual >= var.yres * 2 && fix.ypanstep > 0 &&
+							 var.yres % fix.ypanstep == 0 && lineLength * var.yres * 2 <= mappingSize;
+		pageCount = canFlip ? 2 : 1;
+		frontPage = canFlip && var.yoffset >= var.yres ? 1 : 0;
+
+		void *memory = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		PXR_ASSERT(memory != MAP_FAILED, "Failed to map framebuffer memory.");
+		mapping = static_cast<uint8_t *>(memory);
+		if (!canFlip) {
+			// Single page: draw into whatever part of the virtual screen is visible.
+			firstPageOffset = static_cast<size_t>(var.yoffset) * lineLength;
+		}
+	}
+
+	void FbdevPresenter::openFake(const std::string &mode) {
+		int width = 0;
+		int height = 0;
+		int bpp = 32;
+		const int fields = std::sscanf(mode.c_str(), "%dx%d@%d", &width, &height, &bpp);
+		PXR_ASSERT(fields >= 2 && width > 0 && height > 0, "PXR_FBDEV_MODE must look like 640x480 or 640x480@16.");
+		PXR_ASSERT(bpp == 16 || bpp == 24 || bpp == 32, "PXR_FBDEV_MODE depth must be 16, 24 or 32.");
+
+		format = bpp == 32 ? PixelFormat::Argb8888 : bpp == 24 ? PixelFormat::Bgr888 : PixelFormat::Rgb565;
+		bytesPerPixel = bpp / 8;
+		lineLength = static_cast<size_t>(width) * bytesPerPixel;
+		screenWidth = width;
+		screenHeight = height;
+		mappingSize = lineLength * height;
+
+		fd = open(devicePath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+		PXR_ASSERT(fd >= 0, ("Failed to open fake framebuffer " + devicePath).c_str());
+		PXR_ASSERT(ftruncate(fd, static_cast<off_t>(mappingSize)) == 0, "Failed to size fake framebuffer.");
+
+		void *memory = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		PXR_ASSERT(memory != MAP_FAILED, "Failed to map fake framebuffer.");
+		mapping = static_cast<uint8_t *>(memory);
+	}
+
+	void FbdevPresenter::flush(const Rect &damage) {
+		if (pageCount == 1) {
+			convert(damage, 0);
+			return;
+		}
+
+		// The hidden page is one frame behind: bring it up to date, then show it.
+		const int backPage = 1 - frontPage;
+		convert(damage.united(previousDamage), backPage);
+		previousDamage = damage;
+
+		fb_var_screeninfo var{};
+		if (ioctl(fd, FBIOGET_VSCREENINFO, &var) == 0) {
+			var.yoffset = static_cast<uint32_t>(backPage * screenHeight);
+			if (ioctl(fd, FBIOPAN_DISPLAY, &var) == 0) {
+				frontPage = backPage;
+				return;
+			}
+		}
+		// Panning failed after all: keep drawing into the visible page.
+		firstPageOffset += static_cast<size_t>(frontPage) * screenHeight * lineLength;
+		pageCount = 1;
+		frontPage = 0;
+		convert(Rect{0, 0, shadowWidth, shadowHeight}, 0);
+	}
+
+	void FbdevPresenter::convert(const Rect &rect, int page) {
+		uint8_t *base = mapping + firstPageOffset + static_cast<size_t>(page) * screenHeight * lineLength +
+						static_cast<size_t>(originX + rect.x) * bytesPerPixel;
+		for (int y = rect.y; y < rect.bottom(); ++y) {
+			const uint32_t *src = shadow.data() + static_cast<size_t>(y) * shadowWidth + rect.x;
+			uint8_t *dst = base + static_cast<size_t>(y) * lineLength;
+			pixels::convertRow(dst, format, src, PixelFormat::Argb8888, rect.width);
+		}
+	}
+
+} // namespace pxr
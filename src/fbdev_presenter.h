@@ -0,0 +1,89 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "pxr/pixel_format.h"
+#include "software_presenter.h"
+
+namespace pxr {
+
+	/**
+	 * @brief Writes frames straight into a Linux framebuffer device.
+	 *
+	 * Opens the device named by the `PXR_FBDEV` environment variable, or
+	 * `/dev/fb0`, and presents without any window system or GPU driver. Frames
+	 * are scaled into a shadow buffer in system memory; each present converts
+	 * only the damaged region to the device format (XRGB8888, XBGR8888, BGR888 or
+	 * RGB565) and writes it to the framebuffer, which is never read back. When
+	 * the device can pan across a virtual screen twice its height, frames are
+	 * drawn into the hidden page and flipped with FBIOPAN_DISPLAY so the output
+	 * never tears.
+	 *
+	 * If `PXR_FBDEV_MODE` is set to `WIDTHxHEIGHT[@BPP]` (BPP is 16, 24 or 32,
+	 * default 32), `PXR_FBDEV` names a regular file that is created and used as
+	 * a single-page framebuffer of that geometry instead, for testing.
+	 * Frames are drawn at the top-left corner; the rest of the screen is cleared once.
+	 */
+	class FbdevPresenter final : public SoftwarePresenter {
+	public:
+		FbdevPresenter();
+		~FbdevPresenter() override;
+
+		FbdevPresenter(const FbdevPresenter &) = delete;
+		FbdevPresenter &operator=(const FbdevPresenter &) = delete;
+
+		void initialize(Window &window, const Surface &surface, int pixelSize) override;
+
+	protected:
+		void flush(const Rect &damage) override;
+
+	private:
+		/**
+		 * @brief Opens and maps the real device, enabling page flipping if it can pan.
+		 */
+		void openDevice();
+
+		/**
+		 * @brief Creates and maps a file-backed framebuffer described by a mode string.
+		 * @param mode Geometry in the form `WIDTHxHEIGHT[@BPP]`.
+		 */
+		void openFake(const std::string &mode);
+
+		/**
+		 * @brief Converts a region of the shadow buffer into a framebuffer page.
+		 * @param rect Region in shadow pixels.
+		 * @param page Target page index.
+		 */
+		void convert(const Rect &rect, int page);
+
+		std::string devicePath; ///< Framebuffer device (or fake file) path.
+		int fd = -1; ///< Open device descriptor.
+		uint8_t *mapping = nullptr; ///< Mapped framebuffer memory.
+		size_t mappingSize = 0; ///< Size of the mapping in bytes.
+		PixelFormat format = PixelFormat::Argb8888; ///< Device pixel layout; alpha is ignored by the display.
+		int bytesPerPixel = 4; ///< Device bytes per pixel.
+		size_t lineLength = 0; ///< Device bytes per row.
+		int screenWidth = 0; ///< Visible width in pixels.
+		int screenHeight = 0; ///< Visible height in pixels, also the page height.
+		int originX = 0; ///< Horizontal pixel offset of the visible area.
+		size_t firstPageOffset = 0; ///< Byte offset of page 0 within the mapping.
+		int pageCount = 1; ///< 2 when page flipping is available.
+		int frontPage = 0; ///< Page currently scanned out.
+		std::vector<uint32_t> shadow; ///< Scaled frame in Surface format.
+		int shadowWidth = 0; ///< Shadow width in pixels.
+		int shadowHeight = 0; ///< Shadow height in pixels.
+		Rect previousDamage; ///< Region the hidden page is missing from the last present.
+	};
+
+} // namespace pxr
@@ -0,0 +1,272 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "file_reader.h"
+
+#include <cstdlib>
+#include <string_view>
+#include "error_handling.h"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define PXR_HAS_IO_URING 1
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace pxr {
+
+#ifdef PXR_HAS_IO_URING
+
+	namespace {
+
+		/// Largest read submitted at once; the length field of an entry is 32 bits.
+		constexpr size_t MaxChunkSize = size_t{1} << 30;
+
+		int ioUringSetup(unsigned entries, io_uring_params *params) {
+			return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+		}
+
+		int ioUringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags) {
+			return static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+		}
+
+		/// Returns true if the kernel implements IORING_OP_READ (Linux 5.6 and later).
+		bool supportsRead(int fd) {
+			constexpr unsigned OpCount = 256;
+			std::vector<uint8_t> buffer(sizeof(io_uring_probe) + OpCount * sizeof(io_uring_probe_op));
+			auto *probe = reinterpret_cast<io_uring_probe *>(buffer.data());
+			if (syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, probe, OpCount) < 0) {
+				return false;
+			}
+			return probe->last_op >= IORING_OP_READ && (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED);
+		}
+
+		/// Maps one of the ring regions; returns nullptr on failure.
+		void *mapRing(int fd, size_t size, off_t offset) {
+			void *mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+			return mapping == MAP_FAILED ? nullptr : mapping;
+		}
+
+		/// Accesses a ring index shared with the kernel.
+		std::atomic_ref<unsigned> shared(unsigned *index) { return std::atomic_ref<unsigned>(*index); }
+
+	} // namespace
+
+	std::unique_ptr<FileReader> FileReader::create(unsigned queueDepth) {
+		const char *env = std::getenv("PXR_IO_URING");
+		if (env && std::string_view(env) == "0") {
+			return nullptr;
+		}
+
+		io_uring_params params{};
+		const int fd = ioUringSetup(queueDepth, &params);
+		if (fd < 0) {
+			return nullptr; // Not built into the kernel, or blocked by a seccomp policy.
+		}
+		std::unique_ptr<FileReader> reader(new FileReader());
+		reader->ringFd = fd;
+		if (!supportsRead(fd)) {
+			return nullptr;
+		}
+
+		reader->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+		reader->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		if (params.features & IORING_FEAT_SINGLE_MMAP) {
+			reader->sqRingSize = reader->cqRingSize = std::max(reader->sqRingSize, reader->cqRingSize);
+		}
+		reader->sqRing = mapRing(fd, reader->sqRingSize, IORING_OFF_SQ_RING);
+		if (!reader->sqRing) {
+			return nullptr;
+		}
+		if (params.features & IORING_FEAT_SINGLE_MMAP) {
+			reader->cqRing = reader->sqRing;
+		} else if (!(reader->cqRing = mapRing(fd, reader->cqRingSize, IORING_OFF_CQ_RING))) {
+			return nullptr;
+		}
+		reader->sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+		reader->sqes = mapRing(fd, reader->sqesSize, IORING_OFF_SQES);
+		if (!reader->sqes) {
+			return nullptr;
+		}
+
+		auto *sq = static_cast<uint8_t *>(reader->sqRing);
+		auto *cq = static_cast<uint8_t *>(reader->cqRing);
+		reader->sqHead = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+		reader->sqTail = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+		reader->sqMask = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+		reader->sqArray = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+		reader->cqHead = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+		reader->cqTail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+		reader->cqMask = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+		reader->cqes = cq + params.cq_off.cqes;
+		reader->queueDepth = params.sq_entries;
+
+		reader->completionThread = std::thread([r = reader.get()] { r->completionLoop(); });
+		return reader;
+	}
+
+	FileReader::~FileReader() {
+		if (completionThread.joinable()) {
+			std::unique_lock lock(mutex);
+			idle.wait(lock, [this] { return pending == 0; });
+
+			// A no-op without a request tells the completion thread to exit.
+			const unsigned tail = *sqTail;
+			const unsigned index = tail & sqMask;
+			auto *sqe = static_cast<io_uring_sqe *>(sqes) + index;
+			std::memset(sqe, 0, sizeof(*sqe));
+			sqe->opcode = IORING_OP_NOP;
+			sqArray[index] = index;
+			shared(sqTail).store(tail + 1, std::memory_order_release);
+			ioUringEnter(ringFd, 1, 0, 0);
+			lock.unlock();
+			completionThread.join();
+		}
+		if (sqes) {
+			munmap(sqes, sqesSize);
+		}
+		if (cqRing && cqRing != sqRing) {
+			munmap(cqRing, cqRingSize);
+		}
+		if (sqRing) {
+			munmap(sqRing, sqRingSize);
+		}
+		if (ringFd >= 0) {
+			close(ringFd);
+		}
+	}
+
+	void FileReader::read(const std::string &path, Callback callback) {
+		auto request = std::make_unique<Request>();
+		request->path = path;
+		request->callback = std::move(callback);
+
+		request->fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (request->fd < 0) {
+			complete(std::move(request), "Cannot open " + path + ": " + std::strerror(errno));
+			return;
+		}
+		struct stat info{};
+		if (fstat(request->fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+			complete(std::move(request), "Cannot read " + path + ": not a regular file");
+			return;
+		}
+		request->data.resize(static_cast<size_t>(info.st_size));
+		if (request->data.empty()) {
+			complete(std::move(request), {});
+			return;
+		}
+
+		std::lock_guard lock(mutex);
+		++pending;
+		submit(request.release());
+	}
+
+	void FileReader::submit(Request *request) {
+		if (inFlight == queueDepth) {
+			backlog.push_back(request);
+			return;
+		}
+		const unsigned tail = *sqTail; // Only written under the mutex.
+		const unsigned index = tail & sqMask;
+		auto *sqe = static_cast<io_uring_sqe *>(sqes) + index;
+		std::memset(sqe, 0, sizeof(*sqe));
+		sqe->opcode = IORING_OP_READ;
+		sqe->fd = request->fd;
+		sqe->off = request->offset;
+		sqe->addr = reinterpret_cast<uintptr_t>(request->data.data() + request->offset);
+		sqe->len = static_cast<uint32_t>(std::min(request->data.size() - request->offset, MaxChunkSize));
+		sqe->user_data = reinterpret_cast<uintptr_t>(request);
+		sqArray[index] = index;
+		shared(sqTail).store(tail + 1, std::memory_order_release);
+		++inFlight;
+		// If the kernel is busy, the entry stays queued and the completion thread submits it.
+		ioUringEnter(ringFd, 1, 0, 0);
+	}
+
+	void FileReader::completionLoop() {
+		std::vector<std::pair<std::unique_ptr<Request>, std::string>> finished;
+		bool stopping = false;
+		while (!stopping) {
+			const int result = ioUringEnter(ringFd, queueDepth, 1, IORING_ENTER_GETEVENTS);
+			PXR_ASSERT(result >= 0 || errno == EINTR || errno == EAGAIN || errno == EBUSY, "io_uring_enter() failed.");
+
+			std::unique_lock lock(mutex);
+			unsigned head = *cqHead;
+			const unsigned tail = shared(cqTail).load(std::memory_order_acquire);
+			for (; head != tail; ++head) {
+				const io_uring_cqe &cqe = static_cast<io_uring_cqe *>(cqes)[head & cqMask];
+				auto *request = reinterpret_cast<Request *>(static_cast<uintptr_t>(cqe.user_data));
+				if (!request) {
+					stopping = true;
+					continue;
+				}
+				--inFlight;
+				if (cqe.res < 0) {
+					finished.emplace_back(request, "Cannot read " + request->path + ": " + std::strerror(-cqe.res));
+				} else if (cqe.res == 0) {
+					finished.emplace_back(request, "Cannot read " + request->path + ": file shrank while reading");
+				} else if ((request->offset += static_cast<size_t>(cqe.res)) < request->data.size()) {
+					submit(request); // Short read; continue where it stopped.
+				} else {
+					finished.emplace_back(request, std::string());
+				}
+			}
+			shared(cqHead).store(head, std::memory_order_release);
+			while (!backlog.empty() && inFlight < queueDepth) {
+				Request *next = backlog.front();
+				backlog.pop_front();
+				submit(next);
+			}
+			lock.unlock();
+
+			const size_t count = finished.size();
+			for (auto &[request, error]: finished) {
+				complete(std::move(request), std::move(error));
+			}
+			finished.clear();
+			if (count > 0) {
+				lock.lock();
+				pending -= count;
+				if (pending == 0) {
+					idle.notify_all();
+				}
+			}
+		}
+	}
+
+	void FileReader::complete(std::unique_ptr<Request> request, std::string error) {
+		if (request->fd >= 0) {
+			close(request->fd);
+		}
+		if (!error.empty()) {
+			request->data.clear();
+		}
+		request->callback(std::move(request->data), std::move(error));
+	}
+
+#else
+
+	std::unique_ptr<FileReader> FileReader::create(unsigned) { return nullptr; }
+
+	FileReader::~FileReader() = default;
+
+	void FileReader::read(const std::string &, Callback) { PXR_ASSERT(false, "io_uring requires Linux."); }
+
+#endif
+
+} // namespace pxr
@@ -0,0 +1,123 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace pxr {
+
+	/**
+	 * @brief Reads whole files asynchronously through a Linux io_uring.
+	 *
+	 * The ring is driven with raw system calls, so no liburing is needed. Files
+	 * are opened on the calling thread; their contents are read by the kernel
+	 * without occupying a thread, and a single completion thread hands the
+	 * finished buffers to the callbacks. Reads that do not fit in the
+	 * submission queue wait in a backlog.
+	 */
+	class FileReader {
+	public:
+		/// Receives the file contents, or an error description if the read failed.
+		using Callback = std::function<void(std::vector<uint8_t> data, std::string error)>;
+
+		/**
+		 * @brief Sets up a ring if the kernel supports asynchronous reads.
+		 *
+		 * Setting the environment variable `PXR_IO_URING` to `0` disables the
+		 * ring, which makes callers use their thread-based fallback.
+		 *
+		 * @param queueDepth Reads submitted to the kernel at once.
+		 * @return A reader, or nullptr if io_uring is unavailable.
+		 */
+		static std::unique_ptr<FileReader> create(unsigned queueDepth = 64);
+
+		/**
+		 * @brief Waits for the reads in flight, then closes the ring.
+		 */
+		~FileReader();
+
+		FileReader(const FileReader &) = delete;
+		FileReader &operator=(const FileReader &) = delete;
+
+		/**
+		 * @brief Starts reading a file.
+		 *
+		 * The callback runs on the completion thread, or on the calling thread
+		 * if the file cannot be opened.
+		 *
+		 * @param path File to read.
+		 * @param callback Receives the contents.
+		 */
+		void read(const std::string &path, Callback callback);
+
+	private:
+		/**
+		 * @brief A file being read.
+		 */
+		struct Request {
+			int fd = -1; ///< Open file.
+			std::string path; ///< File name, for error messages.
+			std::vector<uint8_t> data; ///< Destination, sized to the file.
+			size_t offset = 0; ///< Bytes read so far.
+			Callback callback; ///< Receives the result.
+		};
+
+		FileReader() = default;
+
+		/**
+		 * @brief Queues the next chunk of a request; must be called with the mutex held.
+		 */
+		void submit(Request *request);
+
+		/**
+		 * @brief Waits for completions and finishes or continues their requests.
+		 */
+		void completionLoop();
+
+		/**
+		 * @brief Closes the file and hands the result to the callback.
+		 */
+		static void complete(std::unique_ptr<Request> request, std::string error);
+
+		int ringFd = -1; ///< The io_uring instance.
+		void *sqRing = nullptr; ///< Submission ring mapping.
+		size_t sqRingSize = 0; ///< Size of the submission ring mapping.
+		void *cqRing = nullptr; ///< Completion ring mapping; may equal sqRing.
+		size_t cqRingSize = 0; ///< Size of the completion ring mapping.
+		void *sqes = nullptr; ///< Submission queue entries.
+		size_t sqesSize = 0; ///< Size of the entries mapping.
+		unsigned *sqTail = nullptr; ///< Written by us, read by the kernel.
+		unsigned *sqHead = nullptr; ///< Written by the kernel.
+		unsigned sqMask = 0; ///< Ring index mask.
+		unsigned *sqArray = nullptr; ///< Ring slot to entry index.
+		unsigned *cqHead = nullptr; ///< Written by us, read by the kernel.
+		unsigned *cqTail = nullptr; ///< Written by the kernel.
+		unsigned cqMask = 0; ///< Ring index mask.
+		void *cqes = nullptr; ///< Completion queue entries.
+		unsigned queueDepth = 0; ///< Submission queue size.
+
+		std::mutex mutex; ///< Guards the submission queue and the members below.
+		std::condition_variable idle; ///< Signals that no reads are left.
+		std::deque<Request *> backlog; ///< Requests waiting for a free submission slot.
+		unsigned inFlight = 0; ///< Reads submitted and not yet completed.
+		size_t pending = 0; ///< Requests started and not yet completed.
+		std::thread completionThread; ///< Runs completionLoop().
+	};
+
+} // namespace pxr
@@ -0,0 +1,93 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "file_watcher.h"
+
+#ifdef __linux__
+#include <cstddef>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace pxr {
+
+#ifdef __linux__
+
+	namespace {
+
+		/// Events meaning a file holds new content: closed after writing, or renamed into place.
+		constexpr uint32_t ChangeEvents = IN_CLOSE_WRITE | IN_MOVED_TO;
+
+	} // namespace
+
+	FileWatcher::FileWatcher() : fd(inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) {}
+
+	FileWatcher::~FileWatcher() {
+		if (fd >= 0) {
+			close(fd);
+		}
+	}
+
+	void FileWatcher::watch(const std::string &path) {
+		if (fd < 0 || !watched.insert(path).second) {
+			return;
+		}
+		const size_t separator = path.find_last_of('/');
+		const std::string directory = separator == std::string::npos ? "." : path.substr(0, separator + 1);
+		const std::string name = separator == std::string::npos ? path : path.substr(separator + 1);
+
+		// Adding a directory again returns its existing descriptor.
+		const int descriptor = inotify_add_watch(fd, directory.c_str(), ChangeEvents);
+		if (descriptor >= 0) {
+			directories[descriptor][name].push_back(path);
+		}
+	}
+
+	std::vector<std::string> FileWatcher::poll() {
+		std::unordered_set<std::string> changed;
+		alignas(inotify_event) char buffer[4096];
+		for (;;) {
+			const ssize_t length = fd >= 0 ? read(fd, buffer, sizeof(buffer)) : -1;
+			if (length <= 0) {
+				break; // EAGAIN: no more events.
+			}
+			for (ssize_t offset = 0; offset < length;) {
+				const auto *event = reinterpret_cast<const inotify_event *>(buffer + offset);
+				offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+				if (event->mask & IN_Q_OVERFLOW) {
+					changed.insert(watched.begin(), watched.end()); // Events were lost; assume everything changed.
+					continue;
+				}
+				const auto directory = directories.find(event->wd);
+				if (event->len == 0 || directory == directories.end()) {
+					continue;
+				}
+				const auto file = directory->second.find(event->name);
+				if (file != directory->second.end()) {
+					changed.insert(file->second.begin(), file->second.end());
+				}
+			}
+		}
+		return {changed.begin(), changed.end()};
+	}
+
+#else
+
+	FileWatcher::FileWatcher() = default;
+
+	FileWatcher::~FileWatcher() = default;
+
+	void FileWatcher::watch(const std::string &path) { watched.insert(path); }
+
+	std::vector<std::string> FileWatcher::poll() { return {}; }
+
+#endif
+
+} // namespace pxr
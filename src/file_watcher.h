@@ -0,0 +1,59 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace pxr {
+
+	/**
+	 * @brief Reports files that were rewritten, using Linux inotify.
+	 *
+	 * The directory holding each file is watched rather than the file itself,
+	 * so editors that save by writing a new file and renaming it over the old
+	 * one are noticed too. On other systems the watcher reports nothing.
+	 */
+	class FileWatcher {
+	public:
+		/**
+		 * @brief Opens a non-blocking inotify instance.
+		 */
+		FileWatcher();
+
+		/**
+		 * @brief Closes the inotify instance.
+		 */
+		~FileWatcher();
+
+		FileWatcher(const FileWatcher &) = delete;
+		FileWatcher &operator=(const FileWatcher &) = delete;
+
+		/**
+		 * @brief Starts reporting changes to a file; watching it again has no effect.
+		 * @param path File path, reported back exactly as given.
+		 */
+		void watch(const std::string &path);
+
+		/**
+		 * @brief Returns the files changed since the last call, each once; never blocks.
+		 */
+		std::vector<std::string> poll();
+
+	private:
+		int fd = -1; ///< inotify instance; negative if unavailable.
+		std::unordered_set<std::string> watched; ///< Every path passed to watch().
+		/// Watched paths by directory watch descriptor and file name; one directory may be named several ways.
+		std::unordered_map<int, std::unordered_map<std::string, std::vector<std::string>>> directories;
+	};
+
+} // namespace pxr
@@ -0,0 +1,32 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "frame_pacer.h"
+
+#include <thread>
+
+namespace pxr {
+
+	void FramePacer::reset(int framesPerSecond) {
+		interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::seconds(1)) /
+				   framesPerSecond;
+		nextFrame = std::chrono::steady_clock::now();
+	}
+
+	void FramePacer::wait() {
+		nextFrame += interval;
+		const auto now = std::chrono::steady_clock::now();
+		if (nextFrame < now) {
+			nextFrame = now;
+		} else {
+			std::this_thread::sleep_until(nextFrame);
+		}
+	}
+
+} // namespace pxr
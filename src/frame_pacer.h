@@ -0,0 +1,42 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <chrono>
+
+namespace pxr {
+
+	/**
+	 * @brief Sleeps between frames to hold a fixed frame rate.
+	 *
+	 * Stands in for vsync on outputs that have no display refresh to wait for.
+	 */
+	class FramePacer {
+	public:
+		/**
+		 * @brief Starts pacing from now.
+		 * @param framesPerSecond Target frame rate.
+		 */
+		void reset(int framesPerSecond = 60);
+
+		/**
+		 * @brief Sleeps until the next frame is due.
+		 *
+		 * After a frame that overran its slot, the cadence restarts from now
+		 * instead of rushing to catch up.
+		 */
+		void wait();
+
+	private:
+		std::chrono::steady_clock::duration interval{}; ///< Time between frames.
+		std::chrono::steady_clock::time_point nextFrame; ///< Earliest start of the next frame.
+	};
+
+} // namespace pxr
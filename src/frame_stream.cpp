@@ -0,0 +1,326 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "pxr/frame_stream.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include "error_handling.h"
+#include "local_socket.h"
+#include "pixel_kernels.h"
+#include "tile_codec.h"
+
+namespace pxr {
+
+	namespace {
+
+		/// How often the worker checks for new viewers while no frames arrive.
+		constexpr auto AcceptInterval = std::chrono::milliseconds(50);
+
+		/// Grows a rectangle outwards to tile boundaries and clips it to the frame.
+		Rect alignToTiles(const Rect &rect, int width, int height) {
+			const int left = rect.x / StreamTileSize * StreamTileSize;
+			const int top = rect.y / StreamTileSize * StreamTileSize;
+			const int right = std::min((rect.right() + StreamTileSize - 1) / StreamTileSize * StreamTileSize, width);
+			const int bottom = std::min((rect.bottom() + StreamTileSize - 1) / StreamTileSize * StreamTileSize, height);
+			return Rect{left, top, right - left, bottom - top};
+		}
+
+		uint64_t hashTile(const uint32_t *pixels, int stride, int width, int height) {
+			uint64_t hash = 0xCBF29CE484222325ull;
+			for (int y = 0; y < height; ++y) {
+				hash = kernels::hashRow(pixels + static_cast<size_t>(y) * stride, width, hash);
+			}
+			return hash;
+		}
+
+		FrameStreamMessage makeHeader(uint16_t type, int width, int height, uint64_t frameNumber) {
+			FrameStreamMessage header{};
+			header.magic = FrameStreamMessage::Magic;
+			header.version = FrameStreamMessage::Version;
+			header.type = type;
+			header.width = static_cast<uint32_t>(width);
+			header.height = static_cast<uint32_t>(height);
+			header.frameNumber = frameNumber;
+			return header;
+		}
+
+		/// Appends one compressed tile to a Frame message.
+		void appendTile(std::vector<uint8_t> &message, const uint32_t *pixels, int stride, const Rect &tile) {
+			const size_t start = message.size();
+			message.resize(start + sizeof(FrameStreamTile));
+			encodeTile(message, pixels, stride, tile.width, tile.height);
+
+			FrameStreamTile header{};
+			header.x = static_cast<uint16_t>(tile.x);
+			header.y = static_cast<uint16_t>(tile.y);
+			header.width = static_cast<uint16_t>(tile.width);
+			header.height = static_cast<uint16_t>(tile.height);
+			header.encodedBytes = static_cast<uint32_t>(message.size() - start - sizeof(FrameStreamTile));
+			std::memcpy(message.data() + start, &header, sizeof(header));
+		}
+
+		/// Fills in the tile count and payload size of a finished Frame message.
+		void finishMessage(std::vector<uint8_t> &message, FrameStreamMessage header, uint32_t tileCount) {
+			header.tileCount = tileCount;
+			header.payloadBytes = static_cast<uint32_t>(message.size() - sizeof(FrameStreamMessage));
+			std::memcpy(message.data(), &header, sizeof(header));
+		}
+
+	} // namespace
+
+	//--------------------------------------------------------------------------
+	// Server
+	//--------------------------------------------------------------------------
+
+	FrameStreamServer::FrameStreamServer(const std::string &path, int width, int height, int queueCapacity) :
+		width(width), height(height), tilesX((width + StreamTileSize - 1) / StreamTileSize),
+		queueCapacity(static_cast<size_t>(queueCapacity)) {
+		PXR_ASSERT(width > 0 && height > 0, "Frame stream dimensions must be positive.");
+		PXR_ASSERT(width <= 65535 && height <= 65535, "Frame stream dimensions must fit in 16 bits.");
+		PXR_ASSERT(queueCapacity >= 1, "A frame stream queue needs at least one entry.");
+
+		listener = std::make_unique<LocalSocket>(LocalSocket::listen(path));
+		mirror.assign(static_cast<size_t>(width) * height, 0);
+
+		const int tilesY = (height + StreamTileSize - 1) / StreamTileSize;
+		tileHashes.resize(static_cast<size_t>(tilesX) * tilesY);
+
+		worker = std::thread(&FrameStreamServer::run, this);
+	}
+
+	FrameStreamServer::~FrameStreamServer() {
+		{
+			std::lock_guard lock(mutex);
+			stopping = true;
+		}
+		wakeUp.notify_one();
+		worker.join();
+	}
+
+	void FrameStreamServer::publish(const Surface &surface, const Rect &damage, uint64_t frameNumber) {
+		PXR_ASSERT(surface.getWidth() == width && surface.getHeight() == height, "Frame stream size mismatch.");
+
+		Job job;
+		{
+			std::lock_guard lock(mutex);
+			carriedDamage = carriedDamage.united(damage);
+			if (carriedDamage.isEmpty()) {
+				return;
+			}
+			if (queue.size() >= queueCapacity) {
+				++droppedFrames;
+				return;
+			}
+			job.region = alignToTiles(carriedDamage.intersected(Rect{0, 0, width, height}), width, height);
+			carriedDamage = Rect{};
+			if (!spareJobs.empty()) {
+				job.pixels = std::move(spareJobs.back().pixels);
+				spareJobs.pop_back();
+			}
+		}
+
+		// Copy outside the lock; only tiles touched by the damage leave the producer thread.
+		const Rect &region = job.region;
+		job.pixels.resize(static_cast<size_t>(region.width) * region.height);
+		for (int y = 0; y < region.height; ++y) {
+			kernels::copyRow(job.pixels.data() + static_cast<size_t>(y) * region.width,
+							 surface.data() + static_cast<size_t>(region.y + y) * width + region.x, region.width);
+		}
+		job.frameNumber = frameNumber;
+
+		{
+			std::lock_guard lock(mutex);
+			queue.push_back(std::move(job));
+		}
+		wakeUp.notify_one();
+	}
+
+	uint64_t FrameStreamServer::getDroppedFrames() const {
+		std::lock_guard lock(mutex);
+		return droppedFrames;
+	}
+
+	void FrameStreamServer::run() {
+		std::unique_lock lock(mutex);
+		while (!stopping) {
+			wakeUp.wait_for(lock, AcceptInterval, [this] { return stopping || !queue.empty(); });
+
+			lock.unlock();
+			acceptViewers();
+			lock.lock();
+
+			while (!queue.empty() && !stopping) {
+				Job job = std::move(queue.front());
+				queue.pop_front();
+
+				lock.unlock();
+				encodeJob(job);
+				lock.lock();
+
+				spareJobs.push_back(std::move(job));
+			}
+		}
+	}
+
+	void FrameStreamServer::acceptViewers() {
+		for (LocalSocket viewer = listener->accept(); viewer.isValid(); viewer = listener->accept()) {
+			FrameStreamMessage hello = makeHeader(FrameStreamMessage::Hello, width, height, 0);
+			if (!viewer.sendAll(&hello, sizeof(hello))) {
+				continue;
+			}
+
+			// Key frame: every tile of the mirror, so the viewer starts from the current image. Hashes are not
+			// kept up to date while nobody watches, so they are refreshed here as well.
+			message.assign(sizeof(FrameStreamMessage), 0);
+			uint32_t tileCount = 0;
+			for (int y = 0; y < height; y += StreamTileSize) {
+				for (int x = 0; x < width; x += StreamTileSize) {
+					const Rect tile = Rect{x, y, StreamTileSize, StreamTileSize}.intersected(Rect{0, 0, width, height});
+					const uint32_t *pixels = mirror.data() + static_cast<size_t>(y) * width + x;
+					tileHashes[(y / StreamTileSize) * tilesX + x / StreamTileSize] =
+							hashTile(pixels, width, tile.width, tile.height);
+					appendTile(message, pixels, width, tile);
+					++tileCount;
+				}
+			}
+			finishMessage(message, makeHeader(FrameStreamMessage::Frame, width, height, 0), tileCount);
+			if (viewer.sendAll(message.data(), message.size())) {
+				viewers.push_back(std::make_unique<LocalSocket>(std::move(viewer)));
+			}
+		}
+	}
+
+	void FrameStreamServer::encodeJob(const Job &job) {
+		const Rect &region = job.region;
+		for (int y = 0; y < region.height; ++y) {
+			kernels::copyRow(mirror.data() + static_cast<size_t>(region.y + y) * width + region.x,
+							 job.pixels.data() + static_cast<size_t>(y) * region.width, region.width);
+		}
+		if (viewers.empty()) {
+			return; // The key frame of the next viewer is built from the mirror.
+		}
+
+		message.assign(sizeof(FrameStreamMessage), 0);
+		uint32_t tileCount = 0;
+		for (int y = region.y; y < region.bottom(); y += StreamTileSize) {
+			for (int x = region.x; x < region.right(); x += StreamTileSize) {
+				const Rect tile = Rect{x, y, StreamTileSize, StreamTileSize}.intersected(region);
+				const uint32_t *pixels = mirror.data() + static_cast<size_t>(y) * width + x;
+				uint64_t &stored = tileHashes[(y / StreamTileSize) * tilesX + x / StreamTileSize];
+				const uint64_t hash = hashTile(pixels, width, tile.width, tile.height);
+				if (hash == stored) {
+					continue; // Damaged but repainted with identical content.
+				}
+				stored = hash;
+				appendTile(message, pixels, width, tile);
+				++tileCount;
+			}
+		}
+		if (tileCount > 0) {
+			finishMessage(message, makeHeader(FrameStreamMessage::Frame, width, height, job.frameNumber), tileCount);
+			broadcast(message);
+		}
+	}
+
+	void FrameStreamServer::broadcast(const std::vector<uint8_t> &bytes) {
+		std::erase_if(viewers, [&bytes](const std::unique_ptr<LocalSocket> &viewer) {
+			return !viewer->sendAll(bytes.data(), bytes.size());
+		});
+	}
+
+	//--------------------------------------------------------------------------
+	// Client
+	//--------------------------------------------------------------------------
+
+	FrameStreamClient::FrameStreamClient(const std::string &path) :
+		socket(std::make_unique<LocalSocket>(LocalSocket::connect(path))) {
+		FrameStreamMessage hello{};
+		const bool received = socket->receiveAll(&hello, sizeof(hello));
+		PXR_ASSERT(received, "Frame stream server closed the connection.");
+		PXR_ASSERT(hello.magic == FrameStreamMessage::Magic && hello.type == FrameStreamMessage::Hello,
+				   "Socket is not a frame stream.");
+		PXR_ASSERT(hello.version == FrameStreamMessage::Version, "Unsupported frame stream version.");
+		width = static_cast<int>(hello.width);
+		height = static_cast<int>(hello.height);
+		bytesReceived = sizeof(hello);
+	}
+
+	FrameStreamClient::~FrameStreamClient() = default;
+
+	int FrameStreamClient::getWidth() const { return width; }
+
+	int FrameStreamClient::getHeight() const { return height; }
+
+	bool FrameStreamClient::isConnected() const { return connected; }
+
+	uint64_t FrameStreamClient::getBytesReceived() const { return bytesReceived; }
+
+	bool FrameStreamClient::poll(Surface &target, uint64_t *frameNumber) {
+		PXR_ASSERT(target.getWidth() == width && target.getHeight() == height, "Target size mismatch.");
+
+		constexpr size_t ChunkSize = 64 * 1024;
+		while (connected) {
+			const size_t used = inbox.size();
+			inbox.resize(used + ChunkSize);
+			const long received = socket->receiveAvailable(inbox.data() + used, ChunkSize);
+			inbox.resize(used + static_cast<size_t>(std::max(received, 0L)));
+			if (received < 0) {
+				connected = false;
+			}
+			if (received <= 0) {
+				break;
+			}
+			bytesReceived += static_cast<uint64_t>(received);
+		}
+
+		bool applied = false;
+		size_t offset = 0;
+		while (inbox.size() - offset >= sizeof(FrameStreamMessage)) {
+			FrameStreamMessage header{};
+			std::memcpy(&header, inbox.data() + offset, sizeof(header));
+			PXR_ASSERT(header.magic == FrameStreamMessage::Magic, "Corrupt frame stream.");
+			if (inbox.size() - offset - sizeof(header) < header.payloadBytes) {
+				break; // Wait for the rest of the message.
+			}
+
+			size_t position = offset + sizeof(header);
+			const size_t end = position + header.payloadBytes;
+			for (uint32_t i = 0; i < header.tileCount; ++i) {
+				FrameStreamTile tile{};
+				PXR_ASSERT(end - position >= sizeof(tile), "Corrupt frame stream message.");
+				std::memcpy(&tile, inbox.data() + position, sizeof(tile));
+				position += sizeof(tile);
+
+				const Rect rect{tile.x, tile.y, tile.width, tile.height};
+				PXR_ASSERT(end - position >= tile.encodedBytes, "Corrupt frame stream message.");
+				PXR_ASSERT(rect.intersected(Rect{0, 0, width, height}).area() == rect.area(),
+						   "Frame stream tile lies outside the frame.");
+				const bool decoded = decodeTile(inbox.data() + position, tile.encodedBytes,
+												target.data() + static_cast<size_t>(rect.y) * width + rect.x, width,
+												rect.width, rect.height);
+				PXR_ASSERT(decoded, "Corrupt frame stream tile.");
+				position += tile.encodedBytes;
+				target.markDirty(rect);
+			}
+
+			offset += sizeof(header) + header.payloadBytes;
+			if (header.type == FrameStreamMessage::Frame) {
+				applied = true;
+				if (frameNumber) {
+					*frameNumber = header.frameNumber;
+				}
+			}
+		}
+		inbox.erase(inbox.begin(), inbox.begin() + static_cast<std::ptrdiff_t>(offset));
+		return applied;
+	}
+
+} // namespace pxr
@@ -0,0 +1,30 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "gl_presenter.h"
+#include "graphics.h"
+
+namespace pxr {
+
+	GlPresenter::GlPresenter() : graphics(std::make_unique<Graphics>()) {}
+
+	GlPresenter::~GlPresenter() = default;
+
+	void GlPresenter::initialize(Window &, const Surface &surface, int pixelSize) {
+		scale = pixelSize;
+		graphics->initialize(surface);
+	}
+
+	void GlPresenter::upload(const Surface &surface, const Rect &rect) { graphics->upload(surface, rect); }
+
+	void GlPresenter::present() { graphics->render(scale); }
+
+	Graphics *GlPresenter::getGraphics() { return graphics.get(); }
+
+} // namespace pxr
@@ -0,0 +1,40 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <memory>
+#include "presenter.h"
+
+namespace pxr {
+
+	/**
+	 * @brief Presents frames as a scaled texture through OpenGL.
+	 *
+	 * Requires a window that made a GL 3.3 core context current.
+	 */
+	class GlPresenter final : public Presenter {
+	public:
+		GlPresenter();
+		~GlPresenter() override;
+
+		void initialize(Window &window, const Surface &surface, int pixelSize) override;
+
+		void upload(const Surface &surface, const Rect &rect) override;
+
+		void present() override;
+
+		[[nodiscard]] Graphics *getGraphics() override;
+
+	private:
+		std::unique_ptr<Graphics> graphics; ///< OpenGL resources.
+		int scale = 1; ///< Pixel size passed to Graphics::render().
+	};
+
+} // namespace pxr
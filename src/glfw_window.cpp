@@ -0,0 +1,176 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "glfw_window.h"
+#include "error_handling.h"
+#include "gl_includes.h"
+#include "input.h"
+#ifdef _WIN32
+#include "platform/windows_theme.h"
+#endif
+
+#include <algorithm>
+#include <vector>
+
+namespace pxr {
+
+	namespace {
+
+		/// Number of live windows; GLFW is initialized while it is non-zero.
+		int glfwUsers = 0;
+
+		/// Live windows with an OpenGL context; new contexts join the share group of the first one.
+		std::vector<GLFWwindow *> glContexts;
+
+		/// Live windows; the input source owns the GLFW user pointer, so window callbacks look theirs up here.
+		std::vector<GlfwWindow *> liveWindows;
+
+	} // namespace
+
+	void GlfwWindow::countRefresh(GLFWwindow *handle) {
+		for (GlfwWindow *window: liveWindows) {
+			if (window->handle == handle) {
+				++window->refreshCount;
+			}
+		}
+	}
+
+	GlfwWindow::GlfwWindow(ClientApi api) : clientApi(api) {}
+
+	GlfwWindow::~GlfwWindow() { destroy(); }
+
+	void GlfwWindow::create(int w, int h, const std::string &t, bool vsync) {
+		if (glfwUsers == 0) {
+			if (clientApi == ClientApi::X11) {
+				// GLFW prefers Wayland when both are available; native X11 drawing needs an X11 window.
+				glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_X11);
+			}
+			if (!glfwInit()) {
+				PXR_ASSERT(false, "Failed to initialize GLFW");
+			}
+		}
+		++glfwUsers;
+
+		// Hints persist across windows; start from the defaults so an earlier window's hints do not leak in.
+		glfwDefaultWindowHints();
+		if (clientApi == ClientApi::OpenGL) {
+			glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+			glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+			glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+		} else {
+			glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+		}
+		glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
+
+		width = w;
+		height = h;
+		title = t;
+		vsyncEnabled = vsync;
+
+		GLFWwindow *share = clientApi == ClientApi::OpenGL && !glContexts.empty() ? glContexts.front() : nullptr;
+		handle = glfwCreateWindow(width, height, title.c_str(), nullptr, share);
+		PXR_ASSERT(handle != nullptr, "Failed to create GLFW window");
+
+#ifdef _WIN32
+		pxr::applySystemThemeToWindow(handle);
+#endif
+
+		liveWindows.push_back(this);
+		glfwSetWindowRefreshCallback(handle, [](GLFWwindow *w) { countRefresh(w); });
+		// A new framebuffer size shows nothing until the next present, so it is a refresh as well.
+		glfwSetFramebufferSizeCallback(handle, [](GLFWwindow *w, int, int) { countRefresh(w); });
+
+		if (clientApi == ClientApi::OpenGL) {
+			glContexts.push_back(handle);
+			glfwMakeContextCurrent(handle);
+
+			if (!gladLoadGLLoader((GLADloadproc) glfwGetProcAddress)) {
+				PXR_ASSERT(false, "Failed to initialize GLAD");
+			}
+		}
+
+		setVSync(vsyncEnabled);
+	}
+
+	void GlfwWindow::destroy() {
+		if (!handle) {
+			return;
+		}
+		std::erase(glContexts, handle);
+		std::erase(liveWindows, this);
+		glfwDestroyWindow(handle);
+		handle = nullptr;
+
+		if (--glfwUsers == 0) {
+			glfwTerminate();
+		}
+	}
+
+	void GlfwWindow::pollEvents() { glfwPollEvents(); }
+
+	void GlfwWindow::waitEvents(double timeout) {
+		if (timeout < 0.0) {
+			glfwWaitEvents();
+		} else {
+			glfwWaitEventsTimeout(timeout);
+		}
+	}
+
+	void GlfwWindow::swapBuffers() {
+		if (clientApi == ClientApi::OpenGL) {
+			glfwSwapBuffers(handle);
+		} else if (vsyncEnabled) {
+			pacer.wait();
+		}
+	}
+
+	void GlfwWindow::makeCurrent() {
+		if (clientApi == ClientApi::OpenGL && glfwGetCurrentContext() != handle) {
+			glfwMakeContextCurrent(handle);
+		}
+	}
+
+	void GlfwWindow::setVSync(bool enabled) {
+		vsyncEnabled = enabled;
+		if (clientApi == ClientApi::OpenGL) {
+			makeCurrent(); // The swap interval applies to the current context.
+			glfwSwapInterval(vsyncEnabled ? 1 : 0);
+		} else {
+			pacer.reset();
+		}
+	}
+
+	void GlfwWindow::setTitle(const std::string &newTitle) {
+		title = newTitle;
+		if (handle) {
+			glfwSetWindowTitle(handle, title.c_str());
+		}
+	}
+
+	void GlfwWindow::setSize(int w, int h) {
+		width = w;
+		height = h;
+		if (handle) {
+			glfwSetWindowSize(handle, width, height);
+		}
+	}
+
+	bool GlfwWindow::shouldClose() const { return glfwWindowShouldClose(handle); }
+
+	std::unique_ptr<InputSource> GlfwWindow::createInputSource(Input &input) {
+		return std::make_unique<GlfwInputSource>(handle, input);
+	}
+
+	uint64_t GlfwWindow::getRefreshCount() const { return refreshCount; }
+
+	GLFWwindow *GlfwWindow::getHandle() const { return handle; }
+
+	GlfwWindow::ClientApi GlfwWindow::getClientApi() const { return clientApi; }
+
+} // namespace pxr
@@ -0,0 +1,94 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include "frame_pacer.h"
+#include "window.h"
+
+struct GLFWwindow;
+
+namespace pxr {
+
+	/**
+	 * @brief Manages a window (and optionally an OpenGL context) using GLFW.
+	 *
+	 * Handles window creation, event polling, buffer swapping and vsync. Any
+	 * number of windows may exist at once: GLFW is initialized with the first and
+	 * terminated with the last, and every OpenGL context shares its objects with
+	 * the contexts created before it.
+	 */
+	class GlfwWindow final : public Window {
+	public:
+		/**
+		 * @brief Rendering API the window is created for.
+		 */
+		enum class ClientApi {
+			OpenGL, ///< OpenGL 3.3 core context, made current on creation.
+			X11, ///< No context; a native X11 window that presenters draw into directly.
+		};
+
+		/**
+		 * @brief Constructs a GlfwWindow object.
+		 * @param api Rendering API the window is created for.
+		 */
+		explicit GlfwWindow(ClientApi api = ClientApi::OpenGL);
+
+		/**
+		 * @brief Destroys the window, terminating GLFW if it was the last one.
+		 */
+		~GlfwWindow() override;
+
+		void create(int width, int height, const std::string &title, bool vsync) override;
+
+		void destroy() override;
+
+		void pollEvents() override;
+
+		void waitEvents(double timeout) override;
+
+		void swapBuffers() override;
+
+		void makeCurrent() override;
+
+		void setVSync(bool enabled) override;
+
+		void setTitle(const std::string &title) override;
+
+		void setSize(int width, int height) override;
+
+		[[nodiscard]] bool shouldClose() const override;
+
+		std::unique_ptr<InputSource> createInputSource(Input &input) override;
+
+		[[nodiscard]] uint64_t getRefreshCount() const override;
+
+		/**
+		 * @brief Returns the raw GLFW window handle.
+		 */
+		[[nodiscard]] GLFWwindow *getHandle() const;
+
+		/**
+		 * @brief Returns the rendering API the window was created for.
+		 */
+		[[nodiscard]] ClientApi getClientApi() const;
+
+	private:
+		/**
+		 * @brief Counts a refresh request for the window owning a GLFW handle.
+		 */
+		static void countRefresh(GLFWwindow *handle);
+
+		GLFWwindow *handle = nullptr; ///< Native GLFW window handle.
+		ClientApi clientApi; ///< Rendering API.
+		FramePacer pacer; ///< Stands in for vsync when there is no GL context.
+		uint64_t refreshCount = 0; ///< Refresh requests received from GLFW.
+	};
+
+} // namespace pxr
@@ -10,8 +10,16 @@
 #include "graphics.h"
 #include "error_handling.h"
 #include "gl_includes.h"
+#include "pixel_kernels.h"
+#include "program_cache.h"
+#include "pxr/profiler.h"
+#include "yuv_transform.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
+#include <string>
+#include <utility>
 
 namespace pxr {
 
@@ -42,6 +50,79 @@ namespace pxr {
 			}
 		)";
 
+		/// Renders NV12 planes into a layer texture of the same size, one fragment per pixel.
+		constexpr auto nv12FragmentShaderSrc = R"(
+			#version 330 core
+			out vec4 FragColor;
+
+			uniform sampler2D lumaTexture;
+			uniform sampler2D chromaTexture;
+			uniform mat3 yuvToRgb;
+			uniform vec3 yuvOffset;
+
+			void main() {
+				ivec2 p = ivec2(gl_FragCoord.xy);
+				vec3 yuv = vec3(texelFetch(lumaTexture, p, 0).r, texelFetch(chromaTexture, p / 2, 0).rg);
+				FragColor = vec4(clamp(yuvToRgb * (yuv - yuvOffset), 0.0, 1.0), 1.0);
+			}
+		)";
+
+		/// Upper bound on layers per draw; also limited by GL_MAX_TEXTURE_IMAGE_UNITS.
+		constexpr int MaxLayerTextures = 8;
+
+		constexpr auto layerFragmentHeader = R"(
+			#version 330 core
+			in vec2 TexCoord;
+			out vec4 FragColor;
+
+			uniform vec2 surfaceSize;
+			uniform int layerCount;
+			uniform sampler2D layerTextures[MAX_LAYERS];
+			uniform vec4 layerRects[MAX_LAYERS];  // x, y, width, height in surface pixels
+			uniform vec4 layerParams[MAX_LAYERS]; // opacity, blend mode, scale, unused
+
+			vec3 blendLayer(vec3 dst, vec4 src, float opacity, int mode) {
+				if (mode == 3) return mix(dst, src.rgb, opacity);         // Replace
+				float a = src.a * opacity;
+				if (mode == 1) return min(dst + src.rgb * a, vec3(1.0));   // Add
+				if (mode == 2) return dst * mix(vec3(1.0), src.rgb, a);    // Multiply
+				return mix(dst, src.rgb, a);                               // Normal
+			}
+
+			vec3 compositeLayer(vec3 dst, sampler2D tex, vec4 rect, vec4 params, vec2 p) {
+				vec2 local = p - rect.xy;
+				if (any(lessThan(local, vec2(0.0))) || any(greaterThanEqual(local, rect.zw))) return dst;
+				vec4 src = texelFetch(tex, ivec2(local / params.z), 0);
+				return blendLayer(dst, src, params.x, int(params.y));
+			}
+
+			void main() {
+				vec2 p = floor(TexCoord * surfaceSize);
+				vec3 color = vec3(0.0);
+		)";
+
+		/**
+		 * @brief Builds the layer fragment shader with one unrolled step per layer.
+		 *
+		 * GLSL 3.30 only allows sampler arrays to be indexed with constant expressions,
+		 * so each layer gets its own statement with a literal index.
+		 */
+		std::string buildLayerFragmentShader(int layerCount) {
+			std::string src = layerFragmentHeader;
+			const std::string token = "MAX_LAYERS";
+			for (auto pos = src.find(token); pos != std::string::npos; pos = src.find(token, pos)) {
+				src.replace(pos, token.size(), std::to_string(layerCount));
+			}
+
+			for (int i = 0; i < layerCount; ++i) {
+				const std::string n = std::to_string(i);
+				src += "if (" + n + " < layerCount) color = compositeLayer(color, layerTextures[" + n +
+					   "], layerRects[" + n + "], layerParams[" + n + "], p);\n";
+			}
+			src += "FragColor = vec4(color, 1.0);\n}\n";
+			return src;
+		}
+
 		unsigned int compileShader(unsigned int type, const char *source) {
 			unsigned int shader = glCreateShader(type);
 			glShaderSource(shader, 1, &source, nullptr);
@@ -54,13 +135,19 @@ namespace pxr {
 			return shader;
 		}
 
-		unsigned int createShaderProgram(const char *vertexSrc, const char *fragmentSrc) {
+		unsigned int createShaderProgram(const ProgramCache &cache, const char *vertexSrc, const char *fragmentSrc) {
+			const std::string key = cache.makeKey(vertexSrc, fragmentSrc);
+			if (const unsigned int cached = cache.load(key)) {
+				return cached;
+			}
+
 			unsigned int vertex = compileShader(GL_VERTEX_SHADER, vertexSrc);
 			unsigned int fragment = compileShader(GL_FRAGMENT_SHADER, fragmentSrc);
 			unsigned int program = glCreateProgram();
 
 			glAttachShader(program, vertex);
 			glAttachShader(program, fragment);
+			cache.prepare(program);
 			glLinkProgram(program);
 
 			int success;
@@ -70,11 +157,116 @@ namespace pxr {
 			glDeleteShader(vertex);
 			glDeleteShader(fragment);
 
+			cache.store(key, program);
 			return program;
 		}
 
 	} // namespace
 
+	/**
+	 * @brief Shader programs and quad geometry shared by every Graphics of the process.
+	 *
+	 * Created in whichever context initializes the first Graphics and deleted with
+	 * the last one; any context of the share group may delete them.
+	 */
+	struct SharedGlResources {
+		unsigned int quadVbo = 0; ///< Fullscreen quad vertices.
+		unsigned int shaderProgram = 0; ///< Shader program used for rendering.
+		unsigned int layerProgram = 0; ///< Shader program used for layer compositing.
+		unsigned int nv12Program = 0; ///< Shader program converting NV12 frames; created on first use.
+		int maxLayers = 0; ///< Layer limit, bounded by the available texture units.
+		int layerCountLoc = -1; ///< Uniform location of the layer count.
+		int surfaceSizeLoc = -1; ///< Uniform location of the base surface size.
+		int layerRectsLoc = -1; ///< Uniform location of the layer rectangles array.
+		int layerParamsLoc = -1; ///< Uniform location of the layer parameters array.
+		int yuvToRgbLoc = -1; ///< Uniform location of the NV12 color matrix.
+		int yuvOffsetLoc = -1; ///< Uniform location of the NV12 black level.
+		GLsync uploadFence = nullptr; ///< Signaled once the last fenced uploads completed.
+		bool uploadsSinceFence = false; ///< Whether uploads were issued after the last fence.
+
+		SharedGlResources() {
+			const float vertices[] = {
+					// pos       // tex
+					-1.0f, -1.0f, 0.0f, 0.0f, 1.0f, -1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, -1.0f, 1.0f, 0.0f, 1.0f,
+			};
+			glGenBuffers(1, &quadVbo);
+			glBindBuffer(GL_ARRAY_BUFFER, quadVbo);
+			glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+			PXR_PROFILE_ZONE("startup.shaders");
+			const ProgramCache cache;
+			shaderProgram = createShaderProgram(cache, vertexShaderSrc, fragmentShaderSrc);
+			createLayerProgram(cache);
+		}
+
+		~SharedGlResources() {
+			if (uploadFence) {
+				glDeleteSync(uploadFence);
+			}
+			glDeleteBuffers(1, &quadVbo);
+			glDeleteProgram(shaderProgram);
+			glDeleteProgram(layerProgram);
+			glDeleteProgram(nv12Program);
+		}
+
+		SharedGlResources(const SharedGlResources &) = delete;
+		SharedGlResources &operator=(const SharedGlResources &) = delete;
+
+		/**
+		 * @brief Returns the resources of the share group, creating them in the current context if needed.
+		 */
+		static std::shared_ptr<SharedGlResources> acquire() {
+			static std::weak_ptr<SharedGlResources> instance;
+			auto resources = instance.lock();
+			if (!resources) {
+				resources = std::make_shared<SharedGlResources>();
+				instance = resources;
+			}
+			return resources;
+		}
+
+		/**
+		 * @brief Returns the NV12 program, building it on first use; most apps never show video.
+		 */
+		unsigned int getNv12Program() {
+			if (!nv12Program) {
+				const ProgramCache cache;
+				nv12Program = createShaderProgram(cache, vertexShaderSrc, nv12FragmentShaderSrc);
+				yuvToRgbLoc = glGetUniformLocation(nv12Program, "yuvToRgb");
+				yuvOffsetLoc = glGetUniformLocation(nv12Program, "yuvOffset");
+				glUseProgram(nv12Program);
+				glUniform1i(glGetUniformLocation(nv12Program, "lumaTexture"), 0);
+				glUniform1i(glGetUniformLocation(nv12Program, "chromaTexture"), 1);
+				glUseProgram(0);
+			}
+			return nv12Program;
+		}
+
+	private:
+		void createLayerProgram(const ProgramCache &cache) {
+			int textureUnits = 0;
+			glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &textureUnits);
+			maxLayers = std::clamp(textureUnits, 1, MaxLayerTextures);
+
+			const std::string fragmentSrc = buildLayerFragmentShader(maxLayers);
+			layerProgram = createShaderProgram(cache, vertexShaderSrc, fragmentSrc.c_str());
+
+			layerCountLoc = glGetUniformLocation(layerProgram, "layerCount");
+			surfaceSizeLoc = glGetUniformLocation(layerProgram, "surfaceSize");
+			layerRectsLoc = glGetUniformLocation(layerProgram, "layerRects");
+			layerParamsLoc = glGetUniformLocation(layerProgram, "layerParams");
+
+			int units[MaxLayerTextures];
+			for (int i = 0; i < maxLayers; ++i) {
+				units[i] = i;
+			}
+			glUseProgram(layerProgram);
+			glUniform1iv(glGetUniformLocation(layerProgram, "layerTextures"), maxLayers, units);
+			glUseProgram(0);
+		}
+	};
+
 	Graphics::Graphics() = default;
 
 	Graphics::~Graphics() { destroy(); }
@@ -83,10 +275,10 @@ namespace pxr {
 		width = surface.getWidth();
 		height = surface.getHeight();
 
+		shared = SharedGlResources::acquire();
 		createTexture(width, height);
 		createPBOs();
 		createQuad();
-		createShaders();
 	}
 
 	void Graphics::createTexture(int w, int h) {
@@ -111,17 +303,10 @@ namespace pxr {
 	}
 
 	void Graphics::createQuad() {
-		float vertices[] = {
-				// pos       // tex
-				-1.0f, -1.0f, 0.0f, 0.0f, 1.0f, -1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, -1.0f, 1.0f, 0.0f, 1.0f,
-		};
-
 		glGenVertexArrays(1, &vao);
-		glGenBuffers(1, &vbo);
 
 		glBindVertexArray(vao);
-		glBindBuffer(GL_ARRAY_BUFFER, vbo);
-		glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+		glBindBuffer(GL_ARRAY_BUFFER, shared->quadVbo);
 
 		glEnableVertexAttribArray(0);
 		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void *) 0);
@@ -132,27 +317,45 @@ namespace pxr {
 		glBindVertexArray(0);
 	}
 
-	void Graphics::createShaders() { shaderProgram = createShaderProgram(vertexShaderSrc, fragmentShaderSrc); }
+	void Graphics::upload(const Surface &surface) { upload(surface, Rect{0, 0, width, height}); }
 
-	void Graphics::upload(const Surface &surface) {
+	void Graphics::upload(const Surface &surface, const Rect &rect) {
 		PXR_ASSERT(surface.getWidth() == width && surface.getHeight() == height, "Surface size mismatch.");
 
+		const Rect area = rect.intersected(Rect{0, 0, width, height});
+		if (area.isEmpty()) {
+			return;
+		}
+
 		currentPBO = (currentPBO + 1) % 2;
 		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo[currentPBO]);
 
-		void *ptr = glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+		// Copy only the rectangle, packed tightly: the upload scheduler budgets its bytes, not whole rows.
+		const auto bytes = static_cast<GLsizeiptr>(area.area()) * 4;
+		void *ptr = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, bytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
 		PXR_ASSERT(ptr != nullptr, "PBO mapping failed.");
 
-		std::memcpy(ptr, surface.data(), width * height * 4);
+		const uint32_t *src = surface.data() + static_cast<size_t>(area.y) * width + area.x;
+		auto *dst = static_cast<uint32_t *>(ptr);
+		if (area.width == width) {
+			std::memcpy(dst, src, bytes); // Full rows are contiguous in the surface.
+		} else {
+			for (int y = 0; y < area.height; ++y) {
+				kernels::copyRow(dst + static_cast<size_t>(y) * area.width, src + static_cast<size_t>(y) * width,
+								 area.width);
+			}
+		}
 		glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
 
 		glBindTexture(GL_TEXTURE_2D, texture);
-		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_BGRA, GL_UNSIGNED_BYTE, nullptr);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, area.x, area.y, area.width, area.height, GL_BGRA, GL_UNSIGNED_BYTE, nullptr);
 		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		shared->uploadsSinceFence = true;
 	}
 
 	void Graphics::render(int /*pixelSize*/) {
-		glUseProgram(shaderProgram);
+		waitForUploads();
+		glUseProgram(shared->shaderProgram);
 		glBindVertexArray(vao);
 		glBindTexture(GL_TEXTURE_2D, texture);
 
@@ -162,17 +365,346 @@ namespace pxr {
 		glUseProgram(0);
 	}
 
+	int Graphics::getMaxLayers() const { return shared ? shared->maxLayers : 0; }
+
+	bool Graphics::ensureSurfaceTexture(const Surface &surface) {
+		auto &entry = surfaceTextures[&surface];
+		if (entry.texture && entry.width == surface.getWidth() && entry.height == surface.getHeight()) {
+			return false;
+		}
+
+		if (!entry.texture) {
+			glGenTextures(1, &entry.texture);
+		}
+		entry.width = surface.getWidth();
+		entry.height = surface.getHeight();
+
+		glBindTexture(GL_TEXTURE_2D, entry.texture);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, entry.width, entry.height, 0, GL_BGRA, GL_UNSIGNED_BYTE, nullptr);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glBindTexture(GL_TEXTURE_2D, 0);
+		return true;
+	}
+
+	void Graphics::uploadSurface(const Surface &surface) {
+		if (ensureSurfaceTexture(surface)) {
+			uploadSurfaceRect(surface, Rect{0, 0, surface.getWidth(), surface.getHeight()});
+		} else {
+			uploadSurfaceRect(surface, surface.getDirtyRect());
+		}
+	}
+
+	void Graphics::uploadSurfaceRect(const Surface &surface, const Rect &rect) {
+		auto it = surfaceTextures.find(&surface);
+		PXR_ASSERT(it != surfaceTextures.end(), "uploadSurfaceRect() called before ensureSurfaceTexture().");
+
+		const Rect area = rect.intersected(Rect{0, 0, surface.getWidth(), surface.getHeight()});
+		if (area.isEmpty()) {
+			return;
+		}
+
+		// Upload straight from the surface rows, no packing copy.
+		glBindTexture(GL_TEXTURE_2D, it->second.texture);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, surface.getWidth());
+		glTexSubImage2D(GL_TEXTURE_2D, 0, area.x, area.y, area.width, area.height, GL_BGRA, GL_UNSIGNED_BYTE,
+						surface.data() + area.y * surface.getWidth() + area.x);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+		glBindTexture(GL_TEXTURE_2D, 0);
+		shared->uploadsSinceFence = true;
+	}
+
+	void Graphics::uploadSurfaceNv12(const Surface &surface, const YuvPlanes &planes, YuvColorSpace space) {
+		PXR_ASSERT(planes.layout == YuvLayout::Nv12, "uploadSurfaceNv12() needs NV12 planes.");
+		PXR_ASSERT(planes.width == surface.getWidth() && planes.height == surface.getHeight(),
+				   "NV12 planes and surface differ in size.");
+		PXR_ASSERT(planes.uStride % 2 == 0, "NV12 chroma rows must hold whole U, V pairs.");
+		if (planes.width <= 0 || planes.height <= 0) {
+			return;
+		}
+
+		const bool resized = ensureSurfaceTexture(surface);
+		SurfaceTexture &entry = surfaceTextures[&surface];
+		const int chromaWidth = (entry.width + 1) / 2;
+		const int chromaHeight = (entry.height + 1) / 2;
+		if (!entry.lumaTexture || resized) {
+			if (!entry.lumaTexture) {
+				glGenTextures(1, &entry.lumaTexture);
+				glGenTextures(1, &entry.chromaTexture);
+			}
+			const auto allocate = [](unsigned int plane, GLint internalFormat, GLenum format, int w, int h) {
+				glBindTexture(GL_TEXTURE_2D, plane);
+				glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, w, h, 0, format, GL_UNSIGNED_BYTE, nullptr);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+			};
+			allocate(entry.lumaTexture, GL_R8, GL_RED, entry.width, entry.height);
+			allocate(entry.chromaTexture, GL_RG8, GL_RG, chromaWidth, chromaHeight);
+			glBindTexture(GL_TEXTURE_2D, 0);
+		}
+
+		// Rows of one byte (luma) or two (chroma) are rarely 4-byte aligned.
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		glBindTexture(GL_TEXTURE_2D, entry.lumaTexture);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<int>(planes.yStride));
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, entry.width, entry.height, GL_RED, GL_UNSIGNED_BYTE, planes.y);
+		glBindTexture(GL_TEXTURE_2D, entry.chromaTexture);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<int>(planes.uStride / 2));
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, chromaWidth, chromaHeight, GL_RG, GL_UNSIGNED_BYTE, planes.u);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+		int previousFramebuffer = 0;
+		int viewport[4];
+		glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previousFramebuffer);
+		glGetIntegerv(GL_VIEWPORT, viewport);
+		if (!entry.framebuffer) {
+			// The attachment survives resizes: ensureSurfaceTexture() keeps the texture name.
+			glGenFramebuffers(1, &entry.framebuffer);
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, entry.framebuffer);
+			glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, entry.texture, 0);
+		} else {
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, entry.framebuffer);
+		}
+		glViewport(0, 0, entry.width, entry.height);
+
+		const YuvTransform transform = getYuvTransform(space);
+		glUseProgram(shared->getNv12Program());
+		glUniformMatrix3fv(shared->yuvToRgbLoc, 1, GL_TRUE, &transform.toRgb[0][0]);
+		glUniform3fv(shared->yuvOffsetLoc, 1, transform.offset);
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, entry.lumaTexture);
+		glActiveTexture(GL_TEXTURE1);
+		glBindTexture(GL_TEXTURE_2D, entry.chromaTexture);
+
+		glBindVertexArray(vao);
+		glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+		glBindVertexArray(0);
+
+		glBindTexture(GL_TEXTURE_2D, 0);
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, 0);
+		glUseProgram(0);
+		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, previousFramebuffer);
+		glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+		shared->uploadsSinceFence = true;
+	}
+
+	void Graphics::releaseSurface(const Surface &surface) {
+		auto it = surfaceTextures.find(&surface);
+		if (it != surfaceTextures.end()) {
+			deleteSurfaceTexture(it->second);
+			surfaceTextures.erase(it);
+		}
+	}
+
+	void Graphics::deleteSurfaceTexture(SurfaceTexture &entry) {
+		glDeleteTextures(1, &entry.texture);
+		if (entry.lumaTexture) {
+			const unsigned int planes[] = {entry.lumaTexture, entry.chromaTexture};
+			glDeleteTextures(2, planes);
+		}
+		if (entry.framebuffer) {
+			glDeleteFramebuffers(1, &entry.framebuffer);
+		}
+		entry = {};
+	}
+
+	void Graphics::clearLayers() { layerDraws.clear(); }
+
+	void Graphics::addLayer(const LayerDraw &layer) {
+		PXR_ASSERT(static_cast<int>(layerDraws.size()) < getMaxLayers(), "Too many layers for a single GPU composite.");
+		layerDraws.push_back(layer);
+	}
+
+	void Graphics::renderLayers() {
+		float rects[MaxLayerTextures * 4];
+		float params[MaxLayerTextures * 4];
+		const int count = static_cast<int>(layerDraws.size());
+
+		for (int i = 0; i < count; ++i) {
+			const LayerDraw &layer = layerDraws[i];
+			auto it = surfaceTextures.find(layer.surface);
+			PXR_ASSERT(it != surfaceTextures.end(), "Layer surface was never uploaded.");
+
+			rects[i * 4 + 0] = static_cast<float>(layer.x);
+			rects[i * 4 + 1] = static_cast<float>(layer.y);
+			rects[i * 4 + 2] = static_cast<float>(it->second.width * layer.scale);
+			rects[i * 4 + 3] = static_cast<float>(it->second.height * layer.scale);
+			params[i * 4 + 0] = layer.opacity;
+			params[i * 4 + 1] = static_cast<float>(static_cast<int>(layer.blendMode));
+			params[i * 4 + 2] = static_cast<float>(layer.scale);
+			params[i * 4 + 3] = 0.0f;
+
+			glActiveTexture(GL_TEXTURE0 + i);
+			glBindTexture(GL_TEXTURE_2D, it->second.texture);
+		}
+
+		waitForUploads();
+		glUseProgram(shared->layerProgram);
+		glUniform1i(shared->layerCountLoc, count);
+		glUniform2f(shared->surfaceSizeLoc, static_cast<float>(width), static_cast<float>(height));
+		if (count > 0) {
+			glUniform4fv(shared->layerRectsLoc, count, rects);
+			glUniform4fv(shared->layerParamsLoc, count, params);
+		}
+
+		glBindVertexArray(vao);
+		glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+		glBindVertexArray(0);
+
+		for (int i = count - 1; i >= 0; --i) {
+			glActiveTexture(GL_TEXTURE0 + i);
+			glBindTexture(GL_TEXTURE_2D, 0);
+		}
+		glUseProgram(0);
+	}
+
+	void Graphics::setReadbackCallback(ReadbackCallback callback, int ringSize) {
+		PXR_ASSERT(ringSize > 0, "Readback ring size must be positive.");
+		pollReadbacks(true);
+		destroyReadbacks();
+
+		readbackCallback = std::move(callback);
+		if (!readbackCallback) {
+			return;
+		}
+
+		readbackRing.resize(ringSize);
+		for (auto &slot: readbackRing) {
+			glGenBuffers(1, &slot.pbo);
+		}
+	}
+
+	void Graphics::captureFrame(uint64_t frameNumber) {
+		if (!readbackCallback) {
+			return;
+		}
+
+		pollReadbacks();
+		if (readbackCount == static_cast<int>(readbackRing.size())) {
+			++droppedReadbacks;
+			return;
+		}
+
+		int viewport[4];
+		glGetIntegerv(GL_VIEWPORT, viewport);
+
+		ReadbackSlot &slot = readbackRing[(readbackHead + readbackCount) % readbackRing.size()];
+		const auto bytes = static_cast<GLsizeiptr>(viewport[2]) * viewport[3] * 4;
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+		if (slot.width != viewport[2] || slot.height != viewport[3]) {
+			glBufferData(GL_PIXEL_PACK_BUFFER, bytes, nullptr, GL_STREAM_READ);
+			slot.width = viewport[2];
+			slot.height = viewport[3];
+		}
+		glReadPixels(viewport[0], viewport[1], slot.width, slot.height, GL_BGRA, GL_UNSIGNED_BYTE, nullptr);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+		slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		slot.frameNumber = frameNumber;
+		++readbackCount;
+	}
+
+	void Graphics::pollReadbacks(bool wait) {
+		while (readbackCount > 0) {
+			ReadbackSlot &slot = readbackRing[readbackHead];
+			auto fence = static_cast<GLsync>(slot.fence);
+
+			// Flush on the first check so the fence is guaranteed to signal eventually.
+			const GLuint64 timeout = wait ? 1'000'000'000ull : 0;
+			const GLenum status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+			if (status == GL_TIMEOUT_EXPIRED && !wait) {
+				return;
+			}
+			PXR_ASSERT(status != GL_WAIT_FAILED, "Waiting for a readback fence failed.");
+
+			deliverReadback(slot);
+			readbackHead = (readbackHead + 1) % static_cast<int>(readbackRing.size());
+			--readbackCount;
+		}
+	}
+
+	uint64_t Graphics::getDroppedReadbacks() const { return droppedReadbacks; }
+
+	void Graphics::deliverReadback(ReadbackSlot &slot) {
+		glDeleteSync(static_cast<GLsync>(slot.fence));
+		slot.fence = nullptr;
+
+		if (!readbackFrame || readbackFrame->getWidth() != slot.width || readbackFrame->getHeight() != slot.height) {
+			readbackFrame = std::make_unique<Surface>(slot.width, slot.height);
+		}
+
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+		const auto bytes = static_cast<GLsizeiptr>(slot.width) * slot.height * 4;
+		const auto *pixels =
+				static_cast<const uint32_t *>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, bytes, GL_MAP_READ_BIT));
+		PXR_ASSERT(pixels != nullptr, "Readback PBO mapping failed.");
+
+		// OpenGL rows start at the bottom; surfaces start at the top.
+		uint32_t *dst = readbackFrame->data();
+		for (int y = 0; y < slot.height; ++y) {
+			kernels::copyRow(dst + y * slot.width, pixels + (slot.height - 1 - y) * slot.width, slot.width);
+		}
+		glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+		readbackFrame->markDirty();
+		readbackCallback(*readbackFrame, slot.frameNumber);
+	}
+
+	void Graphics::destroyReadbacks() {
+		for (auto &slot: readbackRing) {
+			if (slot.fence) {
+				glDeleteSync(static_cast<GLsync>(slot.fence));
+			}
+			if (slot.pbo) {
+				glDeleteBuffers(1, &slot.pbo);
+			}
+		}
+		readbackRing.clear();
+		readbackHead = readbackCount = 0;
+	}
+
 	void Graphics::resize(const Surface &surface) {
 		if (surface.getWidth() == width && surface.getHeight() == height)
 			return;
 
+		// Keep frame readback running across the resize.
+		pollReadbacks(true);
+		auto callback = std::move(readbackCallback);
+		const auto ringSize = static_cast<int>(readbackRing.size());
+
 		destroy();
 		width = surface.getWidth();
 		height = surface.getHeight();
 		initialize(surface);
+
+		if (callback) {
+			setReadbackCallback(std::move(callback), ringSize);
+		}
+	}
+
+	void Graphics::fenceUploads() {
+		if (!shared || !shared->uploadsSinceFence) {
+			return;
+		}
+		if (shared->uploadFence) {
+			glDeleteSync(shared->uploadFence);
+		}
+		shared->uploadFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		shared->uploadsSinceFence = false;
+		glFlush(); // Other contexts can only wait on a fence that has been submitted.
+	}
+
+	void Graphics::waitForUploads() {
+		if (shared->uploadFence) {
+			glWaitSync(shared->uploadFence, 0, GL_TIMEOUT_IGNORED);
+		}
 	}
 
 	void Graphics::destroy() {
+		destroyReadbacks();
 		if (texture) {
 			glDeleteTextures(1, &texture);
 		}
@@ -182,15 +714,14 @@ namespace pxr {
 		if (vao) {
 			glDeleteVertexArrays(1, &vao);
 		}
-		if (vbo) {
-			glDeleteBuffers(1, &vbo);
-		}
-		if (shaderProgram) {
-			glDeleteProgram(shaderProgram);
+		for (auto &[surface, entry]: surfaceTextures) {
+			deleteSurfaceTexture(entry);
 		}
+		surfaceTextures.clear();
 
-		texture = vao = vbo = shaderProgram = 0;
+		texture = vao = 0;
 		pbo[0] = pbo[1] = 0;
+		shared.reset();
 	}
 
 } // namespace pxr
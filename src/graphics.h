@@ -9,16 +9,40 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "pxr/layer.h"
 #include "pxr/surface.h"
 #include "pxr/types.h"
+#include "pxr/yuv.h"
 
 namespace pxr {
 
+	/**
+	 * @brief Describes how one surface is placed in a GPU layer composite.
+	 */
+	struct LayerDraw {
+		const Surface *surface = nullptr; ///< Surface whose texture is sampled.
+		int x = 0; ///< X offset in base surface pixels.
+		int y = 0; ///< Y offset in base surface pixels.
+		int scale = 1; ///< Integer magnification factor.
+		float opacity = 1.0f; ///< Opacity in the range [0, 1].
+		BlendMode blendMode = BlendMode::Normal; ///< How the layer combines with those below.
+	};
+
 	/**
 	 * @brief Handles GPU-side rendering of pixel data from a Surface.
 	 *
 	 * The Graphics class manages OpenGL texture creation, PBOs for asynchronous
 	 * data transfer, shader compilation, and rendering of a fullscreen quad.
+	 *
+	 * Every OpenGL window of the process shares one context share group, so the
+	 * shader programs and the quad vertex buffer are created once and shared by
+	 * all Graphics instances. Textures and buffers of one instance may be written
+	 * from any context of the group; see fenceUploads().
 	 */
 	class Graphics {
 	public:
@@ -51,6 +75,18 @@ namespace pxr {
 		 */
 		void upload(const Surface &surface);
 
+		/**
+		 * @brief Uploads a rectangle of a surface to the GPU texture.
+		 *
+		 * Only the rectangle is copied into the next PBO, packed row after row, so
+		 * the bytes moved match what the upload scheduler budgets. Rectangles
+		 * spanning whole rows are copied in one contiguous block.
+		 *
+		 * @param surface The surface to upload. Must match the size used in initialize().
+		 * @param rect The region to transfer, clipped to the surface bounds.
+		 */
+		void upload(const Surface &surface, const Rect &rect);
+
 		/**
 		 * @brief Renders the uploaded texture to the screen.
 		 *
@@ -67,7 +103,175 @@ namespace pxr {
 		 */
 		void resize(const Surface &surface);
 
+		/**
+		 * @brief Makes the uploads issued so far visible to the other contexts of the share group.
+		 *
+		 * Call after uploading, in the uploading context, when other windows will
+		 * draw textures written there. Their render calls wait on the GPU (not the
+		 * CPU) for the uploads to land.
+		 */
+		void fenceUploads();
+
+		//--------------------------------------------------------------------------
+		// Layer Compositing
+		//--------------------------------------------------------------------------
+
+		/**
+		 * @brief Returns the maximum number of layers renderLayers() can draw in one pass.
+		 */
+		[[nodiscard]] int getMaxLayers() const;
+
+		/**
+		 * @brief Makes sure a layer texture matching the surface size exists.
+		 *
+		 * A texture is created for each distinct surface on first use and kept until
+		 * releaseSurface() is called.
+		 *
+		 * @param surface The surface that needs a texture.
+		 * @return True if the texture was (re)created and its content is undefined.
+		 */
+		bool ensureSurfaceTexture(const Surface &surface);
+
+		/**
+		 * @brief Uploads the dirty region of a surface into its own layer texture.
+		 *
+		 * Only the surface's dirty rectangle is transferred (the whole surface if the
+		 * texture was just created), so an unchanged surface costs no bandwidth.
+		 *
+		 * @param surface The surface to upload.
+		 */
+		void uploadSurface(const Surface &surface);
+
+		/**
+		 * @brief Uploads a rectangle of a surface into its layer texture.
+		 *
+		 * The texture must already exist (see ensureSurfaceTexture()).
+		 *
+		 * @param surface The surface to upload from.
+		 * @param rect The region to transfer, clipped to the surface bounds.
+		 */
+		void uploadSurfaceRect(const Surface &surface, const Rect &rect);
+
+		/**
+		 * @brief Fills the layer texture of a surface from an NV12 frame, converting to RGB on the GPU.
+		 *
+		 * Luma and chroma go up as 8-bit textures, 1.5 bytes per pixel instead of
+		 * 4, and a fragment shader renders them into the layer texture. The
+		 * surface only names the layer and sets its size: its pixels are neither
+		 * read nor written, so the texture keeps the frame until the surface is
+		 * uploaded again. Layer::presentNv12() feeds this path and keeps the surface
+		 * out of the upload queue while it shows video.
+		 *
+		 * @param surface The surface whose layer texture receives the frame.
+		 * @param planes NV12 planes of the surface's size.
+		 * @param space Color space the frame was encoded in.
+		 */
+		void uploadSurfaceNv12(const Surface &surface, const YuvPlanes &planes, YuvColorSpace space = {});
+
+		/**
+		 * @brief Frees the layer texture associated with a surface, if any.
+		 * @param surface The surface whose texture should be destroyed.
+		 */
+		void releaseSurface(const Surface &surface);
+
+		/**
+		 * @brief Clears the list of layers to draw with renderLayers().
+		 */
+		void clearLayers();
+
+		/**
+		 * @brief Appends a layer to draw with renderLayers(). Layers are drawn in call order.
+		 * @param layer Placement of a surface previously passed to uploadSurface().
+		 */
+		void addLayer(const LayerDraw &layer);
+
+		/**
+		 * @brief Composites the queued layers to the screen in a single draw call.
+		 *
+		 * Blending, opacity, offsets and scaling are evaluated in the fragment shader.
+		 */
+		void renderLayers();
+
+		//--------------------------------------------------------------------------
+		// Frame Readback
+		//--------------------------------------------------------------------------
+
+		/// Receives a presented frame (top row first) and the frame number it was captured on.
+		using ReadbackCallback = std::function<void(const Surface &frame, uint64_t frameNumber)>;
+
+		/**
+		 * @brief Enables asynchronous readback of the rendered frames.
+		 *
+		 * Frames are copied into a ring of pixel pack buffers and delivered a few
+		 * frames later, once their fence has signaled, so capturing never stalls
+		 * the pipeline. If every buffer is still in flight the frame is skipped.
+		 *
+		 * @param callback Function receiving the frames, or nullptr to disable readback.
+		 * @param ringSize Number of frames that can be in flight at once.
+		 */
+		void setReadbackCallback(ReadbackCallback callback, int ringSize = 3);
+
+		/**
+		 * @brief Starts an asynchronous copy of the current back buffer.
+		 *
+		 * Call after rendering and before swapping buffers. Completed readbacks from
+		 * earlier frames are delivered first.
+		 *
+		 * @param frameNumber Frame number reported to the callback.
+		 */
+		void captureFrame(uint64_t frameNumber);
+
+		/**
+		 * @brief Delivers readbacks whose transfers have completed.
+		 * @param wait If true, blocks until every in-flight readback is delivered.
+		 */
+		void pollReadbacks(bool wait = false);
+
+		/**
+		 * @brief Returns the number of frames skipped because no readback buffer was free.
+		 */
+		[[nodiscard]] uint64_t getDroppedReadbacks() const;
+
 	private:
+		/**
+		 * @brief One slot of the readback ring.
+		 */
+		struct ReadbackSlot {
+			unsigned int pbo = 0; ///< Pixel pack buffer receiving the frame.
+			void *fence = nullptr; ///< Sync object signaled when the copy is done (GLsync).
+			uint64_t frameNumber = 0; ///< Frame captured in this slot.
+			int width = 0; ///< Captured width.
+			int height = 0; ///< Captured height.
+		};
+
+		/**
+		 * @brief Maps a completed slot, flips it into the delivery surface and invokes the callback.
+		 * @param slot The slot to deliver. Its fence must have signaled.
+		 */
+		void deliverReadback(ReadbackSlot &slot);
+
+		/**
+		 * @brief Deletes the readback buffers and fences.
+		 */
+		void destroyReadbacks();
+
+		/**
+		 * @brief A texture mirroring a surface used as a layer.
+		 */
+		struct SurfaceTexture {
+			unsigned int texture = 0; ///< OpenGL texture handle.
+			int width = 0; ///< Texture width.
+			int height = 0; ///< Texture height.
+			unsigned int lumaTexture = 0; ///< R8 luma plane of uploadSurfaceNv12(), created on first use.
+			unsigned int chromaTexture = 0; ///< RG8 chroma plane at half resolution.
+			unsigned int framebuffer = 0; ///< Framebuffer rendering into texture (per context, like the VAO).
+		};
+
+		/**
+		 * @brief Deletes the textures and framebuffer of a layer.
+		 */
+		static void deleteSurfaceTexture(SurfaceTexture &entry);
+
 		/**
 		 * @brief Creates an OpenGL texture of given size.
 		 * @param width Texture width.
@@ -81,14 +285,14 @@ namespace pxr {
 		void createPBOs();
 
 		/**
-		 * @brief Creates a fullscreen quad using a VAO and VBO.
+		 * @brief Creates the vertex array binding the shared quad buffer in the current context.
 		 */
 		void createQuad();
 
 		/**
-		 * @brief Compiles and links the default shader program.
+		 * @brief Makes the current context wait for uploads fenced in other contexts.
 		 */
-		void createShaders();
+		void waitForUploads();
 
 		/**
 		 * @brief Destroys all OpenGL resources.
@@ -97,9 +301,17 @@ namespace pxr {
 
 		unsigned int texture = 0; ///< OpenGL texture handle.
 		unsigned int pbo[2] = {0, 0}; ///< Pixel Buffer Objects (double-buffered).
-		unsigned int vao = 0; ///< Vertex Array Object.
-		unsigned int vbo = 0; ///< Vertex Buffer Object.
-		unsigned int shaderProgram = 0; ///< Shader program used for rendering.
+		unsigned int vao = 0; ///< Vertex Array Object (per context; VAOs cannot be shared).
+		std::shared_ptr<struct SharedGlResources> shared; ///< Programs and quad buffer of the share group.
+		std::unordered_map<const Surface *, SurfaceTexture> surfaceTextures; ///< Layer textures by surface.
+		std::vector<LayerDraw> layerDraws; ///< Layers queued for renderLayers().
+
+		ReadbackCallback readbackCallback; ///< Receiver of captured frames.
+		std::vector<ReadbackSlot> readbackRing; ///< Pack buffers in submission order.
+		int readbackHead = 0; ///< Oldest in-flight slot.
+		int readbackCount = 0; ///< Number of in-flight slots.
+		uint64_t droppedReadbacks = 0; ///< Frames skipped because the ring was full.
+		std::unique_ptr<Surface> readbackFrame; ///< Reused surface handed to the callback.
 
 		int currentPBO = 0; ///< Index of currently active PBO.
 		int width = 0; ///< Width of current texture.
@@ -0,0 +1,262 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "image_codecs.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include "pxr/pixel_format.h"
+
+namespace pxr::codecs {
+
+	namespace {
+
+		/// Largest accepted width or height; keeps width * height * 4 far from overflowing.
+		constexpr uint32_t MaxDimension = 16384;
+
+		uint32_t packPixel(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+			return (static_cast<uint32_t>(a) << 24) | (static_cast<uint32_t>(r) << 16) |
+				   (static_cast<uint32_t>(g) << 8) | b;
+		}
+
+		//--------------------------------------------------------------------------
+		// QOI
+		//--------------------------------------------------------------------------
+
+		constexpr size_t QoiHeaderSize = 14;
+		constexpr size_t QoiEndMarkerSize = 8;
+
+		bool isQoi(std::span<const uint8_t> data) {
+			return data.size() >= QoiHeaderSize && std::memcmp(data.data(), "qoif", 4) == 0;
+		}
+
+		uint32_t readBigEndian32(const uint8_t *bytes) {
+			return (static_cast<uint32_t>(bytes[0]) << 24) | (static_cast<uint32_t>(bytes[1]) << 16) |
+				   (static_cast<uint32_t>(bytes[2]) << 8) | bytes[3];
+		}
+
+		bool readQoiInfo(std::span<const uint8_t> data, ImageInfo &info, std::string &error) {
+			if (data.size() < QoiHeaderSize + QoiEndMarkerSize) {
+				error = "QOI image data is truncated";
+				return false;
+			}
+			const uint32_t width = readBigEndian32(data.data() + 4);
+			const uint32_t height = readBigEndian32(data.data() + 8);
+			const uint8_t channels = data[12];
+			if (width == 0 || height == 0 || width > MaxDimension || height > MaxDimension) {
+				error = "QOI image has unsupported dimensions";
+				return false;
+			}
+			if (channels != 3 && channels != 4) {
+				error = "QOI image has an invalid channel count";
+				return false;
+			}
+			info = ImageInfo{static_cast<int>(width), static_cast<int>(height)};
+			return true;
+		}
+
+		bool decodeQoi(std::span<const uint8_t> data, Surface &target, std::string &error) {
+			struct Rgba {
+				uint8_t r, g, b, a;
+			};
+			std::array<Rgba, 64> index{};
+			Rgba px{0, 0, 0, 255};
+			int run = 0;
+
+			uint32_t *out = target.data();
+			const size_t pixelCount = static_cast<size_t>(target.getWidth()) * target.getHeight();
+			const size_t end = data.size() - QoiEndMarkerSize;
+			size_t p = QoiHeaderSize;
+
+			for (size_t i = 0; i < pixelCount; ++i) {
+				if (run > 0) {
+					--run;
+				} else {
+					if (p >= end) {
+						error = "QOI image data is truncated";
+						return false;
+					}
+					const uint8_t op = data[p++];
+					if (op == 0xFE) {
+						if (p + 3 > end) {
+							error = "QOI image data is truncated";
+							return false;
+						}
+						px.r = data[p];
+						px.g = data[p + 1];
+						px.b = data[p + 2];
+						p += 3;
+					} else if (op == 0xFF) {
+						if (p + 4 > end) {
+							error = "QOI image data is truncated";
+							return false;
+						}
+						px = Rgba{data[p], data[p + 1], data[p + 2], data[p + 3]};
+						p += 4;
+					} else if ((op & 0xC0) == 0x00) {
+						px = index[op];
+					} else if ((op & 0xC0) == 0x40) {
+						px.r = static_cast<uint8_t>(px.r + ((op >> 4) & 0x03) - 2);
+						px.g = static_cast<uint8_t>(px.g + ((op >> 2) & 0x03) - 2);
+						px.b = static_cast<uint8_t>(px.b + (op & 0x03) - 2);
+					} else if ((op & 0xC0) == 0x80) {
+						if (p >= end) {
+							error = "QOI image data is truncated";
+							return false;
+						}
+						const int greenDiff = (op & 0x3F) - 32;
+						const uint8_t second = data[p++];
+						px.r = static_cast<uint8_t>(px.r + greenDiff - 8 + ((second >> 4) & 0x0F));
+						px.g = static_cast<uint8_t>(px.g + greenDiff);
+						px.b = static_cast<uint8_t>(px.b + greenDiff - 8 + (second & 0x0F));
+					} else {
+						run = op & 0x3F;
+					}
+					index[(px.r * 3 + px.g * 5 + px.b * 7 + px.a * 11) % 64] = px;
+				}
+				out[i] = packPixel(px.r, px.g, px.b, px.a);
+			}
+			return true;
+		}
+
+		//--------------------------------------------------------------------------
+		// Netpbm
+		//--------------------------------------------------------------------------
+
+		/**
+		 * @brief Header fields of a binary PPM or PGM file.
+		 */
+		struct NetpbmHeader {
+			int channels = 0; ///< 3 for PPM, 1 for PGM.
+			uint32_t width = 0; ///< Width in pixels.
+			uint32_t height = 0; ///< Height in pixels.
+			uint32_t maxValue = 0; ///< Largest sample value (255 or less means one byte per sample).
+			size_t dataOffset = 0; ///< Offset of the first sample.
+		};
+
+		bool isNetpbm(std::span<const uint8_t> data) {
+			return data.size() >= 2 && data[0] == 'P' && (data[1] == '5' || data[1] == '6');
+		}
+
+		/// Reads one decimal header field, skipping whitespace and comments.
+		bool readNetpbmNumber(std::span<const uint8_t> data, size_t &p, uint32_t &value) {
+			for (;;) {
+				if (p >= data.size()) {
+					return false;
+				}
+				if (data[p] == '#') {
+					while (p < data.size() && data[p] != '\n') {
+						++p;
+					}
+				} else if (data[p] == ' ' || data[p] == '\t' || data[p] == '\r' || data[p] == '\n') {
+					++p;
+				} else {
+					break;
+				}
+			}
+			value = 0;
+			size_t digits = 0;
+			while (p < data.size() && data[p] >= '0' && data[p] <= '9' && digits < 9) {
+				value = value * 10 + (data[p++] - '0');
+				++digits;
+			}
+			return digits > 0;
+		}
+
+		bool readNetpbmHeader(std::span<const uint8_t> data, NetpbmHeader &header, std::string &error) {
+			header.channels = data[1] == '6' ? 3 : 1;
+			size_t p = 2;
+			if (!readNetpbmNumber(data, p, header.width) || !readNetpbmNumber(data, p, header.height) ||
+				!readNetpbmNumber(data, p, header.maxValue) || p >= data.size()) {
+				error = "PPM/PGM header is malformed";
+				return false;
+			}
+			header.dataOffset = p + 1; // Exactly one whitespace character ends the header.
+			if (header.width == 0 || header.height == 0 || header.width > MaxDimension ||
+				header.height > MaxDimension || header.maxValue == 0 || header.maxValue > 65535) {
+				error = "PPM/PGM image has unsupported dimensions or sample range";
+				return false;
+			}
+			return true;
+		}
+
+		bool decodeNetpbm(std::span<const uint8_t> data, Surface &target, std::string &error) {
+			NetpbmHeader header;
+			if (!readNetpbmHeader(data, header, error)) {
+				return false;
+			}
+			const size_t bytesPerSample = header.maxValue > 255 ? 2 : 1;
+			const size_t pixelCount = static_cast<size_t>(header.width) * header.height;
+			if (data.size() - header.dataOffset < pixelCount * header.channels * bytesPerSample) {
+				error = "PPM/PGM image data is truncated";
+				return false;
+			}
+
+			const uint8_t *in = data.data() + header.dataOffset;
+			uint32_t *out = target.data();
+			// The common 8-bit case is a plain layout change; other ranges are rescaled sample by sample.
+			if (header.maxValue == 255) {
+				const PixelFormat format = header.channels == 3 ? PixelFormat::Rgb888 : PixelFormat::Grey8;
+				pixels::convertImage(out, header.width * sizeof(uint32_t), PixelFormat::Argb8888, in,
+									 header.width * header.channels, format, static_cast<int>(header.width),
+									 static_cast<int>(header.height));
+				return true;
+			}
+			auto sample = [&](size_t i) -> uint8_t {
+				const uint32_t value = bytesPerSample == 2 ? (in[i * 2] << 8) | in[i * 2 + 1] : in[i];
+				return static_cast<uint8_t>((std::min(value, header.maxValue) * 255 + header.maxValue / 2) /
+											header.maxValue);
+			};
+			for (size_t i = 0; i < pixelCount; ++i) {
+				if (header.channels == 3) {
+					out[i] = packPixel(sample(i * 3), sample(i * 3 + 1), sample(i * 3 + 2), 255);
+				} else {
+					const uint8_t gray = sample(i);
+					out[i] = packPixel(gray, gray, gray, 255);
+				}
+			}
+			return true;
+		}
+
+	} // namespace
+
+	bool readImageInfo(std::span<const uint8_t> data, ImageInfo &info, std::string &error) {
+		if (isQoi(data)) {
+			return readQoiInfo(data, info, error);
+		}
+		if (isNetpbm(data)) {
+			NetpbmHeader header;
+			if (!readNetpbmHeader(data, header, error)) {
+				return false;
+			}
+			info = ImageInfo{static_cast<int>(header.width), static_cast<int>(header.height)};
+			return true;
+		}
+		error = "Unsupported image format (expected QOI, binary PPM or binary PGM)";
+		return false;
+	}
+
+	bool decodeImage(std::span<const uint8_t> data, Surface &target, std::string &error) {
+		ImageInfo info;
+		if (!readImageInfo(data, info, error)) {
+			return false;
+		}
+		if (info.width != target.getWidth() || info.height != target.getHeight()) {
+			error = "Target surface does not match the image size";
+			return false;
+		}
+		const bool decoded = isQoi(data) ? decodeQoi(data, target, error) : decodeNetpbm(data, target, error);
+		if (decoded) {
+			target.markDirty();
+		}
+		return decoded;
+	}
+
+} // namespace pxr::codecs
@@ -0,0 +1,58 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include "pxr/surface.h"
+
+/**
+ * @file image_codecs.h
+ * @brief Decoders for the image files the asset loader understands.
+ *
+ * Supported formats, recognised by their signature rather than the file name:
+ * - QOI ("qoif"), RGB or RGBA
+ * - Binary PPM ("P6") and PGM ("P5"), 8 or 16 bits per channel
+ *
+ * Decoding is split in two steps so the caller can provide a surface of the
+ * right size, for example one recycled from a pool.
+ */
+
+namespace pxr::codecs {
+
+	/**
+	 * @brief Dimensions of an encoded image.
+	 */
+	struct ImageInfo {
+		int width = 0; ///< Width in pixels.
+		int height = 0; ///< Height in pixels.
+	};
+
+	/**
+	 * @brief Reads the dimensions of an encoded image.
+	 * @param data The whole file.
+	 * @param info Receives the dimensions.
+	 * @param error Receives a description if the data is not a supported image.
+	 * @return True on success.
+	 */
+	bool readImageInfo(std::span<const uint8_t> data, ImageInfo &info, std::string &error);
+
+	/**
+	 * @brief Decodes an image into a surface of the size reported by readImageInfo().
+	 * @param data The whole file.
+	 * @param target Receives the pixels; its previous content is overwritten.
+	 * @param error Receives a description if the data is corrupt.
+	 * @return True on success.
+	 */
+	bool decodeImage(std::span<const uint8_t> data, Surface &target, std::string &error);
+
+} // namespace pxr::codecs
@@ -10,29 +10,94 @@
 
 #include "input.h"
 #include "error_handling.h"
+#include "gl_includes.h"
 
 namespace pxr {
 
-	void Input::initialize(GLFWwindow *handle) {
-		PXR_ASSERT(handle, "GLFW window is null");
-		window = handle;
-	}
+	//--------------------------------------------------------------------------
+	// Input
+	//--------------------------------------------------------------------------
+
+	void Input::addSource(std::unique_ptr<InputSource> source) { sources.push_back(std::move(source)); }
 
 	void Input::poll() {
-		double x, y;
-		glfwGetCursorPos(window, &x, &y);
-		mouseX = static_cast<int>(x);
-		mouseY = static_cast<int>(y);
+		for (const auto &source: sources) {
+			source->poll(*this);
+		}
+	}
+
+	void Input::setKey(int key, bool pressed) {
+		if (key >= 0 && key < KeyCount && keys[key] != pressed) {
+			keys[key] = pressed;
+			++changeCount;
+		}
+	}
+
+	void Input::setMouseButton(int button, bool pressed) {
+		if (button >= 0 && button < MouseButtonCount && mouseButtons[button] != pressed) {
+			mouseButtons[button] = pressed;
+			++changeCount;
+		}
 	}
 
-	bool Input::isKeyPressed(KeyCode key) const { return glfwGetKey(window, static_cast<int>(key)) == GLFW_PRESS; }
+	void Input::setMousePosition(int x, int y) {
+		if (x != mouseX || y != mouseY) {
+			mouseX = x;
+			mouseY = y;
+			++changeCount;
+		}
+	}
+
+	bool Input::isKeyPressed(KeyCode key) const {
+		const int code = static_cast<int>(key);
+		return code >= 0 && code < KeyCount && keys[code];
+	}
 
 	bool Input::isMousePressed(MouseButton button) const {
-		return glfwGetMouseButton(window, static_cast<int>(button)) == GLFW_PRESS;
+		const int index = static_cast<int>(button);
+		return index >= 0 && index < MouseButtonCount && mouseButtons[index];
 	}
 
 	int Input::getMouseWindowX() const { return mouseX; }
 
 	int Input::getMouseWindowY() const { return mouseY; }
 
+	uint64_t Input::getChangeCount() const { return changeCount; }
+
+	//--------------------------------------------------------------------------
+	// GLFW Source
+	//--------------------------------------------------------------------------
+
+	GlfwInputSource::GlfwInputSource(GLFWwindow *handle, Input &input) : window(handle), target(&input) {
+		PXR_ASSERT(handle, "GLFW window is null");
+
+		glfwSetWindowUserPointer(window, this);
+		glfwSetKeyCallback(window, [](GLFWwindow *w, int key, int, int action, int) {
+			if (action != GLFW_REPEAT) {
+				static_cast<GlfwInputSource *>(glfwGetWindowUserPointer(w))->target->setKey(key, action == GLFW_PRESS);
+			}
+		});
+		glfwSetMouseButtonCallback(window, [](GLFWwindow *w, int button, int action, int) {
+			static_cast<GlfwInputSource *>(glfwGetWindowUserPointer(w))
+					->target->setMouseButton(button, action == GLFW_PRESS);
+		});
+	}
+
+	GlfwInputSource::~GlfwInputSource() {
+		glfwSetKeyCallback(window, nullptr);
+		glfwSetMouseButtonCallback(window, nullptr);
+		glfwSetWindowUserPointer(window, nullptr);
+	}
+
+	void GlfwInputSource::poll(Input &input) {
+		double x, y;
+		glfwGetCursorPos(window, &x, &y);
+		// Forward only real cursor motion, so positions injected by other sources are not overwritten every frame.
+		if (x != cursorX || y != cursorY) {
+			cursorX = x;
+			cursorY = y;
+			input.setMousePosition(static_cast<int>(x), static_cast<int>(y));
+		}
+	}
+
 } // namespace pxr
@@ -9,30 +9,84 @@
 
 #pragma once
 
-#include "gl_includes.h"
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
 #include "pxr/input_codes.h"
 
+struct GLFWwindow;
+
 namespace pxr {
 
+	class Input;
+
+	/**
+	 * @brief A producer of keyboard and mouse events feeding an Input.
+	 *
+	 * Sources either push events as they arrive (e.g. from window system callbacks)
+	 * or pull them when poll() is called once per frame.
+	 */
+	class InputSource {
+	public:
+		virtual ~InputSource() = default;
+
+		/**
+		 * @brief Delivers pending events to the input state. Called once per frame.
+		 * @param input The input state to update.
+		 */
+		virtual void poll(Input &input) = 0;
+	};
+
 	/**
-	 * @brief Handles keyboard and mouse input using GLFW.
+	 * @brief Tracks keyboard and mouse state fed by one or more input sources.
 	 *
-	 * This class provides access to key/mouse states and mouse position
-	 * in raw window-space pixel coordinates.
+	 * Every source reports events through the same setters, so queries such as
+	 * isKeyPressed() behave identically whether the events came from the window
+	 * system or were injected by another process. Mouse positions are raw
+	 * window-space pixel coordinates.
 	 */
 	class Input {
 	public:
+		/// Number of tracked key codes (matches GLFW_KEY_LAST + 1).
+		static constexpr int KeyCount = 349;
+
+		/// Number of tracked mouse buttons (matches GLFW_MOUSE_BUTTON_LAST + 1).
+		static constexpr int MouseButtonCount = 8;
+
 		/**
-		 * @brief Initializes input handling with a GLFW window.
-		 * @param handle A valid GLFW window pointer.
+		 * @brief Adds an event source. Sources are polled in the order they were added.
+		 * @param source The source to add.
 		 */
-		void initialize(GLFWwindow *handle);
+		void addSource(std::unique_ptr<InputSource> source);
 
 		/**
-		 * @brief Updates internal mouse position. Call once per frame.
+		 * @brief Polls every source. Call once per frame after processing window events.
 		 */
 		void poll();
 
+		/**
+		 * @brief Records a key press or release.
+		 * @param key The key code. Unknown or out-of-range codes are ignored.
+		 * @param pressed True if the key is down.
+		 */
+		void setKey(int key, bool pressed);
+
+		/**
+		 * @brief Records a mouse button press or release.
+		 * @param button The button index. Out-of-range indices are ignored.
+		 * @param pressed True if the button is down.
+		 */
+		void setMouseButton(int button, bool pressed);
+
+		/**
+		 * @brief Records the mouse position in window-space pixels.
+		 * @param x X position.
+		 * @param y Y position.
+		 */
+		void setMousePosition(int x, int y);
+
 		/**
 		 * @brief Checks whether a keyboard key is currently pressed.
 		 * @param key The key to check.
@@ -57,10 +111,49 @@ namespace pxr {
 		 */
 		[[nodiscard]] int getMouseWindowY() const;
 
+		/**
+		 * @brief Returns a counter that increases whenever a key, button or the mouse position changes.
+		 *
+		 * Compare values across poll() calls to find out whether anything happened.
+		 */
+		[[nodiscard]] uint64_t getChangeCount() const;
+
 	private:
-		GLFWwindow *window = nullptr; ///< GLFW window pointer.
+		std::vector<std::unique_ptr<InputSource>> sources; ///< Event sources in poll order.
+		std::array<bool, KeyCount> keys{}; ///< Pressed state per key code.
+		std::array<bool, MouseButtonCount> mouseButtons{}; ///< Pressed state per mouse button.
 		int mouseX = 0; ///< Cached X mouse position in window space.
 		int mouseY = 0; ///< Cached Y mouse position in window space.
+		uint64_t changeCount = 0; ///< Number of state changes so far.
+	};
+
+	/**
+	 * @brief Input source reading keyboard and mouse events from a GLFW window.
+	 *
+	 * Key and button events arrive through GLFW callbacks while events are being
+	 * processed; the cursor position is sampled in poll() and forwarded when it moved.
+	 */
+	class GlfwInputSource final : public InputSource {
+	public:
+		/**
+		 * @brief Installs the GLFW callbacks on a window.
+		 * @param handle A valid GLFW window pointer.
+		 * @param input The input state receiving the events.
+		 */
+		GlfwInputSource(GLFWwindow *handle, Input &input);
+
+		/**
+		 * @brief Removes the GLFW callbacks.
+		 */
+		~GlfwInputSource() override;
+
+		void poll(Input &input) override;
+
+	private:
+		GLFWwindow *window = nullptr; ///< GLFW window pointer.
+		Input *target = nullptr; ///< Input receiving callback events.
+		double cursorX = std::numeric_limits<double>::quiet_NaN(); ///< Cursor position forwarded last.
+		double cursorY = std::numeric_limits<double>::quiet_NaN(); ///< NaN until the first poll().
 	};
 
 } // namespace pxr
@@ -0,0 +1,151 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include "pxr/layer.h"
+#include "pxr/pixel_format.h"
+
+/**
+ * @file kernel_table.h
+ * @brief Per-instruction-set implementations behind the functions of pixel_kernels.h.
+ *
+ * Each instruction set gets a table of function pointers. A table starts as a
+ * copy of the next narrower one and replaces the kernels it speeds up, so
+ * every entry is always valid. The functions of pixel_kernels.h call through
+ * the table chosen once for the running CPU; see selectKernels().
+ */
+
+namespace pxr::kernels {
+
+	/**
+	 * @brief Instruction sets with their own kernels, narrowest first.
+	 */
+	enum class KernelPath {
+		Scalar, ///< Portable C++; the reference every other path must match bit for bit.
+		Sse2, ///< x86 SSE2.
+		Avx2, ///< x86 AVX2.
+		Avx512, ///< x86 AVX-512BW.
+		Neon, ///< ARM Advanced SIMD.
+	};
+
+	/**
+	 * @brief Fixed-point constants of one YUV color space, shared by every path.
+	 *
+	 * RGB to YUV: Y = ((weighted RGB + 2^13) >> 14) + lumaOffset, and chroma
+	 * = (weighted RGB of a 2x2 block, summed + 128 * 2^16 + 2^15) >> 16.
+	 * YUV to RGB: ((Y - lumaOffset) * yScale + chroma factors * (U or V - 128)
+	 * + 2^12) >> 13. Results are clamped to [0, 255]. Every constant fits in 16
+	 * bits, so SIMD paths multiply with 16-bit products.
+	 */
+	struct YuvCoefficients {
+		int lumaRed, lumaGreen, lumaBlue; ///< Weights of Y, 14 fraction bits.
+		int lumaOffset; ///< Y of black: 16 for limited range, 0 for full range.
+		int uRed, uGreen, uBlue; ///< Weights of U, 14 fraction bits.
+		int vRed, vGreen, vBlue; ///< Weights of V, 14 fraction bits.
+		int yScale; ///< Factor of Y - lumaOffset, 13 fraction bits.
+		int redV, greenU, greenV, blueU; ///< Chroma factors, 13 fraction bits; the green ones are negative.
+	};
+
+	/**
+	 * @brief Kernels of one instruction set. Arguments are validated by the callers in pixel_kernels.cpp.
+	 */
+	struct KernelTable {
+		const char *name; ///< Path name, as accepted by PXR_KERNELS.
+		void (*fillRow)(uint32_t *dst, uint32_t color, int count);
+		void (*blendRow)(uint32_t *dst, const uint32_t *src, int count, uint8_t opacity, BlendMode mode);
+		void (*scaleRow)(uint32_t *dst, const uint32_t *src, int count, int factor);
+		void (*swapRedBlueRow)(uint32_t *dst, const uint32_t *src, int count);
+		void (*packRgb565Row)(uint16_t *dst, const uint32_t *src, int count);
+		void (*packBgr24Row)(uint8_t *dst, const uint32_t *src, int count);
+		void (*packRgb24Row)(uint8_t *dst, const uint32_t *src, int count);
+		void (*packRgb555Row)(uint16_t *dst, const uint32_t *src, int count);
+		void (*packGrey8Row)(uint8_t *dst, const uint32_t *src, int count, LumaWeights weights);
+		void (*packRgbaF32Row)(float *dst, const uint32_t *src, int count);
+		void (*unpackBgr24Row)(uint32_t *dst, const uint8_t *src, int count);
+		void (*unpackRgb24Row)(uint32_t *dst, const uint8_t *src, int count);
+		void (*unpackRgb565Row)(uint32_t *dst, const uint16_t *src, int count);
+		void (*unpackRgb555Row)(uint32_t *dst, const uint16_t *src, int count);
+		void (*unpackGrey8Row)(uint32_t *dst, const uint8_t *src, int count);
+		void (*unpackRgbaF32Row)(uint32_t *dst, const float *src, int count);
+		void (*premultiplyRow)(uint32_t *dst, const uint32_t *src, int count);
+		void (*unpremultiplyRow)(uint32_t *dst, const uint32_t *src, int count);
+		void (*packYuvRows)(uint8_t *y0, uint8_t *y1, uint8_t *u, uint8_t *v, int chromaStep, const uint32_t *row0,
+							const uint32_t *row1, int width, const YuvCoefficients &k);
+		void (*unpackYuvRow)(uint32_t *dst, const uint8_t *y, const uint8_t *u, const uint8_t *v, int chromaStep,
+							 int width, const YuvCoefficients &k);
+		uint64_t (*hashRow)(const uint32_t *src, int count, uint64_t seed);
+	};
+
+	/**
+	 * @brief Returns the kernels of a path, or nullptr if this build or CPU cannot run it.
+	 */
+	const KernelTable *findKernels(KernelPath path);
+
+	/**
+	 * @brief Returns the kernels in use.
+	 *
+	 * Chosen on first use: the widest path the CPU supports, or the one named
+	 * by the `PXR_KERNELS` environment variable (`scalar`, `sse2`, `avx2`,
+	 * `avx512` or `neon`) if it can run here.
+	 */
+	const KernelTable &getActiveKernels();
+
+	/// Independent lanes of hashRow(); pixel i feeds lane i % HashLanes, so SIMD paths update lanes in parallel.
+	constexpr int HashLanes = 8;
+
+	/// FNV-1a 64-bit prime, 2^40 + 0x1B3; the shift-and-add form lets SIMD paths multiply with 32-bit products.
+	constexpr uint64_t HashPrime = 0x100000001B3ull;
+
+	/// Returns the start value of a hashRow() lane.
+	inline uint64_t hashLaneStart(uint64_t seed, int lane) { return seed ^ (0x9E3779B97F4A7C15ull * (lane + 1)); }
+
+	/// Adds the pixels from begin to count to their lanes, one at a time; the reference and the SIMD tails.
+	inline void hashLanes(uint64_t *lanes, const uint32_t *src, int begin, int count) {
+		for (int i = begin; i < count; ++i) {
+			lanes[i % HashLanes] = (lanes[i % HashLanes] ^ src[i]) * HashPrime;
+		}
+	}
+
+	/// Folds the lanes and the pixel count into the result of hashRow().
+	inline uint64_t hashFinish(const uint64_t *lanes, int count, uint64_t seed) {
+		uint64_t hash = seed;
+		for (int lane = 0; lane < HashLanes; ++lane) {
+			hash = (hash ^ lanes[lane]) * HashPrime;
+		}
+		return (hash ^ static_cast<uint64_t>(count)) * HashPrime;
+	}
+
+	/**
+	 * @brief Luma weights in fixed point with 14 fraction bits.
+	 *
+	 * Each set sums to exactly 1 << 14, so white stays 255 after rounding.
+	 */
+	struct LumaCoefficients {
+		int red; ///< Weight of red.
+		int green; ///< Weight of green.
+		int blue; ///< Weight of blue.
+	};
+
+	/// Returns the fixed-point weights of packGrey8Row().
+	inline LumaCoefficients getLumaCoefficients(LumaWeights weights) {
+		return weights == LumaWeights::Bt709 ? LumaCoefficients{3483, 11718, 1183} : LumaCoefficients{4899, 9617, 1868};
+	}
+
+	/// @name Tables of each path, without checking CPU support; nullptr when the build has no such path
+	/// @{
+	const KernelTable &scalarKernels();
+	const KernelTable *sse2Kernels();
+	const KernelTable *avx2Kernels();
+	const KernelTable *avx512Kernels();
+	const KernelTable *neonKernels();
+	/// @}
+
+} // namespace pxr::kernels
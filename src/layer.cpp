@@ -0,0 +1,165 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "pxr/layer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "error_handling.h"
+
+namespace pxr {
+
+	Layer::Layer(int width, int height, int zOrder) : surface(width, height, Color(0, 0, 0, 0)), zOrder(zOrder) {}
+
+	Surface &Layer::getSurface() { return surface; }
+
+	const Surface &Layer::getSurface() const { return surface; }
+
+	void Layer::presentNv12(const YuvPlanes &planes, YuvColorSpace space) {
+		PXR_ASSERT(planes.layout == YuvLayout::Nv12, "presentNv12() needs NV12 planes.");
+		PXR_ASSERT(planes.width == surface.getWidth() && planes.height == surface.getHeight(),
+				   "Video frames need the size of the layer surface.");
+
+		// Sized once; later frames reuse the buffer.
+		nv12Buffer.resize(yuv::getBufferSize(planes.width, planes.height));
+		const YuvPlanes packed = yuv::wrapBuffer(YuvLayout::Nv12, nv12Buffer.data(), planes.width, planes.height);
+		for (int y = 0; y < planes.height; ++y) {
+			std::memcpy(packed.y + y * packed.yStride, planes.y + y * planes.yStride, packed.yStride);
+		}
+		for (int y = 0; y < (planes.height + 1) / 2; ++y) {
+			std::memcpy(packed.u + y * packed.uStride, planes.u + y * planes.uStride, packed.uStride);
+		}
+
+		nv12Space = space;
+		nv12 = true;
+		nv12Uploaded = false;
+		nv12Converted = false;
+		if (visible) {
+			invalidateBounds();
+		}
+	}
+
+	void Layer::stopNv12() {
+		if (!nv12) {
+			return;
+		}
+		resolveNv12();
+		nv12 = false;
+		// The texture may hold a newer frame than the surface was last uploaded with.
+		surface.markDirty();
+	}
+
+	bool Layer::showsNv12() const { return nv12; }
+
+	bool Layer::takeNv12Frame(YuvPlanes &planes, YuvColorSpace &space) {
+		if (!nv12 || nv12Uploaded) {
+			return false;
+		}
+		planes = yuv::wrapBuffer(YuvLayout::Nv12, nv12Buffer.data(), surface.getWidth(), surface.getHeight());
+		space = nv12Space;
+		nv12Uploaded = true;
+		return true;
+	}
+
+	void Layer::resolveNv12() {
+		if (!nv12 || nv12Converted) {
+			return;
+		}
+		yuv::toSurface(yuv::wrapBuffer(YuvLayout::Nv12, nv12Buffer.data(), surface.getWidth(), surface.getHeight()),
+					   surface, nv12Space);
+		nv12Converted = true;
+	}
+
+	void Layer::setZOrder(int z) {
+		if (z != zOrder) {
+			zOrder = z;
+			invalidateBounds();
+		}
+	}
+
+	void Layer::setOpacity(float value) {
+		const auto scaled = static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+		if (scaled != opacity) {
+			opacity = scaled;
+			invalidateBounds();
+		}
+	}
+
+	void Layer::setBlendMode(BlendMode mode) {
+		if (mode != blendMode) {
+			blendMode = mode;
+			invalidateBounds();
+		}
+	}
+
+	void Layer::setOffset(int x, int y) {
+		if (x != offsetX || y != offsetY) {
+			invalidateBounds();
+			offsetX = x;
+			offsetY = y;
+			invalidateBounds();
+		}
+	}
+
+	void Layer::setScale(int value) {
+		PXR_ASSERT(value >= 1, "Layer scale must be at least 1.");
+		if (value != scale) {
+			invalidateBounds();
+			scale = value;
+			invalidateBounds();
+		}
+	}
+
+	void Layer::setVisible(bool value) {
+		if (value != visible) {
+			visible = value;
+			invalidateBounds();
+		}
+	}
+
+	int Layer::getZOrder() const { return zOrder; }
+
+	float Layer::getOpacity() const { return static_cast<float>(opacity) / 255.0f; }
+
+	uint8_t Layer::getOpacity8() const { return opacity; }
+
+	BlendMode Layer::getBlendMode() const { return blendMode; }
+
+	int Layer::getOffsetX() const { return offsetX; }
+
+	int Layer::getOffsetY() const { return offsetY; }
+
+	int Layer::getScale() const { return scale; }
+
+	bool Layer::isVisible() const { return visible; }
+
+	Rect Layer::getBounds() const {
+		return Rect{offsetX, offsetY, surface.getWidth() * scale, surface.getHeight() * scale};
+	}
+
+	Rect Layer::getDamage() const {
+		// Drawing into a hidden layer does not change what is on screen.
+		if (!visible || !surface.isDirty()) {
+			return propertyDamage;
+		}
+		const Rect dirty = surface.getDirtyRect();
+		const Rect drawn{offsetX + dirty.x * scale, offsetY + dirty.y * scale, dirty.width * scale,
+						 dirty.height * scale};
+		return propertyDamage.united(drawn);
+	}
+
+	void Layer::clearDamage() {
+		surface.clearDirty();
+		propertyDamage = Rect{};
+	}
+
+	void Layer::invalidateBounds() { propertyDamage = propertyDamage.united(getBounds()); }
+
+} // namespace pxr
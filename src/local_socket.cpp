@@ -0,0 +1,199 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "local_socket.h"
+
+#include <utility>
+#include "error_handling.h"
+
+#ifndef _WIN32
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace pxr {
+
+#ifndef _WIN32
+	namespace {
+
+		sockaddr_un makeAddress(const std::string &path) {
+			sockaddr_un address{};
+			address.sun_family = AF_UNIX;
+			PXR_ASSERT(path.size() < sizeof(address.sun_path), "Socket path is too long.");
+			std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+			return address;
+		}
+
+		/// Stream sockets block, but give up on a peer that stops reading for a second.
+		void configureStream(int fd) {
+			fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_NONBLOCK);
+			timeval timeout{1, 0};
+			setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+#ifdef SO_NOSIGPIPE
+			const int on = 1;
+			setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+		}
+
+#ifdef MSG_NOSIGNAL
+		constexpr int SendFlags = MSG_NOSIGNAL;
+#else
+		constexpr int SendFlags = 0;
+#endif
+
+	} // namespace
+#endif
+
+	LocalSocket LocalSocket::listen(const std::string &path) {
+		LocalSocket socket;
+#ifdef _WIN32
+		(void) path;
+		PXR_ASSERT(false, "Local sockets require a POSIX system.");
+#else
+		const sockaddr_un address = makeAddress(path);
+		unlink(path.c_str());
+		socket.fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+		PXR_ASSERT(socket.fd >= 0, "Failed to create a local socket.");
+		PXR_ASSERT(bind(socket.fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0,
+				   ("Failed to bind local socket " + path).c_str());
+		socket.boundPath = path;
+		PXR_ASSERT(::listen(socket.fd, 8) == 0, "Failed to listen on a local socket.");
+		fcntl(socket.fd, F_SETFL, fcntl(socket.fd, F_GETFL) | O_NONBLOCK);
+		fcntl(socket.fd, F_SETFD, FD_CLOEXEC);
+#endif
+		return socket;
+	}
+
+	LocalSocket LocalSocket::connect(const std::string &path) {
+		LocalSocket socket;
+#ifdef _WIN32
+		(void) path;
+		PXR_ASSERT(false, "Local sockets require a POSIX system.");
+#else
+		const sockaddr_un address = makeAddress(path);
+		socket.fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+		PXR_ASSERT(socket.fd >= 0, "Failed to create a local socket.");
+		PXR_ASSERT(::connect(socket.fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0,
+				   ("Failed to connect to local socket " + path).c_str());
+		fcntl(socket.fd, F_SETFD, FD_CLOEXEC);
+		configureStream(socket.fd);
+#endif
+		return socket;
+	}
+
+	LocalSocket::~LocalSocket() { release(); }
+
+	LocalSocket::LocalSocket(LocalSocket &&other) noexcept :
+		fd(std::exchange(other.fd, -1)), boundPath(std::move(other.boundPath)) {
+		other.boundPath.clear();
+	}
+
+	LocalSocket &LocalSocket::operator=(LocalSocket &&other) noexcept {
+		if (this != &other) {
+			release();
+			fd = std::exchange(other.fd, -1);
+			boundPath = std::move(other.boundPath);
+			other.boundPath.clear();
+		}
+		return *this;
+	}
+
+	LocalSocket LocalSocket::accept() {
+		LocalSocket connection;
+#ifndef _WIN32
+		connection.fd = ::accept(fd, nullptr, nullptr);
+		if (connection.fd >= 0) {
+			fcntl(connection.fd, F_SETFD, FD_CLOEXEC);
+			configureStream(connection.fd);
+		}
+#endif
+		return connection;
+	}
+
+	bool LocalSocket::sendAll(const void *data, size_t size) {
+#ifdef _WIN32
+		(void) data;
+		(void) size;
+		return false;
+#else
+		const auto *bytes = static_cast<const char *>(data);
+		while (size > 0) {
+			const ssize_t sent = send(fd, bytes, size, SendFlags);
+			if (sent < 0 && errno == EINTR) {
+				continue;
+			}
+			if (sent <= 0) {
+				return false;
+			}
+			bytes += sent;
+			size -= static_cast<size_t>(sent);
+		}
+		return true;
+#endif
+	}
+
+	bool LocalSocket::receiveAll(void *data, size_t size) {
+#ifdef _WIN32
+		(void) data;
+		(void) size;
+		return false;
+#else
+		auto *bytes = static_cast<char *>(data);
+		while (size > 0) {
+			const ssize_t received = recv(fd, bytes, size, 0);
+			if (received < 0 && errno == EINTR) {
+				continue;
+			}
+			if (received <= 0) {
+				return false;
+			}
+			bytes += received;
+			size -= static_cast<size_t>(received);
+		}
+		return true;
+#endif
+	}
+
+	long LocalSocket::receiveAvailable(void *data, size_t capacity) {
+#ifdef _WIN32
+		(void) data;
+		(void) capacity;
+		return -1;
+#else
+		const ssize_t received = recv(fd, data, capacity, MSG_DONTWAIT);
+		if (received > 0) {
+			return static_cast<long>(received);
+		}
+		if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+			return 0;
+		}
+		return -1;
+#endif
+	}
+
+	bool LocalSocket::isValid() const { return fd >= 0; }
+
+	void LocalSocket::release() {
+#ifndef _WIN32
+		if (fd >= 0) {
+			close(fd);
+		}
+		if (!boundPath.empty()) {
+			unlink(boundPath.c_str());
+		}
+#endif
+		fd = -1;
+		boundPath.clear();
+	}
+
+} // namespace pxr
@@ -0,0 +1,84 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace pxr {
+
+	/**
+	 * @brief A Unix domain stream socket.
+	 *
+	 * Listening sockets are non-blocking and remove their socket file when
+	 * destroyed; connected sockets block, with a send timeout so a stalled peer
+	 * cannot hang the sender forever. Failures to set up a socket are reported
+	 * through PXR_ASSERT. Not available on Windows.
+	 */
+	class LocalSocket {
+	public:
+		/**
+		 * @brief Creates a listening socket, replacing any stale socket file at the path.
+		 * @param path Filesystem path of the socket.
+		 */
+		static LocalSocket listen(const std::string &path);
+
+		/**
+		 * @brief Connects to a listening socket.
+		 * @param path Filesystem path of the socket.
+		 */
+		static LocalSocket connect(const std::string &path);
+
+		LocalSocket() = default;
+		~LocalSocket();
+
+		LocalSocket(const LocalSocket &) = delete;
+		LocalSocket &operator=(const LocalSocket &) = delete;
+		LocalSocket(LocalSocket &&other) noexcept;
+		LocalSocket &operator=(LocalSocket &&other) noexcept;
+
+		/**
+		 * @brief Accepts a pending connection without waiting.
+		 * @return The connection, or an invalid socket if none is pending.
+		 */
+		LocalSocket accept();
+
+		/**
+		 * @brief Sends a whole buffer.
+		 * @return False if the peer disconnected or stopped reading.
+		 */
+		bool sendAll(const void *data, size_t size);
+
+		/**
+		 * @brief Waits until a whole buffer has been received.
+		 * @return False if the peer disconnected first.
+		 */
+		bool receiveAll(void *data, size_t size);
+
+		/**
+		 * @brief Receives whatever is available without waiting.
+		 * @return Number of bytes received, 0 if none are available, or -1 if the peer disconnected.
+		 */
+		long receiveAvailable(void *data, size_t capacity);
+
+		/// @brief Returns whether the socket is open.
+		[[nodiscard]] bool isValid() const;
+
+	private:
+		/**
+		 * @brief Closes the socket and removes the socket file of a listener.
+		 */
+		void release();
+
+		int fd = -1; ///< Socket descriptor, or -1.
+		std::string boundPath; ///< Socket file to remove on release (listeners only).
+	};
+
+} // namespace pxr
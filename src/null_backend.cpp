@@ -0,0 +1,71 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "null_backend.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include "input.h"
+
+namespace pxr {
+
+	//--------------------------------------------------------------------------
+	// Window
+	//--------------------------------------------------------------------------
+
+	void NullWindow::create(int w, int h, const std::string &t, bool vsync) {
+		width = w;
+		height = h;
+		title = t;
+		vsyncEnabled = vsync;
+		pacer.reset();
+	}
+
+	void NullWindow::destroy() {}
+
+	void NullWindow::pollEvents() {}
+
+	void NullWindow::waitEvents(double timeout) {
+		// No events ever arrive; bound the sleep so injected input is still noticed.
+		constexpr double MaxSleep = 0.1;
+		const double seconds = timeout < 0.0 ? MaxSleep : std::min(timeout, MaxSleep);
+		std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+	}
+
+	void NullWindow::swapBuffers() {
+		if (vsyncEnabled) {
+			pacer.wait();
+		}
+	}
+
+	void NullWindow::setVSync(bool enabled) { vsyncEnabled = enabled; }
+
+	void NullWindow::setTitle(const std::string &newTitle) { title = newTitle; }
+
+	void NullWindow::setSize(int w, int h) {
+		width = w;
+		height = h;
+	}
+
+	bool NullWindow::shouldClose() const { return false; }
+
+	std::unique_ptr<InputSource> NullWindow::createInputSource(Input &) { return nullptr; }
+
+	//--------------------------------------------------------------------------
+	// Presenter
+	//--------------------------------------------------------------------------
+
+	void NullPresenter::initialize(Window &, const Surface &, int) {}
+
+	void NullPresenter::upload(const Surface &, const Rect &) {}
+
+	void NullPresenter::present() {}
+
+} // namespace pxr
@@ -0,0 +1,63 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include "frame_pacer.h"
+#include "presenter.h"
+#include "window.h"
+
+namespace pxr {
+
+	/**
+	 * @brief A window that does not exist on screen.
+	 *
+	 * Used for headless runs and for presenters that own the display themselves.
+	 * It has no input of its own and never asks to close; with vsync enabled,
+	 * swapBuffers() paces the loop to 60 frames per second.
+	 */
+	class NullWindow final : public Window {
+	public:
+		void create(int width, int height, const std::string &title, bool vsync) override;
+
+		void destroy() override;
+
+		void pollEvents() override;
+
+		void waitEvents(double timeout) override;
+
+		void swapBuffers() override;
+
+		void setVSync(bool enabled) override;
+
+		void setTitle(const std::string &title) override;
+
+		void setSize(int width, int height) override;
+
+		[[nodiscard]] bool shouldClose() const override;
+
+		std::unique_ptr<InputSource> createInputSource(Input &input) override;
+
+	private:
+		FramePacer pacer; ///< Stands in for vsync.
+	};
+
+	/**
+	 * @brief A presenter that discards every frame.
+	 */
+	class NullPresenter final : public Presenter {
+	public:
+		void initialize(Window &window, const Surface &surface, int pixelSize) override;
+
+		void upload(const Surface &surface, const Rect &rect) override;
+
+		void present() override;
+	};
+
+} // namespace pxr
@@ -0,0 +1,138 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "pxr/pixel_format.h"
+
+#include <algorithm>
+#include <cstring>
+#include "pixel_kernels.h"
+
+namespace pxr::pixels {
+
+	namespace {
+
+		/// Pixels converted per step when neither side is Argb8888; small enough to stay in L1.
+		constexpr int ChunkPixels = 256;
+
+		void fromArgb(void *dst, PixelFormat format, const uint32_t *src, int count, LumaWeights luma) {
+			switch (format) {
+				case PixelFormat::Argb8888:
+					kernels::copyRow(static_cast<uint32_t *>(dst), src, count);
+					break;
+				case PixelFormat::Abgr8888:
+					kernels::swapRedBlueRow(static_cast<uint32_t *>(dst), src, count);
+					break;
+				case PixelFormat::Rgb888:
+					kernels::packRgb24Row(static_cast<uint8_t *>(dst), src, count);
+					break;
+				case PixelFormat::Bgr888:
+					kernels::packBgr24Row(static_cast<uint8_t *>(dst), src, count);
+					break;
+				case PixelFormat::Rgb565:
+					kernels::packRgb565Row(static_cast<uint16_t *>(dst), src, count);
+					break;
+				case PixelFormat::Rgb555:
+					kernels::packRgb555Row(static_cast<uint16_t *>(dst), src, count);
+					break;
+				case PixelFormat::Grey8:
+					kernels::packGrey8Row(static_cast<uint8_t *>(dst), src, count, luma);
+					break;
+				case PixelFormat::RgbaF32:
+					kernels::packRgbaF32Row(static_cast<float *>(dst), src, count);
+					break;
+			}
+		}
+
+		void toArgb(uint32_t *dst, const void *src, PixelFormat format, int count) {
+			switch (format) {
+				case PixelFormat::Argb8888:
+					kernels::copyRow(dst, static_cast<const uint32_t *>(src), count);
+					break;
+				case PixelFormat::Abgr8888:
+					kernels::swapRedBlueRow(dst, static_cast<const uint32_t *>(src), count);
+					break;
+				case PixelFormat::Rgb888:
+					kernels::unpackRgb24Row(dst, static_cast<const uint8_t *>(src), count);
+					break;
+				case PixelFormat::Bgr888:
+					kernels::unpackBgr24Row(dst, static_cast<const uint8_t *>(src), count);
+					break;
+				case PixelFormat::Rgb565:
+					kernels::unpackRgb565Row(dst, static_cast<const uint16_t *>(src), count);
+					break;
+				case PixelFormat::Rgb555:
+					kernels::unpackRgb555Row(dst, static_cast<const uint16_t *>(src), count);
+					break;
+				case PixelFormat::Grey8:
+					kernels::unpackGrey8Row(dst, static_cast<const uint8_t *>(src), count);
+					break;
+				case PixelFormat::RgbaF32:
+					kernels::unpackRgbaF32Row(dst, static_cast<const float *>(src), count);
+					break;
+			}
+		}
+
+	} // namespace
+
+	int getBytesPerPixel(PixelFormat format) {
+		switch (format) {
+			case PixelFormat::Argb8888:
+			case PixelFormat::Abgr8888:
+				return 4;
+			case PixelFormat::Rgb888:
+			case PixelFormat::Bgr888:
+				return 3;
+			case PixelFormat::Rgb565:
+			case PixelFormat::Rgb555:
+				return 2;
+			case PixelFormat::Grey8:
+				return 1;
+			case PixelFormat::RgbaF32:
+				return 16;
+		}
+		return 0;
+	}
+
+	void convertRow(void *dst, PixelFormat dstFormat, const void *src, PixelFormat srcFormat, int count,
+					LumaWeights luma) {
+		if (count <= 0) {
+			return;
+		}
+		if (dstFormat == srcFormat) {
+			std::memmove(dst, src, static_cast<size_t>(count) * getBytesPerPixel(srcFormat));
+		} else if (srcFormat == PixelFormat::Argb8888) {
+			fromArgb(dst, dstFormat, static_cast<const uint32_t *>(src), count, luma);
+		} else if (dstFormat == PixelFormat::Argb8888) {
+			toArgb(static_cast<uint32_t *>(dst), src, srcFormat, count);
+		} else {
+			// Neither side is the Surface layout: widen a chunk into it, then narrow it to the destination.
+			const size_t srcSize = getBytesPerPixel(srcFormat);
+			const size_t dstSize = getBytesPerPixel(dstFormat);
+			uint32_t chunk[ChunkPixels];
+			for (int i = 0; i < count; i += ChunkPixels) {
+				const int n = std::min(ChunkPixels, count - i);
+				toArgb(chunk, static_cast<const uint8_t *>(src) + i * srcSize, srcFormat, n);
+				fromArgb(static_cast<uint8_t *>(dst) + i * dstSize, dstFormat, chunk, n, luma);
+			}
+		}
+	}
+
+	void convertImage(void *dst, size_t dstStride, PixelFormat dstFormat, const void *src, size_t srcStride,
+					  PixelFormat srcFormat, int width, int height, LumaWeights luma) {
+		for (int y = 0; y < height; ++y) {
+			convertRow(static_cast<uint8_t *>(dst) + y * dstStride, dstFormat,
+					   static_cast<const uint8_t *>(src) + y * srcStride, srcFormat, width, luma);
+		}
+	}
+
+	void premultiplyRow(uint32_t *dst, const uint32_t *src, int count) { kernels::premultiplyRow(dst, src, count); }
+
+	void unpremultiplyRow(uint32_t *dst, const uint32_t *src, int count) { kernels::unpremultiplyRow(dst, src, count); }
+
+} // namespace pxr::pixels
@@ -0,0 +1,515 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "pixel_kernels.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+#include "cpu_features.h"
+#include "kernel_table.h"
+
+namespace pxr::kernels {
+
+	namespace {
+
+		/// Divides by 255 with correct rounding for inputs in [0, 255 * 255].
+		inline uint32_t div255(uint32_t x) {
+			x += 128;
+			return (x + (x >> 8)) >> 8;
+		}
+
+		inline uint32_t channel(uint32_t pixel, int shift) { return (pixel >> shift) & 0xFF; }
+
+		/// Source-over with the source alpha already scaled by the layer opacity.
+		inline uint32_t blendNormal(uint32_t d, uint32_t s, uint32_t a) {
+			const uint32_t ia = 255 - a;
+			uint32_t out = (div255(255 * a + channel(d, 24) * ia)) << 24;
+			for (int shift = 0; shift < 24; shift += 8) {
+				out |= div255(channel(s, shift) * a + channel(d, shift) * ia) << shift;
+			}
+			return out;
+		}
+
+		inline uint32_t blendAdd(uint32_t d, uint32_t s, uint32_t a) {
+			uint32_t out = d & 0xFF000000u;
+			for (int shift = 0; shift < 24; shift += 8) {
+				out |= std::min<uint32_t>(255, channel(d, shift) + div255(channel(s, shift) * a)) << shift;
+			}
+			return out;
+		}
+
+		inline uint32_t blendMultiply(uint32_t d, uint32_t s, uint32_t a) {
+			const uint32_t ia = 255 - a;
+			uint32_t out = d & 0xFF000000u;
+			for (int shift = 0; shift < 24; shift += 8) {
+				const uint32_t factor = div255(channel(s, shift) * a) + ia;
+				out |= div255(channel(d, shift) * factor) << shift;
+			}
+			return out;
+		}
+
+		//--------------------------------------------------------------------------
+		// Scalar reference
+		//--------------------------------------------------------------------------
+
+		void fillRowScalar(uint32_t *dst, uint32_t color, int count) { std::fill_n(dst, count, color); }
+
+		void blendRowScalar(uint32_t *dst, const uint32_t *src, int count, uint8_t opacity, BlendMode mode) {
+			for (int i = 0; i < count; ++i) {
+				const uint32_t s = src[i];
+				const uint32_t a =
+						mode == BlendMode::Replace ? opacity : div255(channel(s, 24) * static_cast<uint32_t>(opacity));
+				switch (mode) {
+					case BlendMode::Normal:
+					case BlendMode::Replace:
+						if (a == 255) {
+							dst[i] = s | 0xFF000000u;
+						} else if (a != 0) {
+							dst[i] = blendNormal(dst[i], s, a);
+						}
+						break;
+					case BlendMode::Add:
+						if (a != 0) {
+							dst[i] = blendAdd(dst[i], s, a);
+						}
+						break;
+					case BlendMode::Multiply:
+						if (a != 0) {
+							dst[i] = blendMultiply(dst[i], s, a);
+						}
+						break;
+				}
+			}
+		}
+
+		void scaleRowScalar(uint32_t *dst, const uint32_t *src, int count, int factor) {
+			for (int i = 0; i < count; ++i) {
+				std::fill_n(dst + static_cast<size_t>(i) * factor, factor, src[i]);
+			}
+		}
+
+		void swapRedBlueRowScalar(uint32_t *dst, const uint32_t *src, int count) {
+			for (int i = 0; i < count; ++i) {
+				const uint32_t p = src[i];
+				dst[i] = (p & 0xFF00FF00u) | ((p >> 16) & 0xFF) | ((p & 0xFF) << 16);
+			}
+		}
+
+		void packRgb565RowScalar(uint16_t *dst, const uint32_t *src, int count) {
+			for (int i = 0; i < count; ++i) {
+				const uint32_t p = src[i];
+				dst[i] = static_cast<uint16_t>(((p >> 8) & 0xF800) | ((p >> 5) & 0x07E0) | ((p >> 3) & 0x001F));
+			}
+		}
+
+		void packBgr24RowScalar(uint8_t *dst, const uint32_t *src, int count) {
+			for (int i = 0; i < count; ++i) {
+				const uint32_t p = src[i];
+				dst[i * 3 + 0] = static_cast<uint8_t>(p);
+				dst[i * 3 + 1] = static_cast<uint8_t>(p >> 8);
+				dst[i * 3 + 2] = static_cast<uint8_t>(p >> 16);
+			}
+		}
+
+		void packRgb24RowScalar(uint8_t *dst, const uint32_t *src, int count) {
+			for (int i = 0; i < count; ++i) {
+				const uint32_t p = src[i];
+				dst[i * 3 + 0] = static_cast<uint8_t>(p >> 16);
+				dst[i * 3 + 1] = static_cast<uint8_t>(p >> 8);
+				dst[i * 3 + 2] = static_cast<uint8_t>(p);
+			}
+		}
+
+		void packRgb555RowScalar(uint16_t *dst, const uint32_t *src, int count) {
+			for (int i = 0; i < count; ++i) {
+				const uint32_t p = src[i];
+				dst[i] = static_cast<uint16_t>(((p >> 9) & 0x7C00) | ((p >> 6) & 0x03E0) | ((p >> 3) & 0x001F));
+			}
+		}
+
+		void packGrey8RowScalar(uint8_t *dst, const uint32_t *src, int count, LumaWeights weights) {
+			const LumaCoefficients luma = getLumaCoefficients(weights);
+			for (int i = 0; i < count; ++i) {
+				const uint32_t p = src[i];
+				const int r = static_cast<int>(channel(p, 16));
+				const int g = static_cast<int>(channel(p, 8));
+				const int b = static_cast<int>(channel(p, 0));
+				const int sum = luma.red * r + luma.green * g + luma.blue * b;
+				dst[i] = static_cast<uint8_t>((sum + (1 << 13)) >> 14);
+			}
+		}
+
+		void packRgbaF32RowScalar(float *dst, const uint32_t *src, int count) {
+			for (int i = 0; i < count; ++i) {
+				const uint32_t p = src[i];
+				dst[i * 4 + 0] = static_cast<float>(channel(p, 16)) * (1.0f / 255.0f);
+				dst[i * 4 + 1] = static_cast<float>(channel(p, 8)) * (1.0f / 255.0f);
+				dst[i * 4 + 2] = static_cast<float>(channel(p, 0)) * (1.0f / 255.0f);
+				dst[i * 4 + 3] = static_cast<float>(channel(p, 24)) * (1.0f / 255.0f);
+			}
+		}
+
+		void unpackBgr24RowScalar(uint32_t *dst, const uint8_t *src, int count) {
+			for (int i = 0; i < count; ++i) {
+				const uint8_t *p = src + static_cast<size_t>(i) * 3;
+				dst[i] = 0xFF000000u | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[1]) << 8) | p[0];
+			}
+		}
+
+		void unpackRgb24RowScalar(uint32_t *dst, const uint8_t *src, int count) {
+			for (int i = 0; i < count; ++i) {
+				const uint8_t *p = src + static_cast<size_t>(i) * 3;
+				dst[i] = 0xFF000000u | (static_cast<uint32_t>(p[0]) << 16) | (static_cast<uint32_t>(p[1]) << 8) | p[2];
+			}
+		}
+
+		/// Widens a 5- or 6-bit channel to 8 bits so that the maximum maps to 255.
+		inline uint32_t expand5(uint32_t x) { return (x << 3) | (x >> 2); }
+		inline uint32_t expand6(uint32_t x) { return (x << 2) | (x >> 4); }
+
+		void unpackRgb565RowScalar(uint32_t *dst, const uint16_t *src, int count) {
+			for (int i = 0; i < count; ++i) {
+				const uint32_t p = src[i];
+				dst[i] = 0xFF000000u | (expand5(p >> 11) << 16) | (expand6((p >> 5) & 0x3F) << 8) | expand5(p & 0x1F);
+			}
+		}
+
+		void unpackRgb555RowScalar(uint32_t *dst, const uint16_t *src, int count) {
+			for (int i = 0; i < count; ++i) {
+				const uint32_t p = src[i];
+				dst[i] = 0xFF000000u | (expand5((p >> 10) & 0x1F) << 16) | (expand5((p >> 5) & 0x1F) << 8) |
+						 expand5(p & 0x1F);
+			}
+		}
+
+		void unpackGrey8RowScalar(uint32_t *dst, const uint8_t *src, int count) {
+			for (int i = 0; i < count; ++i) {
+				dst[i] = 0xFF000000u | (src[i] * 0x010101u);
+			}
+		}
+
+		/// Clamps to [0, 1] (NaN becomes 0, like the SIMD min and max instructions) and rounds to 8 bits.
+		inline uint32_t quantize(float value) {
+			value = value > 0.0f ? value : 0.0f;
+			value = value < 1.0f ? value : 1.0f;
+			return static_cast<uint32_t>(value * 255.0f + 0.5f);
+		}
+
+		void unpackRgbaF32RowScalar(uint32_t *dst, const float *src, int count) {
+			for (int i = 0; i < count; ++i) {
+				const float *p = src + static_cast<size_t>(i) * 4;
+				dst[i] = (quantize(p[3]) << 24) | (quantize(p[0]) << 16) | (quantize(p[1]) << 8) | quantize(p[2]);
+			}
+		}
+
+		void premultiplyRowScalar(uint32_t *dst, const uint32_t *src, int count) {
+			for (int i = 0; i < count; ++i) {
+				const uint32_t p = src[i];
+				const uint32_t a = channel(p, 24);
+				uint32_t out = p & 0xFF000000u;
+				for (int shift = 0; shift < 24; shift += 8) {
+					out |= div255(channel(p, shift) * a) << shift;
+				}
+				dst[i] = out;
+			}
+		}
+
+		void unpremultiplyRowScalar(uint32_t *dst, const uint32_t *src, int count) {
+			for (int i = 0; i < count; ++i) {
+				const uint32_t p = src[i];
+				const uint32_t a = channel(p, 24);
+				if (a == 0 || a == 255) {
+					dst[i] = a == 0 ? 0 : p;
+					continue;
+				}
+				uint32_t out = p & 0xFF000000u;
+				for (int shift = 0; shift < 24; shift += 8) {
+					out |= std::min<uint32_t>(255, (channel(p, shift) * 255 + a / 2) / a) << shift;
+				}
+				dst[i] = out;
+			}
+		}
+
+		inline uint8_t clampByte(int value) { return static_cast<uint8_t>(std::clamp(value, 0, 255)); }
+
+		void packYuvRowsScalar(uint8_t *y0, uint8_t *y1, uint8_t *u, uint8_t *v, int chromaStep, const uint32_t *row0,
+							   const uint32_t *row1, int width, const YuvCoefficients &k) {
+			const auto luma = [&k](uint32_t p) {
+				const int sum = k.lumaRed * channel(p, 16) + k.lumaGreen * channel(p, 8) + k.lumaBlue * channel(p, 0);
+				return clampByte(((sum + (1 << 13)) >> 14) + k.lumaOffset);
+			};
+			for (int x = 0; x < width; ++x) {
+				y0[x] = luma(row0[x]);
+				y1[x] = luma(row1[x]);
+			}
+			for (int x = 0; x < width; x += 2) {
+				// An odd last column pairs with itself, like an odd last row.
+				const int next = std::min(x + 1, width - 1);
+				const uint32_t block[] = {row0[x], row0[next], row1[x], row1[next]};
+				int red = 0, green = 0, blue = 0;
+				for (uint32_t p : block) {
+					red += channel(p, 16);
+					green += channel(p, 8);
+					blue += channel(p, 0);
+				}
+				const int i = x / 2 * chromaStep;
+				u[i] = clampByte((k.uRed * red + k.uGreen * green + k.uBlue * blue + (128 << 16) + (1 << 15)) >> 16);
+				v[i] = clampByte((k.vRed * red + k.vGreen * green + k.vBlue * blue + (128 << 16) + (1 << 15)) >> 16);
+			}
+		}
+
+		void unpackYuvRowScalar(uint32_t *dst, const uint8_t *y, const uint8_t *u, const uint8_t *v, int chromaStep,
+								int width, const YuvCoefficients &k) {
+			for (int x = 0; x < width; ++x) {
+				const int luma = (y[x] - k.lumaOffset) * k.yScale + (1 << 12);
+				const int cu = u[x / 2 * chromaStep] - 128;
+				const int cv = v[x / 2 * chromaStep] - 128;
+				const uint32_t red = clampByte((luma + k.redV * cv) >> 13);
+				const uint32_t green = clampByte((luma + k.greenU * cu + k.greenV * cv) >> 13);
+				const uint32_t blue = clampByte((luma + k.blueU * cu) >> 13);
+				dst[x] = 0xFF000000u | (red << 16) | (green << 8) | blue;
+			}
+		}
+
+		uint64_t hashRowScalar(const uint32_t *src, int count, uint64_t seed) {
+			uint64_t lanes[HashLanes];
+			for (int lane = 0; lane < HashLanes; ++lane) {
+				lanes[lane] = hashLaneStart(seed, lane);
+			}
+			hashLanes(lanes, src, 0, count);
+			return hashFinish(lanes, count, seed);
+		}
+
+		//--------------------------------------------------------------------------
+		// Selection
+		//--------------------------------------------------------------------------
+
+		/// Names of the paths, indexed by KernelPath.
+		constexpr const char *PathNames[] = {"scalar", "sse2", "avx2", "avx512", "neon"};
+
+		const KernelTable &selectKernels() {
+			const KernelTable *best = &scalarKernels();
+			for (const KernelPath path: {KernelPath::Sse2, KernelPath::Avx2, KernelPath::Avx512, KernelPath::Neon}) {
+				if (const KernelTable *table = findKernels(path)) {
+					best = table;
+				}
+			}
+
+			const char *env = std::getenv("PXR_KERNELS");
+			if (!env || !*env) {
+				return *best;
+			}
+			for (int path = 0; path < static_cast<int>(std::size(PathNames)); ++path) {
+				if (std::string_view(env) == PathNames[path]) {
+					if (const KernelTable *table = findKernels(static_cast<KernelPath>(path))) {
+						return *table;
+					}
+				}
+			}
+			std::fprintf(stderr, "[Pixel Runtime] PXR_KERNELS=%s cannot run here; using %s.\n", env, best->name);
+			return *best;
+		}
+
+	} // namespace
+
+	const KernelTable &scalarKernels() {
+		static const KernelTable table{
+				.name = "scalar",
+				.fillRow = fillRowScalar,
+				.blendRow = blendRowScalar,
+				.scaleRow = scaleRowScalar,
+				.swapRedBlueRow = swapRedBlueRowScalar,
+				.packRgb565Row = packRgb565RowScalar,
+				.packBgr24Row = packBgr24RowScalar,
+				.packRgb24Row = packRgb24RowScalar,
+				.packRgb555Row = packRgb555RowScalar,
+				.packGrey8Row = packGrey8RowScalar,
+				.packRgbaF32Row = packRgbaF32RowScalar,
+				.unpackBgr24Row = unpackBgr24RowScalar,
+				.unpackRgb24Row = unpackRgb24RowScalar,
+				.unpackRgb565Row = unpackRgb565RowScalar,
+				.unpackRgb555Row = unpackRgb555RowScalar,
+				.unpackGrey8Row = unpackGrey8RowScalar,
+				.unpackRgbaF32Row = unpackRgbaF32RowScalar,
+				.premultiplyRow = premultiplyRowScalar,
+				.unpremultiplyRow = unpremultiplyRowScalar,
+				.packYuvRows = packYuvRowsScalar,
+				.unpackYuvRow = unpackYuvRowScalar,
+				.hashRow = hashRowScalar,
+		};
+		return table;
+	}
+
+	const KernelTable *findKernels(KernelPath path) {
+		const CpuFeatures &cpu = getCpuFeatures();
+		switch (path) {
+			case KernelPath::Scalar:
+				return &scalarKernels();
+			case KernelPath::Sse2:
+				return cpu.sse2 ? sse2Kernels() : nullptr;
+			case KernelPath::Avx2:
+				return cpu.avx2 ? avx2Kernels() : nullptr;
+			case KernelPath::Avx512:
+				return cpu.avx512bw ? avx512Kernels() : nullptr;
+			case KernelPath::Neon:
+				return cpu.neon ? neonKernels() : nullptr;
+		}
+		return nullptr;
+	}
+
+	const KernelTable &getActiveKernels() {
+		static const KernelTable &active = selectKernels();
+		return active;
+	}
+
+	//--------------------------------------------------------------------------
+	// Kernels
+	//--------------------------------------------------------------------------
+
+	void copyRow(uint32_t *dst, const uint32_t *src, int count) {
+		if (count > 0) {
+			std::memcpy(dst, src, static_cast<size_t>(count) * sizeof(uint32_t));
+		}
+	}
+
+	void fillRow(uint32_t *dst, uint32_t color, int count) {
+		if (count > 0) {
+			getActiveKernels().fillRow(dst, color, count);
+		}
+	}
+
+	void blendRow(uint32_t *dst, const uint32_t *src, int count, uint8_t opacity, BlendMode mode) {
+		if (count > 0 && opacity != 0) {
+			getActiveKernels().blendRow(dst, src, count, opacity, mode);
+		}
+	}
+
+	void scaleRow(uint32_t *dst, const uint32_t *src, int count, int factor) {
+		if (factor == 1) {
+			copyRow(dst, src, count);
+		} else if (count > 0) {
+			getActiveKernels().scaleRow(dst, src, count, factor);
+		}
+	}
+
+	void swapRedBlueRow(uint32_t *dst, const uint32_t *src, int count) {
+		if (count > 0) {
+			getActiveKernels().swapRedBlueRow(dst, src, count);
+		}
+	}
+
+	void packRgb565Row(uint16_t *dst, const uint32_t *src, int count) {
+		if (count > 0) {
+			getActiveKernels().packRgb565Row(dst, src, count);
+		}
+	}
+
+	void packBgr24Row(uint8_t *dst, const uint32_t *src, int count) {
+		if (count > 0) {
+			getActiveKernels().packBgr24Row(dst, src, count);
+		}
+	}
+
+	void packRgb24Row(uint8_t *dst, const uint32_t *src, int count) {
+		if (count > 0) {
+			getActiveKernels().packRgb24Row(dst, src, count);
+		}
+	}
+
+	void packRgb555Row(uint16_t *dst, const uint32_t *src, int count) {
+		if (count > 0) {
+			getActiveKernels().packRgb555Row(dst, src, count);
+		}
+	}
+
+	void packGrey8Row(uint8_t *dst, const uint32_t *src, int count, LumaWeights weights) {
+		if (count > 0) {
+			getActiveKernels().packGrey8Row(dst, src, count, weights);
+		}
+	}
+
+	void packRgbaF32Row(float *dst, const uint32_t *src, int count) {
+		if (count > 0) {
+			getActiveKernels().packRgbaF32Row(dst, src, count);
+		}
+	}
+
+	void unpackBgr24Row(uint32_t *dst, const uint8_t *src, int count) {
+		if (count > 0) {
+			getActiveKernels().unpackBgr24Row(dst, src, count);
+		}
+	}
+
+	void unpackRgb24Row(uint32_t *dst, const uint8_t *src, int count) {
+		if (count > 0) {
+			getActiveKernels().unpackRgb24Row(dst, src, count);
+		}
+	}
+
+	void unpackRgb565Row(uint32_t *dst, const uint16_t *src, int count) {
+		if (count > 0) {
+			getActiveKernels().unpackRgb565Row(dst, src, count);
+		}
+	}
+
+	void unpackRgb555Row(uint32_t *dst, const uint16_t *src, int count) {
+		if (count > 0) {
+			getActiveKernels().unpackRgb555Row(dst, src, count);
+		}
+	}
+
+	void unpackGrey8Row(uint32_t *dst, const uint8_t *src, int count) {
+		if (count > 0) {
+			getActiveKernels().unpackGrey8Row(dst, src, count);
+		}
+	}
+
+	void unpackRgbaF32Row(uint32_t *dst, const float *src, int count) {
+		if (count > 0) {
+			getActiveKernels().unpackRgbaF32Row(dst, src, count);
+		}
+	}
+
+	void premultiplyRow(uint32_t *dst, const uint32_t *src, int count) {
+		if (count > 0) {
+			getActiveKernels().premultiplyRow(dst, src, count);
+		}
+	}
+
+	void unpremultiplyRow(uint32_t *dst, const uint32_t *src, int count) {
+		if (count > 0) {
+			getActiveKernels().unpremultiplyRow(dst, src, count);
+		}
+	}
+
+	void packYuvRows(uint8_t *y0, uint8_t *y1, uint8_t *u, uint8_t *v, int chromaStep, const uint32_t *row0,
+					 const uint32_t *row1, int width, const YuvCoefficients &k) {
+		if (width > 0) {
+			getActiveKernels().packYuvRows(y0, y1, u, v, chromaStep, row0, row1, width, k);
+		}
+	}
+
+	void unpackYuvRow(uint32_t *dst, const uint8_t *y, const uint8_t *u, const uint8_t *v, int chromaStep, int width,
+					  const YuvCoefficients &k) {
+		if (width > 0) {
+			getActiveKernels().unpackYuvRow(dst, y, u, v, chromaStep, width, k);
+		}
+	}
+
+	uint64_t hashRow(const uint32_t *src, int count, uint64_t seed) {
+		return getActiveKernels().hashRow(src, std::max(count, 0), seed);
+	}
+
+	const char *getKernelPathName() { return getActiveKernels().name; }
+
+} // namespace pxr::kernels
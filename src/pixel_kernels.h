@@ -0,0 +1,238 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include "pxr/layer.h"
+#include "pxr/pixel_format.h"
+
+/**
+ * @file pixel_kernels.h
+ * @brief Row-level pixel kernels shared by Surface, the compositor and the pixel format conversions.
+ *
+ * All kernels operate on packed 0xAARRGGBB pixels. Each call goes to the
+ * variant for the widest instruction set the CPU supports (SSE2, AVX2,
+ * AVX-512 or NEON), chosen once at startup; `PXR_KERNELS` forces another one.
+ * Every variant produces exactly the same output as the scalar reference.
+ * See kernel_table.h.
+ */
+
+namespace pxr::kernels {
+
+	struct YuvCoefficients;
+
+	/**
+	 * @brief Copies a row of pixels. Uses memcpy(), which the C library already tunes per CPU.
+	 * @param dst Destination pixels.
+	 * @param src Source pixels. Must not overlap with dst.
+	 * @param count Number of pixels.
+	 */
+	void copyRow(uint32_t *dst, const uint32_t *src, int count);
+
+	/**
+	 * @brief Fills a row of pixels with a single value.
+	 * @param dst Destination pixels.
+	 * @param color Packed color value.
+	 * @param count Number of pixels.
+	 */
+	void fillRow(uint32_t *dst, uint32_t color, int count);
+
+	/**
+	 * @brief Blends a row of source pixels onto a row of destination pixels.
+	 * @param dst Destination pixels, updated in place.
+	 * @param src Source pixels.
+	 * @param count Number of pixels.
+	 * @param opacity Global opacity applied on top of the source alpha (0–255).
+	 * @param mode How source and destination are combined.
+	 */
+	void blendRow(uint32_t *dst, const uint32_t *src, int count, uint8_t opacity, BlendMode mode);
+
+	/**
+	 * @brief Enlarges a row of pixels by repeating each one.
+	 * @param dst Destination pixels; receives count * factor pixels.
+	 * @param src Source pixels. Must not overlap with dst.
+	 * @param count Number of source pixels.
+	 * @param factor Number of copies of each pixel (at least 1).
+	 */
+	void scaleRow(uint32_t *dst, const uint32_t *src, int count, int factor);
+
+	/**
+	 * @brief Converts a row to 0xAABBGGRR by swapping the red and blue channels.
+	 * @param dst Destination pixels. May be the same as src.
+	 * @param src Source pixels.
+	 * @param count Number of pixels.
+	 */
+	void swapRedBlueRow(uint32_t *dst, const uint32_t *src, int count);
+
+	/**
+	 * @brief Converts a row to packed 16-bit RGB565, dropping alpha.
+	 * @param dst Destination pixels.
+	 * @param src Source pixels.
+	 * @param count Number of pixels.
+	 */
+	void packRgb565Row(uint16_t *dst, const uint32_t *src, int count);
+
+	/**
+	 * @brief Converts a row to 24-bit pixels stored as blue, green, red bytes, dropping alpha.
+	 * @param dst Destination bytes; receives count * 3 bytes.
+	 * @param src Source pixels.
+	 * @param count Number of pixels.
+	 */
+	void packBgr24Row(uint8_t *dst, const uint32_t *src, int count);
+
+	/**
+	 * @brief Converts a row to 24-bit pixels stored as red, green, blue bytes, dropping alpha.
+	 * @param dst Destination bytes; receives count * 3 bytes.
+	 * @param src Source pixels.
+	 * @param count Number of pixels.
+	 */
+	void packRgb24Row(uint8_t *dst, const uint32_t *src, int count);
+
+	/**
+	 * @brief Converts a row to packed 16-bit RGB555 with the top bit clear, dropping alpha.
+	 * @param dst Destination pixels.
+	 * @param src Source pixels.
+	 * @param count Number of pixels.
+	 */
+	void packRgb555Row(uint16_t *dst, const uint32_t *src, int count);
+
+	/**
+	 * @brief Converts a row to 8-bit luma, dropping alpha.
+	 * @param dst Destination bytes.
+	 * @param src Source pixels.
+	 * @param count Number of pixels.
+	 * @param weights Weights of red, green and blue.
+	 */
+	void packGrey8Row(uint8_t *dst, const uint32_t *src, int count, LumaWeights weights);
+
+	/**
+	 * @brief Converts a row to four floats per pixel in red, green, blue, alpha order, scaled to [0, 1].
+	 * @param dst Destination floats; receives count * 4 values.
+	 * @param src Source pixels.
+	 * @param count Number of pixels.
+	 */
+	void packRgbaF32Row(float *dst, const uint32_t *src, int count);
+
+	/**
+	 * @brief Converts a row of blue, green, red bytes to opaque pixels.
+	 * @param dst Destination pixels.
+	 * @param src Source bytes; count * 3 of them.
+	 * @param count Number of pixels.
+	 */
+	void unpackBgr24Row(uint32_t *dst, const uint8_t *src, int count);
+
+	/**
+	 * @brief Converts a row of red, green, blue bytes to opaque pixels.
+	 * @param dst Destination pixels.
+	 * @param src Source bytes; count * 3 of them.
+	 * @param count Number of pixels.
+	 */
+	void unpackRgb24Row(uint32_t *dst, const uint8_t *src, int count);
+
+	/**
+	 * @brief Converts a row of RGB565 pixels to opaque pixels, replicating the high bits into the low ones.
+	 * @param dst Destination pixels.
+	 * @param src Source pixels.
+	 * @param count Number of pixels.
+	 */
+	void unpackRgb565Row(uint32_t *dst, const uint16_t *src, int count);
+
+	/**
+	 * @brief Converts a row of RGB555 pixels to opaque pixels, ignoring the top bit.
+	 * @param dst Destination pixels.
+	 * @param src Source pixels.
+	 * @param count Number of pixels.
+	 */
+	void unpackRgb555Row(uint32_t *dst, const uint16_t *src, int count);
+
+	/**
+	 * @brief Converts a row of 8-bit luma to opaque grey pixels.
+	 * @param dst Destination pixels.
+	 * @param src Source bytes.
+	 * @param count Number of pixels.
+	 */
+	void unpackGrey8Row(uint32_t *dst, const uint8_t *src, int count);
+
+	/**
+	 * @brief Converts a row of red, green, blue, alpha floats to pixels, clamping to [0, 1] and rounding.
+	 * @param dst Destination pixels.
+	 * @param src Source floats; count * 4 of them. NaN becomes 0.
+	 * @param count Number of pixels.
+	 */
+	void unpackRgbaF32Row(uint32_t *dst, const float *src, int count);
+
+	/**
+	 * @brief Multiplies the color channels of a row by their alpha.
+	 * @param dst Destination pixels. May be the same as src.
+	 * @param src Source pixels.
+	 * @param count Number of pixels.
+	 */
+	void premultiplyRow(uint32_t *dst, const uint32_t *src, int count);
+
+	/**
+	 * @brief Divides the color channels of a premultiplied row by their alpha.
+	 * @param dst Destination pixels. May be the same as src.
+	 * @param src Source pixels.
+	 * @param count Number of pixels.
+	 */
+	void unpremultiplyRow(uint32_t *dst, const uint32_t *src, int count);
+
+	/**
+	 * @brief Converts two rows of pixels to 4:2:0 YUV: two rows of luma and one of subsampled chroma.
+	 *
+	 * Each chroma sample averages a 2x2 block. For an odd last row pass the
+	 * same row and luma destination twice; an odd last column pairs with itself.
+	 *
+	 * @param y0 Receives width luma values of row0.
+	 * @param y1 Receives width luma values of row1.
+	 * @param u Receives (width + 1) / 2 U values, chromaStep bytes apart.
+	 * @param v Receives (width + 1) / 2 V values, chromaStep bytes apart.
+	 * @param chromaStep 1 for separate U and V planes, 2 for an interleaved UV plane.
+	 * @param row0 Upper source row.
+	 * @param row1 Lower source row.
+	 * @param width Pixels per row.
+	 * @param k Constants of the color space; see YuvCoefficients.
+	 */
+	void packYuvRows(uint8_t *y0, uint8_t *y1, uint8_t *u, uint8_t *v, int chromaStep, const uint32_t *row0,
+					 const uint32_t *row1, int width, const YuvCoefficients &k);
+
+	/**
+	 * @brief Converts a row of 4:2:0 YUV to opaque pixels, repeating each chroma sample over two columns.
+	 * @param dst Destination pixels.
+	 * @param y width luma values.
+	 * @param u (width + 1) / 2 U values, chromaStep bytes apart.
+	 * @param v (width + 1) / 2 V values, chromaStep bytes apart.
+	 * @param chromaStep 1 for separate U and V planes, 2 for an interleaved UV plane.
+	 * @param width Pixels per row.
+	 * @param k Constants of the color space; see YuvCoefficients.
+	 */
+	void unpackYuvRow(uint32_t *dst, const uint8_t *y, const uint8_t *u, const uint8_t *v, int chromaStep, int width,
+					  const YuvCoefficients &k);
+
+	/**
+	 * @brief Hashes a row of pixels, continuing from a previous hash.
+	 *
+	 * Chain rows by passing the previous result as the seed. Meant for change
+	 * detection within a process: every variant returns the same value, but
+	 * the value may differ between versions of the runtime.
+	 *
+	 * @param src Source pixels.
+	 * @param count Number of pixels.
+	 * @param seed Hash of the preceding data, or any constant for the first row.
+	 * @return The updated hash.
+	 */
+	uint64_t hashRow(const uint32_t *src, int count, uint64_t seed);
+
+	/**
+	 * @brief Returns the name of the kernel variant in use, such as "avx2" or "scalar".
+	 */
+	const char *getKernelPathName();
+
+} // namespace pxr::kernels
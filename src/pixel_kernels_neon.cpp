@@ -0,0 +1,137 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "kernel_table.h"
+
+#if defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)
+#define PXR_KERNELS_NEON 1
+#include <arm_neon.h>
+#endif
+
+#ifdef PXR_KERNELS_NEON
+
+namespace pxr::kernels {
+
+	namespace {
+
+		void swapRedBlueRowNeon(uint32_t *dst, const uint32_t *src, int count) {
+			int i = 0;
+			for (; i + 16 <= count; i += 16) {
+				// De-interleaving loads split the channels into separate registers; swapping two is free.
+				uint8x16x4_t pixels = vld4q_u8(reinterpret_cast<const uint8_t *>(src + i));
+				const uint8x16_t blue = pixels.val[0];
+				pixels.val[0] = pixels.val[2];
+				pixels.val[2] = blue;
+				vst4q_u8(reinterpret_cast<uint8_t *>(dst + i), pixels);
+			}
+			scalarKernels().swapRedBlueRow(dst + i, src + i, count - i);
+		}
+
+		// Pixels are bytes blue, green, red, alpha; the 24-bit formats keep three of the de-interleaved planes.
+
+		void packBgr24RowNeon(uint8_t *dst, const uint32_t *src, int count) {
+			int i = 0;
+			for (; i + 16 <= count; i += 16) {
+				const uint8x16x4_t pixels = vld4q_u8(reinterpret_cast<const uint8_t *>(src + i));
+				vst3q_u8(dst + static_cast<size_t>(i) * 3, uint8x16x3_t{{pixels.val[0], pixels.val[1], pixels.val[2]}});
+			}
+			scalarKernels().packBgr24Row(dst + static_cast<size_t>(i) * 3, src + i, count - i);
+		}
+
+		void packRgb24RowNeon(uint8_t *dst, const uint32_t *src, int count) {
+			int i = 0;
+			for (; i + 16 <= count; i += 16) {
+				const uint8x16x4_t pixels = vld4q_u8(reinterpret_cast<const uint8_t *>(src + i));
+				vst3q_u8(dst + static_cast<size_t>(i) * 3, uint8x16x3_t{{pixels.val[2], pixels.val[1], pixels.val[0]}});
+			}
+			scalarKernels().packRgb24Row(dst + static_cast<size_t>(i) * 3, src + i, count - i);
+		}
+
+		void unpackBgr24RowNeon(uint32_t *dst, const uint8_t *src, int count) {
+			int i = 0;
+			for (; i + 16 <= count; i += 16) {
+				const uint8x16x3_t bgr = vld3q_u8(src + static_cast<size_t>(i) * 3);
+				const uint8x16x4_t pixels{{bgr.val[0], bgr.val[1], bgr.val[2], vdupq_n_u8(255)}};
+				vst4q_u8(reinterpret_cast<uint8_t *>(dst + i), pixels);
+			}
+			scalarKernels().unpackBgr24Row(dst + i, src + static_cast<size_t>(i) * 3, count - i);
+		}
+
+		void unpackRgb24RowNeon(uint32_t *dst, const uint8_t *src, int count) {
+			int i = 0;
+			for (; i + 16 <= count; i += 16) {
+				const uint8x16x3_t rgb = vld3q_u8(src + static_cast<size_t>(i) * 3);
+				const uint8x16x4_t pixels{{rgb.val[2], rgb.val[1], rgb.val[0], vdupq_n_u8(255)}};
+				vst4q_u8(reinterpret_cast<uint8_t *>(dst + i), pixels);
+			}
+			scalarKernels().unpackRgb24Row(dst + i, src + static_cast<size_t>(i) * 3, count - i);
+		}
+
+		/// Multiplies two 64-bit hash lanes by HashPrime, 2^40 + 0x1B3, using 32-bit products.
+		inline uint64x2_t hashStepNeon(uint64x2_t lanes, uint32x2_t pixels) {
+			const uint64x2_t h = veorq_u64(lanes, vmovl_u32(pixels));
+			const uint64x2_t low = vmull_n_u32(vmovn_u64(h), 0x1B3);
+			const uint64x2_t high = vshlq_n_u64(vmull_n_u32(vshrn_n_u64(h, 32), 0x1B3), 32);
+			return vaddq_u64(vaddq_u64(low, high), vshlq_n_u64(h, 40));
+		}
+
+		uint64_t hashRowNeon(const uint32_t *src, int count, uint64_t seed) {
+			uint64_t lanes[HashLanes];
+			for (int lane = 0; lane < HashLanes; ++lane) {
+				lanes[lane] = hashLaneStart(seed, lane);
+			}
+			uint64x2_t l0 = vld1q_u64(lanes);
+			uint64x2_t l1 = vld1q_u64(lanes + 2);
+			uint64x2_t l2 = vld1q_u64(lanes + 4);
+			uint64x2_t l3 = vld1q_u64(lanes + 6);
+			int i = 0;
+			for (; i + HashLanes <= count; i += HashLanes) {
+				const uint32x4_t p0 = vld1q_u32(src + i);
+				const uint32x4_t p1 = vld1q_u32(src + i + 4);
+				l0 = hashStepNeon(l0, vget_low_u32(p0));
+				l1 = hashStepNeon(l1, vget_high_u32(p0));
+				l2 = hashStepNeon(l2, vget_low_u32(p1));
+				l3 = hashStepNeon(l3, vget_high_u32(p1));
+			}
+			vst1q_u64(lanes, l0);
+			vst1q_u64(lanes + 2, l1);
+			vst1q_u64(lanes + 4, l2);
+			vst1q_u64(lanes + 6, l3);
+			hashLanes(lanes, src, i, count);
+			return hashFinish(lanes, count, seed);
+		}
+
+	} // namespace
+
+	const KernelTable *neonKernels() {
+		static const KernelTable table = [] {
+			KernelTable kernels = scalarKernels();
+			kernels.name = "neon";
+			kernels.swapRedBlueRow = swapRedBlueRowNeon;
+			kernels.packBgr24Row = packBgr24RowNeon;
+			kernels.packRgb24Row = packRgb24RowNeon;
+			kernels.unpackBgr24Row = unpackBgr24RowNeon;
+			kernels.unpackRgb24Row = unpackRgb24RowNeon;
+			kernels.hashRow = hashRowNeon;
+			return kernels;
+		}();
+		return &table;
+	}
+
+} // namespace pxr::kernels
+
+#else
+
+namespace pxr::kernels {
+
+	const KernelTable *neonKernels() { return nullptr; }
+
+} // namespace pxr::kernels
+
+#endif
@@ -0,0 +1,958 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "kernel_table.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define PXR_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+#ifdef PXR_KERNELS_X86
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+// Each variant is compiled for its own instruction set, so the rest of the library keeps the baseline target.
+// MSVC accepts every intrinsic without it.
+#if defined(__GNUC__) || defined(__clang__)
+#define PXR_TARGET(isa) __attribute__((target(isa)))
+#else
+#define PXR_TARGET(isa)
+#endif
+
+/// Instruction sets of the AVX-512 variants.
+#define PXR_AVX512 "avx2,avx512f,avx512bw"
+
+namespace pxr::kernels {
+
+	namespace {
+
+		static_assert(HashPrime == (uint64_t{1} << 40) + 0x1B3, "The SIMD hash steps multiply by 2^40 + 0x1B3.");
+
+		//--------------------------------------------------------------------------
+		// SSE2
+		//--------------------------------------------------------------------------
+
+		/// Divides eight unsigned 16-bit lanes by 255 with rounding.
+		PXR_TARGET("sse2") inline __m128i div255Epu16(__m128i x) {
+			x = _mm_add_epi16(x, _mm_set1_epi16(128));
+			return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+		}
+
+		/// Broadcasts the alpha lane of two unpacked pixels to all four channel lanes.
+		PXR_TARGET("sse2") inline __m128i broadcastAlpha(__m128i unpacked) {
+			return _mm_shufflehi_epi16(_mm_shufflelo_epi16(unpacked, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+		}
+
+		/// Source-over for two unpacked pixels whose alpha lane has been forced to 255.
+		PXR_TARGET("sse2") inline __m128i blendNormal2(__m128i d, __m128i s, __m128i a) {
+			const __m128i ia = _mm_sub_epi16(_mm_set1_epi16(255), a);
+			return div255Epu16(_mm_add_epi16(_mm_mullo_epi16(s, a), _mm_mullo_epi16(d, ia)));
+		}
+
+		PXR_TARGET("sse2") void blendRowNormalSse2(uint32_t *dst, const uint32_t *src, int count, uint8_t opacity) {
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i alphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+			const __m128i opacity16 = _mm_set1_epi16(opacity);
+			int i = 0;
+			for (; i + 4 <= count; i += 4) {
+				const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+				const __m128i srcAlpha = _mm_and_si128(s, alphaMask);
+
+				// Fully transparent source: nothing to do.
+				if (_mm_movemask_epi8(_mm_cmpeq_epi32(srcAlpha, zero)) == 0xFFFF) {
+					continue;
+				}
+				// Fully opaque source at full opacity: plain copy.
+				if (opacity == 255 && _mm_movemask_epi8(_mm_cmpeq_epi32(srcAlpha, alphaMask)) == 0xFFFF) {
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), s);
+					continue;
+				}
+
+				const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+				const __m128i sOpaque = _mm_or_si128(s, alphaMask);
+
+				const __m128i sLo = _mm_unpacklo_epi8(s, zero);
+				const __m128i sHi = _mm_unpackhi_epi8(s, zero);
+				const __m128i aLo = div255Epu16(_mm_mullo_epi16(broadcastAlpha(sLo), opacity16));
+				const __m128i aHi = div255Epu16(_mm_mullo_epi16(broadcastAlpha(sHi), opacity16));
+
+				const __m128i lo = blendNormal2(_mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi8(sOpaque, zero), aLo);
+				const __m128i hi = blendNormal2(_mm_unpackhi_epi8(d, zero), _mm_unpackhi_epi8(sOpaque, zero), aHi);
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_packus_epi16(lo, hi));
+			}
+			scalarKernels().blendRow(dst + i, src + i, count - i, opacity, BlendMode::Normal);
+		}
+
+		PXR_TARGET("sse2") void blendRowAddSse2(uint32_t *dst, const uint32_t *src, int count, uint8_t opacity) {
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i colorMask = _mm_set1_epi32(0x00FFFFFF);
+			const __m128i opacity16 = _mm_set1_epi16(opacity);
+			int i = 0;
+			for (; i + 4 <= count; i += 4) {
+				const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+				const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+
+				const __m128i sLo = _mm_unpacklo_epi8(s, zero);
+				const __m128i sHi = _mm_unpackhi_epi8(s, zero);
+				const __m128i aLo = div255Epu16(_mm_mullo_epi16(broadcastAlpha(sLo), opacity16));
+				const __m128i aHi = div255Epu16(_mm_mullo_epi16(broadcastAlpha(sHi), opacity16));
+
+				// Scale the source by alpha, drop its alpha channel and add with saturation.
+				const __m128i scaled = _mm_packus_epi16(div255Epu16(_mm_mullo_epi16(sLo, aLo)),
+														div255Epu16(_mm_mullo_epi16(sHi, aHi)));
+				const __m128i sum = _mm_adds_epu8(d, _mm_and_si128(scaled, colorMask));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), sum);
+			}
+			scalarKernels().blendRow(dst + i, src + i, count - i, opacity, BlendMode::Add);
+		}
+
+		PXR_TARGET("sse2") void scaleRowSse2(uint32_t *dst, const uint32_t *src, int count, int factor) {
+			int i = 0;
+			if (factor == 2) {
+				for (; i + 4 <= count; i += 4) {
+					const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 2), _mm_unpacklo_epi32(s, s));
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 2 + 4), _mm_unpackhi_epi32(s, s));
+				}
+			} else if (factor == 4) {
+				for (; i + 4 <= count; i += 4) {
+					const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+					auto *out = reinterpret_cast<__m128i *>(dst + i * 4);
+					_mm_storeu_si128(out, _mm_shuffle_epi32(s, 0x00));
+					_mm_storeu_si128(out + 1, _mm_shuffle_epi32(s, 0x55));
+					_mm_storeu_si128(out + 2, _mm_shuffle_epi32(s, 0xAA));
+					_mm_storeu_si128(out + 3, _mm_shuffle_epi32(s, 0xFF));
+				}
+			} else if (factor > 4) {
+				// Broadcast each pixel; the last store may overlap the previous one.
+				for (; i < count; ++i) {
+					const __m128i s = _mm_set1_epi32(static_cast<int>(src[i]));
+					uint32_t *out = dst + static_cast<size_t>(i) * factor;
+					for (int k = 0; k + 4 < factor; k += 4) {
+						_mm_storeu_si128(reinterpret_cast<__m128i *>(out + k), s);
+					}
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(out + factor - 4), s);
+				}
+			}
+			for (; i < count; ++i) {
+				std::fill_n(dst + static_cast<size_t>(i) * factor, factor, src[i]);
+			}
+		}
+
+
+		/// Layout of a 16-bit RGB format: RGB565 when green has 6 bits, RGB555 when it has 5.
+		template <int GreenBits>
+		struct Rgb16 {
+			static constexpr int RedShift = 14 - GreenBits; ///< Moves bits 19-23 to the top of the value.
+			static constexpr int GreenShift = 11 - GreenBits; ///< Moves the kept green bits right below red.
+			static constexpr int GreenMask = GreenBits == 6 ? 0xFC00 : 0xF800; ///< Kept green bits of a pixel.
+			static constexpr int Top = GreenBits == 6 ? 11 : 10; ///< Bit position of red in the value.
+
+			static void packScalar(uint16_t *dst, const uint32_t *src, int count) {
+				(GreenBits == 6 ? scalarKernels().packRgb565Row : scalarKernels().packRgb555Row)(dst, src, count);
+			}
+
+			static void unpackScalar(uint32_t *dst, const uint16_t *src, int count) {
+				(GreenBits == 6 ? scalarKernels().unpackRgb565Row : scalarKernels().unpackRgb555Row)(dst, src, count);
+			}
+		};
+
+		/// Packs four pixels into 16-bit values, one per 32-bit lane.
+		template <int GreenBits>
+		PXR_TARGET("sse2") inline __m128i toRgb16Sse2(__m128i s) {
+			using Format = Rgb16<GreenBits>;
+			const __m128i r = _mm_srli_epi32(_mm_and_si128(s, _mm_set1_epi32(0xF80000)), Format::RedShift);
+			const __m128i g = _mm_srli_epi32(_mm_and_si128(s, _mm_set1_epi32(Format::GreenMask)), Format::GreenShift);
+			const __m128i b = _mm_srli_epi32(_mm_and_si128(s, _mm_set1_epi32(0x0000F8)), 3);
+			return _mm_or_si128(_mm_or_si128(r, g), b);
+		}
+
+		template <int GreenBits>
+		PXR_TARGET("sse2") void packRgb16RowSse2(uint16_t *dst, const uint32_t *src, int count) {
+			int i = 0;
+			for (; i + 8 <= count; i += 8) {
+				__m128i packed[2];
+				for (int half = 0; half < 2; ++half) {
+					const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + half * 4));
+					// Sign-extend from bit 15 so the signed 32-to-16 pack keeps the bit pattern.
+					packed[half] = _mm_srai_epi32(_mm_slli_epi32(toRgb16Sse2<GreenBits>(s), 16), 16);
+				}
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_packs_epi32(packed[0], packed[1]));
+			}
+			Rgb16<GreenBits>::packScalar(dst + i, src + i, count - i);
+		}
+
+		/// Widens four 16-bit values, one per 32-bit lane, to opaque pixels.
+		template <int GreenBits>
+		PXR_TARGET("sse2") inline __m128i fromRgb16Sse2(__m128i v) {
+			const __m128i five = _mm_set1_epi32(0x1F);
+			const __m128i r = _mm_and_si128(_mm_srli_epi32(v, Rgb16<GreenBits>::Top), five);
+			const __m128i g = _mm_and_si128(_mm_srli_epi32(v, 5), _mm_set1_epi32((1 << GreenBits) - 1));
+			const __m128i b = _mm_and_si128(v, five);
+			// Replicate the high bits into the low ones so the largest value becomes 255.
+			const __m128i r8 = _mm_or_si128(_mm_slli_epi32(r, 3), _mm_srli_epi32(r, 2));
+			const __m128i g8 = _mm_or_si128(_mm_slli_epi32(g, 8 - GreenBits), _mm_srli_epi32(g, 2 * GreenBits - 8));
+			const __m128i b8 = _mm_or_si128(_mm_slli_epi32(b, 3), _mm_srli_epi32(b, 2));
+			const __m128i rgb = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r8, 16), _mm_slli_epi32(g8, 8)), b8);
+			return _mm_or_si128(rgb, _mm_set1_epi32(static_cast<int>(0xFF000000u)));
+		}
+
+		template <int GreenBits>
+		PXR_TARGET("sse2") void unpackRgb16RowSse2(uint32_t *dst, const uint16_t *src, int count) {
+			const __m128i zero = _mm_setzero_si128();
+			int i = 0;
+			for (; i + 8 <= count; i += 8) {
+				const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+				const __m128i lo = fromRgb16Sse2<GreenBits>(_mm_unpacklo_epi16(v, zero));
+				const __m128i hi = fromRgb16Sse2<GreenBits>(_mm_unpackhi_epi16(v, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), lo);
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 4), hi);
+			}
+			Rgb16<GreenBits>::unpackScalar(dst + i, src + i, count - i);
+		}
+
+		/// Weighted sum of red, green and blue of four pixels, in 32-bit lanes with 14 fraction bits.
+		/// Adds adjacent 32-bit lanes: a0 + a1, a2 + a3, b0 + b1, b2 + b3.
+		PXR_TARGET("sse2") inline __m128i addPairsSse2(__m128i a, __m128i b) {
+			const __m128 lo = _mm_castsi128_ps(a);
+			const __m128 hi = _mm_castsi128_ps(b);
+			const __m128i even = _mm_castps_si128(_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0)));
+			const __m128i odd = _mm_castps_si128(_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1)));
+			return _mm_add_epi32(even, odd);
+		}
+
+		PXR_TARGET("sse2") inline __m128i lumaSse2(__m128i s, __m128i weights) {
+			const __m128i zero = _mm_setzero_si128();
+			// Each pair of 16-bit products is one pixel's blue + green and red + 0; add the pairs.
+			const __m128i sum = addPairsSse2(_mm_madd_epi16(_mm_unpacklo_epi8(s, zero), weights),
+											 _mm_madd_epi16(_mm_unpackhi_epi8(s, zero), weights));
+			return _mm_srli_epi32(_mm_add_epi32(sum, _mm_set1_epi32(1 << 13)), 14);
+		}
+
+		/// Returns blue, green, red, 0 weights for both pixels of a register, as lumaSse2() expects.
+		PXR_TARGET("sse2") inline __m128i pixelWeightsSse2(int red, int green, int blue) {
+			const auto r = static_cast<int16_t>(red), g = static_cast<int16_t>(green), b = static_cast<int16_t>(blue);
+			return _mm_setr_epi16(b, g, r, 0, b, g, r, 0);
+		}
+
+		PXR_TARGET("sse2") void packGrey8RowSse2(uint8_t *dst, const uint32_t *src, int count, LumaWeights weights) {
+			const LumaCoefficients luma = getLumaCoefficients(weights);
+			const __m128i factors = pixelWeightsSse2(luma.red, luma.green, luma.blue);
+			int i = 0;
+			for (; i + 8 <= count; i += 8) {
+				const __m128i lo = lumaSse2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i)), factors);
+				const __m128i hi = lumaSse2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 4)), factors);
+				const __m128i words = _mm_packs_epi32(lo, hi);
+				_mm_storel_epi64(reinterpret_cast<__m128i *>(dst + i), _mm_packus_epi16(words, words));
+			}
+			scalarKernels().packGrey8Row(dst + i, src + i, count - i, weights);
+		}
+
+		PXR_TARGET("sse2") void unpackGrey8RowSse2(uint32_t *dst, const uint8_t *src, int count) {
+			const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+			int i = 0;
+			for (; i + 16 <= count; i += 16) {
+				const __m128i grey = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+				const __m128i pairs[2] = {_mm_unpacklo_epi8(grey, grey), _mm_unpackhi_epi8(grey, grey)};
+				for (int half = 0; half < 2; ++half) {
+					const __m128i lo = _mm_or_si128(_mm_unpacklo_epi16(pairs[half], pairs[half]), alpha);
+					const __m128i hi = _mm_or_si128(_mm_unpackhi_epi16(pairs[half], pairs[half]), alpha);
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + half * 8), lo);
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + half * 8 + 4), hi);
+				}
+			}
+			scalarKernels().unpackGrey8Row(dst + i, src + i, count - i);
+		}
+
+		/// Swaps the red and blue bytes of four pixels.
+		PXR_TARGET("sse2") inline __m128i swapRedBlueSse2(__m128i s) {
+			// Rotating each 0x00RR00BB half-pair by 16 bits swaps red and blue.
+			const __m128i rb = _mm_and_si128(s, _mm_set1_epi32(0x00FF00FF));
+			const __m128i swapped = _mm_or_si128(_mm_slli_epi32(rb, 16), _mm_srli_epi32(rb, 16));
+			return _mm_or_si128(_mm_and_si128(s, _mm_set1_epi32(static_cast<int>(0xFF00FF00u))), swapped);
+		}
+
+		PXR_TARGET("sse2") void swapRedBlueRowSse2(uint32_t *dst, const uint32_t *src, int count) {
+			int i = 0;
+			for (; i + 4 <= count; i += 4) {
+				const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), swapRedBlueSse2(s));
+			}
+			scalarKernels().swapRedBlueRow(dst + i, src + i, count - i);
+		}
+
+		PXR_TARGET("sse2") void packRgbaF32RowSse2(float *dst, const uint32_t *src, int count) {
+			const __m128i zero = _mm_setzero_si128();
+			const __m128 scale = _mm_set1_ps(1.0f / 255.0f);
+			int i = 0;
+			for (; i + 4 <= count; i += 4) {
+				// After the swap the bytes of each pixel are in red, green, blue, alpha order.
+				const __m128i s = swapRedBlueSse2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i)));
+				const __m128i words[2] = {_mm_unpacklo_epi8(s, zero), _mm_unpackhi_epi8(s, zero)};
+				float *out = dst + static_cast<size_t>(i) * 4;
+				for (int half = 0; half < 2; ++half) {
+					const __m128 first = _mm_cvtepi32_ps(_mm_unpacklo_epi16(words[half], zero));
+					const __m128 second = _mm_cvtepi32_ps(_mm_unpackhi_epi16(words[half], zero));
+					_mm_storeu_ps(out + half * 8, _mm_mul_ps(first, scale));
+					_mm_storeu_ps(out + half * 8 + 4, _mm_mul_ps(second, scale));
+				}
+			}
+			scalarKernels().packRgbaF32Row(dst + static_cast<size_t>(i) * 4, src + i, count - i);
+		}
+
+		/// Clamps one pixel's four floats to [0, 1] and rounds them to integers in [0, 255].
+		PXR_TARGET("sse2") inline __m128i quantizeSse2(const float *values) {
+			// max() and min() return their second operand for NaN, matching the scalar comparisons.
+			const __m128 clamped = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(values), _mm_setzero_ps()), _mm_set1_ps(1.0f));
+			return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(clamped, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+		}
+
+		PXR_TARGET("sse2") void unpackRgbaF32RowSse2(uint32_t *dst, const float *src, int count) {
+			int i = 0;
+			for (; i + 4 <= count; i += 4) {
+				const float *in = src + static_cast<size_t>(i) * 4;
+				const __m128i lo = _mm_packs_epi32(quantizeSse2(in), quantizeSse2(in + 4));
+				const __m128i hi = _mm_packs_epi32(quantizeSse2(in + 8), quantizeSse2(in + 12));
+				const __m128i rgba = _mm_packus_epi16(lo, hi);
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), swapRedBlueSse2(rgba));
+			}
+			scalarKernels().unpackRgbaF32Row(dst + i, src + static_cast<size_t>(i) * 4, count - i);
+		}
+
+		PXR_TARGET("sse2") void premultiplyRowSse2(uint32_t *dst, const uint32_t *src, int count) {
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i alphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+			int i = 0;
+			for (; i + 4 <= count; i += 4) {
+				const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+				const __m128i lo = _mm_unpacklo_epi8(s, zero);
+				const __m128i hi = _mm_unpackhi_epi8(s, zero);
+				const __m128i scaled = _mm_packus_epi16(div255Epu16(_mm_mullo_epi16(lo, broadcastAlpha(lo))),
+														div255Epu16(_mm_mullo_epi16(hi, broadcastAlpha(hi))));
+				// The alpha lane was multiplied by itself; put the original back.
+				const __m128i result = _mm_or_si128(_mm_andnot_si128(alphaMask, scaled), _mm_and_si128(s, alphaMask));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), result);
+			}
+			scalarKernels().premultiplyRow(dst + i, src + i, count - i);
+		}
+
+		/// Returns the 16-bit pair (low, high) in every 32-bit lane, the layout madd multiplies pairs of values by.
+		PXR_TARGET("sse2") inline __m128i pairWeightsSse2(int low, int high) {
+			return _mm_set1_epi32(static_cast<int>((static_cast<uint32_t>(high) << 16) | static_cast<uint16_t>(low)));
+		}
+
+		/// Sums the 2x2 blocks in four pixels of two rows: 16-bit blue, green, red and alpha of each block.
+		PXR_TARGET("sse2") inline __m128i blockSumsSse2(__m128i upper, __m128i lower) {
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i left = _mm_add_epi16(_mm_unpacklo_epi8(upper, zero), _mm_unpacklo_epi8(lower, zero));
+			const __m128i right = _mm_add_epi16(_mm_unpackhi_epi8(upper, zero), _mm_unpackhi_epi8(lower, zero));
+			return _mm_unpacklo_epi64(_mm_add_epi16(left, _mm_srli_si128(left, 8)),
+									  _mm_add_epi16(right, _mm_srli_si128(right, 8)));
+		}
+
+		/// Reduces the block sums of eight pixels to four chroma values.
+		PXR_TARGET("sse2") inline __m128i chromaSse2(__m128i blocks01, __m128i blocks23, __m128i weights) {
+			const __m128i sum = addPairsSse2(_mm_madd_epi16(blocks01, weights), _mm_madd_epi16(blocks23, weights));
+			return _mm_srai_epi32(_mm_add_epi32(sum, _mm_set1_epi32((128 << 16) + (1 << 15))), 16);
+		}
+
+		PXR_TARGET("sse2") void packYuvRowsSse2(uint8_t *y0, uint8_t *y1, uint8_t *u, uint8_t *v, int chromaStep,
+												const uint32_t *row0, const uint32_t *row1, int width,
+												const YuvCoefficients &k) {
+			const __m128i lumaWeights = pixelWeightsSse2(k.lumaRed, k.lumaGreen, k.lumaBlue);
+			const __m128i uWeights = pixelWeightsSse2(k.uRed, k.uGreen, k.uBlue);
+			const __m128i vWeights = pixelWeightsSse2(k.vRed, k.vGreen, k.vBlue);
+			const __m128i lumaOffset = _mm_set1_epi16(static_cast<int16_t>(k.lumaOffset));
+			int x = 0;
+			for (; x + 8 <= width; x += 8) {
+				const __m128i a0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row0 + x));
+				const __m128i a1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row0 + x + 4));
+				const __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row1 + x));
+				const __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row1 + x + 4));
+				const __m128i upper =
+					_mm_add_epi16(_mm_packs_epi32(lumaSse2(a0, lumaWeights), lumaSse2(a1, lumaWeights)), lumaOffset);
+				const __m128i lower =
+					_mm_add_epi16(_mm_packs_epi32(lumaSse2(b0, lumaWeights), lumaSse2(b1, lumaWeights)), lumaOffset);
+				_mm_storel_epi64(reinterpret_cast<__m128i *>(y0 + x), _mm_packus_epi16(upper, upper));
+				_mm_storel_epi64(reinterpret_cast<__m128i *>(y1 + x), _mm_packus_epi16(lower, lower));
+
+				const __m128i blocks01 = blockSumsSse2(a0, b0);
+				const __m128i blocks23 = blockSumsSse2(a1, b1);
+				const __m128i words = _mm_packs_epi32(chromaSse2(blocks01, blocks23, uWeights),
+													  chromaSse2(blocks01, blocks23, vWeights));
+				const __m128i bytes = _mm_packus_epi16(words, words); // U0..U3, V0..V3
+				if (chromaStep == 2) {
+					_mm_storel_epi64(reinterpret_cast<__m128i *>(u + x),
+									 _mm_unpacklo_epi8(bytes, _mm_srli_si128(bytes, 4)));
+				} else {
+					const auto us = static_cast<uint32_t>(_mm_cvtsi128_si32(bytes));
+					const auto vs = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(bytes, 4)));
+					std::memcpy(u + x / 2, &us, 4);
+					std::memcpy(v + x / 2, &vs, 4);
+				}
+			}
+			scalarKernels().packYuvRows(y0 + x, y1 + x, u + x / 2 * chromaStep, v + x / 2 * chromaStep, chromaStep,
+										row0 + x, row1 + x, width - x, k);
+		}
+
+		PXR_TARGET("sse2") void unpackYuvRowSse2(uint32_t *dst, const uint8_t *y, const uint8_t *u, const uint8_t *v,
+												 int chromaStep, int width, const YuvCoefficients &k) {
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i lumaOffset = _mm_set1_epi16(static_cast<int16_t>(k.lumaOffset));
+			const __m128i chromaOffset = _mm_set1_epi16(128);
+			// Luma is paired with 1 so the rounding term rides along in the same madd.
+			const __m128i one = _mm_set1_epi16(1);
+			const __m128i lumaFactors = pairWeightsSse2(k.yScale, 1 << 12);
+			const __m128i redFactors = pairWeightsSse2(0, k.redV);
+			const __m128i greenFactors = pairWeightsSse2(k.greenU, k.greenV);
+			const __m128i blueFactors = pairWeightsSse2(k.blueU, 0);
+			const __m128i alpha = _mm_set1_epi8(-1);
+			int x = 0;
+			for (; x + 8 <= width; x += 8) {
+				const __m128i luma = _mm_sub_epi16(
+					_mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(y + x)), zero), lumaOffset);
+				__m128i chroma; // U, V bytes of four samples
+				if (chromaStep == 2) {
+					chroma = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(u + x));
+				} else {
+					uint32_t us, vs;
+					std::memcpy(&us, u + x / 2, 4);
+					std::memcpy(&vs, v + x / 2, 4);
+					chroma = _mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(us)),
+											   _mm_cvtsi32_si128(static_cast<int>(vs)));
+				}
+				chroma = _mm_sub_epi16(_mm_unpacklo_epi8(chroma, zero), chromaOffset);
+				// Each sample covers two pixels.
+				const __m128i chromaLo = _mm_unpacklo_epi32(chroma, chroma);
+				const __m128i chromaHi = _mm_unpackhi_epi32(chroma, chroma);
+				const __m128i lumaLo = _mm_madd_epi16(_mm_unpacklo_epi16(luma, one), lumaFactors);
+				const __m128i lumaHi = _mm_madd_epi16(_mm_unpackhi_epi16(luma, one), lumaFactors);
+				const auto channel = [&](__m128i factors) {
+					const __m128i lo = _mm_srai_epi32(_mm_add_epi32(lumaLo, _mm_madd_epi16(chromaLo, factors)), 13);
+					const __m128i hi = _mm_srai_epi32(_mm_add_epi32(lumaHi, _mm_madd_epi16(chromaHi, factors)), 13);
+					const __m128i words = _mm_packs_epi32(lo, hi);
+					return _mm_packus_epi16(words, words);
+				};
+				const __m128i blueGreen = _mm_unpacklo_epi8(channel(blueFactors), channel(greenFactors));
+				const __m128i redAlpha = _mm_unpacklo_epi8(channel(redFactors), alpha);
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x), _mm_unpacklo_epi16(blueGreen, redAlpha));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x + 4), _mm_unpackhi_epi16(blueGreen, redAlpha));
+			}
+			scalarKernels().unpackYuvRow(dst + x, y + x, u + x / 2 * chromaStep, v + x / 2 * chromaStep, chromaStep,
+										 width - x, k);
+		}
+
+		PXR_TARGET("sse2") void blendRowSse2(uint32_t *dst, const uint32_t *src, int count, uint8_t opacity,
+											 BlendMode mode) {
+			switch (mode) {
+				case BlendMode::Normal:
+					blendRowNormalSse2(dst, src, count, opacity);
+					break;
+				case BlendMode::Add:
+					blendRowAddSse2(dst, src, count, opacity);
+					break;
+				default:
+					scalarKernels().blendRow(dst, src, count, opacity, mode);
+					break;
+			}
+		}
+
+		/// Mixes pixels into two 64-bit hash lanes and multiplies them by HashPrime using 32-bit products.
+		PXR_TARGET("sse2") inline __m128i hashStepSse2(__m128i lanes, __m128i pixels) {
+			const __m128i primeLow = _mm_set1_epi32(0x1B3);
+			const __m128i h = _mm_xor_si128(lanes, pixels);
+			const __m128i low = _mm_mul_epu32(h, primeLow);
+			const __m128i high = _mm_slli_epi64(_mm_mul_epu32(_mm_srli_epi64(h, 32), primeLow), 32);
+			return _mm_add_epi64(_mm_add_epi64(low, high), _mm_slli_epi64(h, 40));
+		}
+
+		PXR_TARGET("sse2") uint64_t hashRowSse2(const uint32_t *src, int count, uint64_t seed) {
+			alignas(16) uint64_t lanes[HashLanes];
+			for (int lane = 0; lane < HashLanes; ++lane) {
+				lanes[lane] = hashLaneStart(seed, lane);
+			}
+			auto *stored = reinterpret_cast<__m128i *>(lanes);
+			__m128i l0 = _mm_load_si128(stored);
+			__m128i l1 = _mm_load_si128(stored + 1);
+			__m128i l2 = _mm_load_si128(stored + 2);
+			__m128i l3 = _mm_load_si128(stored + 3);
+			const __m128i zero = _mm_setzero_si128();
+			int i = 0;
+			for (; i + HashLanes <= count; i += HashLanes) {
+				const __m128i p0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+				const __m128i p1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 4));
+				l0 = hashStepSse2(l0, _mm_unpacklo_epi32(p0, zero));
+				l1 = hashStepSse2(l1, _mm_unpackhi_epi32(p0, zero));
+				l2 = hashStepSse2(l2, _mm_unpacklo_epi32(p1, zero));
+				l3 = hashStepSse2(l3, _mm_unpackhi_epi32(p1, zero));
+			}
+			_mm_store_si128(stored, l0);
+			_mm_store_si128(stored + 1, l1);
+			_mm_store_si128(stored + 2, l2);
+			_mm_store_si128(stored + 3, l3);
+			hashLanes(lanes, src, i, count);
+			return hashFinish(lanes, count, seed);
+		}
+
+		//--------------------------------------------------------------------------
+		// AVX2
+		//--------------------------------------------------------------------------
+		// 256-bit unpacks and packs work within each 128-bit half, so pairing them keeps pixels in order.
+
+		PXR_TARGET("avx2") inline __m256i div255Epu16Avx2(__m256i x) {
+			x = _mm256_add_epi16(x, _mm256_set1_epi16(128));
+			return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+		}
+
+		PXR_TARGET("avx2") inline __m256i broadcastAlphaAvx2(__m256i unpacked) {
+			const __m256i low = _mm256_shufflelo_epi16(unpacked, _MM_SHUFFLE(3, 3, 3, 3));
+			return _mm256_shufflehi_epi16(low, _MM_SHUFFLE(3, 3, 3, 3));
+		}
+
+		/// Source-over for eight unpacked pixels whose alpha lane has been forced to 255.
+		PXR_TARGET("avx2") inline __m256i blendNormal8(__m256i d, __m256i s, __m256i a) {
+			const __m256i ia = _mm256_sub_epi16(_mm256_set1_epi16(255), a);
+			return div255Epu16Avx2(_mm256_add_epi16(_mm256_mullo_epi16(s, a), _mm256_mullo_epi16(d, ia)));
+		}
+
+		PXR_TARGET("avx2") void fillRowAvx2(uint32_t *dst, uint32_t color, int count) {
+			const __m256i value = _mm256_set1_epi32(static_cast<int>(color));
+			int i = 0;
+			for (; i + 8 <= count; i += 8) {
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), value);
+			}
+			std::fill_n(dst + i, count - i, color);
+		}
+
+		PXR_TARGET("avx2") void blendRowNormalAvx2(uint32_t *dst, const uint32_t *src, int count, uint8_t opacity) {
+			const __m256i zero = _mm256_setzero_si256();
+			const __m256i alphaMask = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+			const __m256i opacity16 = _mm256_set1_epi16(opacity);
+			int i = 0;
+			for (; i + 8 <= count; i += 8) {
+				const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+				const __m256i srcAlpha = _mm256_and_si256(s, alphaMask);
+
+				if (_mm256_testz_si256(s, alphaMask)) {
+					continue;
+				}
+				if (opacity == 255 && _mm256_movemask_epi8(_mm256_cmpeq_epi32(srcAlpha, alphaMask)) == -1) {
+					_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), s);
+					continue;
+				}
+
+				const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i));
+				const __m256i sOpaque = _mm256_or_si256(s, alphaMask);
+
+				const __m256i sLo = _mm256_unpacklo_epi8(s, zero);
+				const __m256i sHi = _mm256_unpackhi_epi8(s, zero);
+				const __m256i aLo = div255Epu16Avx2(_mm256_mullo_epi16(broadcastAlphaAvx2(sLo), opacity16));
+				const __m256i aHi = div255Epu16Avx2(_mm256_mullo_epi16(broadcastAlphaAvx2(sHi), opacity16));
+
+				const __m256i lo =
+						blendNormal8(_mm256_unpacklo_epi8(d, zero), _mm256_unpacklo_epi8(sOpaque, zero), aLo);
+				const __m256i hi =
+						blendNormal8(_mm256_unpackhi_epi8(d, zero), _mm256_unpackhi_epi8(sOpaque, zero), aHi);
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_packus_epi16(lo, hi));
+			}
+			blendRowNormalSse2(dst + i, src + i, count - i, opacity);
+		}
+
+		PXR_TARGET("avx2") void blendRowAddAvx2(uint32_t *dst, const uint32_t *src, int count, uint8_t opacity) {
+			const __m256i zero = _mm256_setzero_si256();
+			const __m256i colorMask = _mm256_set1_epi32(0x00FFFFFF);
+			const __m256i opacity16 = _mm256_set1_epi16(opacity);
+			int i = 0;
+			for (; i + 8 <= count; i += 8) {
+				const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+				const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i));
+
+				const __m256i sLo = _mm256_unpacklo_epi8(s, zero);
+				const __m256i sHi = _mm256_unpackhi_epi8(s, zero);
+				const __m256i aLo = div255Epu16Avx2(_mm256_mullo_epi16(broadcastAlphaAvx2(sLo), opacity16));
+				const __m256i aHi = div255Epu16Avx2(_mm256_mullo_epi16(broadcastAlphaAvx2(sHi), opacity16));
+
+				const __m256i scaled = _mm256_packus_epi16(div255Epu16Avx2(_mm256_mullo_epi16(sLo, aLo)),
+														   div255Epu16Avx2(_mm256_mullo_epi16(sHi, aHi)));
+				const __m256i sum = _mm256_adds_epu8(d, _mm256_and_si256(scaled, colorMask));
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), sum);
+			}
+			blendRowAddSse2(dst + i, src + i, count - i, opacity);
+		}
+
+		PXR_TARGET("avx2") void blendRowAvx2(uint32_t *dst, const uint32_t *src, int count, uint8_t opacity,
+											 BlendMode mode) {
+			switch (mode) {
+				case BlendMode::Normal:
+					blendRowNormalAvx2(dst, src, count, opacity);
+					break;
+				case BlendMode::Add:
+					blendRowAddAvx2(dst, src, count, opacity);
+					break;
+				default:
+					scalarKernels().blendRow(dst, src, count, opacity, mode);
+					break;
+			}
+		}
+
+		PXR_TARGET("avx2") void swapRedBlueRowAvx2(uint32_t *dst, const uint32_t *src, int count) {
+			const __m256i order = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15, //
+												   2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+			int i = 0;
+			for (; i + 8 <= count; i += 8) {
+				const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_shuffle_epi8(s, order));
+			}
+			swapRedBlueRowSse2(dst + i, src + i, count - i);
+		}
+
+		template <int GreenBits>
+		PXR_TARGET("avx2") void packRgb16RowAvx2(uint16_t *dst, const uint32_t *src, int count) {
+			using Format = Rgb16<GreenBits>;
+			const __m256i red = _mm256_set1_epi32(0xF80000);
+			const __m256i green = _mm256_set1_epi32(Format::GreenMask);
+			const __m256i blue = _mm256_set1_epi32(0x0000F8);
+			int i = 0;
+			for (; i + 16 <= count; i += 16) {
+				__m256i packed[2];
+				for (int half = 0; half < 2; ++half) {
+					const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i + half * 8));
+					const __m256i r = _mm256_srli_epi32(_mm256_and_si256(s, red), Format::RedShift);
+					const __m256i g = _mm256_srli_epi32(_mm256_and_si256(s, green), Format::GreenShift);
+					const __m256i b = _mm256_srli_epi32(_mm256_and_si256(s, blue), 3);
+					packed[half] = _mm256_or_si256(_mm256_or_si256(r, g), b);
+				}
+				// The pack interleaves the 128-bit halves of both inputs; put the four pixel groups back in order.
+				const __m256i result = _mm256_permute4x64_epi64(_mm256_packus_epi32(packed[0], packed[1]),
+																_MM_SHUFFLE(3, 1, 2, 0));
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), result);
+			}
+			packRgb16RowSse2<GreenBits>(dst + i, src + i, count - i);
+		}
+
+		/// Shuffles 24-bit pixels four at a time; returns the number converted, leaving the rest to the caller.
+		PXR_TARGET("avx2") int pack24Avx2(uint8_t *dst, const uint32_t *src, int count, __m128i order) {
+			int i = 0;
+			// Each store writes 16 bytes for 12 bytes of output; stop while the excess still lands inside the row.
+			for (; i + 6 <= count; i += 4) {
+				const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+				auto *out = reinterpret_cast<__m128i *>(dst + static_cast<size_t>(i) * 3);
+				_mm_storeu_si128(out, _mm_shuffle_epi8(s, order));
+			}
+			return i;
+		}
+
+		PXR_TARGET("avx2") void packBgr24RowAvx2(uint8_t *dst, const uint32_t *src, int count) {
+			const int done = pack24Avx2(dst, src, count, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, //
+																		  -1, -1, -1, -1));
+			scalarKernels().packBgr24Row(dst + static_cast<size_t>(done) * 3, src + done, count - done);
+		}
+
+		PXR_TARGET("avx2") void packRgb24RowAvx2(uint8_t *dst, const uint32_t *src, int count) {
+			const int done = pack24Avx2(dst, src, count, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, //
+																		  -1, -1, -1, -1));
+			scalarKernels().packRgb24Row(dst + static_cast<size_t>(done) * 3, src + done, count - done);
+		}
+
+		/// Widens 24-bit pixels four at a time; returns the number converted, leaving the rest to the caller.
+		PXR_TARGET("avx2") int unpack24Avx2(uint32_t *dst, const uint8_t *src, int count, __m128i order) {
+			const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+			int i = 0;
+			// Each load reads 16 bytes for 12 bytes of input; stop while the excess still lies inside the row.
+			for (; i + 6 <= count; i += 4) {
+				const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + static_cast<size_t>(i) * 3));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_or_si128(_mm_shuffle_epi8(s, order), alpha));
+			}
+			return i;
+		}
+
+		PXR_TARGET("avx2") void unpackBgr24RowAvx2(uint32_t *dst, const uint8_t *src, int count) {
+			const int done = unpack24Avx2(dst, src, count, _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, //
+																			9, 10, 11, -1));
+			scalarKernels().unpackBgr24Row(dst + done, src + static_cast<size_t>(done) * 3, count - done);
+		}
+
+		PXR_TARGET("avx2") void unpackRgb24RowAvx2(uint32_t *dst, const uint8_t *src, int count) {
+			const int done = unpack24Avx2(dst, src, count, _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, //
+																			11, 10, 9, -1));
+			scalarKernels().unpackRgb24Row(dst + done, src + static_cast<size_t>(done) * 3, count - done);
+		}
+
+		PXR_TARGET("avx2") inline __m256i hashStepAvx2(__m256i lanes, __m256i pixels) {
+			const __m256i primeLow = _mm256_set1_epi64x(0x1B3);
+			const __m256i h = _mm256_xor_si256(lanes, pixels);
+			const __m256i low = _mm256_mul_epu32(h, primeLow);
+			const __m256i high = _mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(h, 32), primeLow), 32);
+			return _mm256_add_epi64(_mm256_add_epi64(low, high), _mm256_slli_epi64(h, 40));
+		}
+
+		PXR_TARGET("avx2") uint64_t hashRowAvx2(const uint32_t *src, int count, uint64_t seed) {
+			alignas(32) uint64_t lanes[HashLanes];
+			for (int lane = 0; lane < HashLanes; ++lane) {
+				lanes[lane] = hashLaneStart(seed, lane);
+			}
+			auto *stored = reinterpret_cast<__m256i *>(lanes);
+			__m256i l0 = _mm256_load_si256(stored);
+			__m256i l1 = _mm256_load_si256(stored + 1);
+			int i = 0;
+			for (; i + HashLanes <= count; i += HashLanes) {
+				const auto *pixels = reinterpret_cast<const __m128i *>(src + i);
+				l0 = hashStepAvx2(l0, _mm256_cvtepu32_epi64(_mm_loadu_si128(pixels)));
+				l1 = hashStepAvx2(l1, _mm256_cvtepu32_epi64(_mm_loadu_si128(pixels + 1)));
+			}
+			_mm256_store_si256(stored, l0);
+			_mm256_store_si256(stored + 1, l1);
+			hashLanes(lanes, src, i, count);
+			return hashFinish(lanes, count, seed);
+		}
+
+		//--------------------------------------------------------------------------
+		// AVX-512
+		//--------------------------------------------------------------------------
+		// Rows shorter than a register, and row ends, use masked loads and stores or the AVX2 kernels.
+
+		PXR_TARGET(PXR_AVX512) inline __mmask16 tailMask(int remaining) {
+			return static_cast<__mmask16>((1u << remaining) - 1);
+		}
+
+		PXR_TARGET(PXR_AVX512) inline __m512i div255Epu16Avx512(__m512i x) {
+			x = _mm512_add_epi16(x, _mm512_set1_epi16(128));
+			return _mm512_srli_epi16(_mm512_add_epi16(x, _mm512_srli_epi16(x, 8)), 8);
+		}
+
+		PXR_TARGET(PXR_AVX512) inline __m512i broadcastAlphaAvx512(__m512i unpacked) {
+			const __m512i low = _mm512_shufflelo_epi16(unpacked, _MM_SHUFFLE(3, 3, 3, 3));
+			return _mm512_shufflehi_epi16(low, _MM_SHUFFLE(3, 3, 3, 3));
+		}
+
+		/// Source-over for sixteen unpacked pixels whose alpha lane has been forced to 255.
+		PXR_TARGET(PXR_AVX512) inline __m512i blendNormal16(__m512i d, __m512i s, __m512i a) {
+			const __m512i ia = _mm512_sub_epi16(_mm512_set1_epi16(255), a);
+			return div255Epu16Avx512(_mm512_add_epi16(_mm512_mullo_epi16(s, a), _mm512_mullo_epi16(d, ia)));
+		}
+
+		PXR_TARGET(PXR_AVX512) void fillRowAvx512(uint32_t *dst, uint32_t color, int count) {
+			const __m512i value = _mm512_set1_epi32(static_cast<int>(color));
+			int i = 0;
+			for (; i + 16 <= count; i += 16) {
+				_mm512_storeu_si512(dst + i, value);
+			}
+			if (i < count) {
+				_mm512_mask_storeu_epi32(dst + i, tailMask(count - i), value);
+			}
+		}
+
+		PXR_TARGET(PXR_AVX512) void blendRowNormalAvx512(uint32_t *dst, const uint32_t *src, int count,
+														 uint8_t opacity) {
+			const __m512i zero = _mm512_setzero_si512();
+			const __m512i alphaMask = _mm512_set1_epi32(static_cast<int>(0xFF000000u));
+			const __m512i opacity16 = _mm512_set1_epi16(opacity);
+			int i = 0;
+			for (; i + 16 <= count; i += 16) {
+				const __m512i s = _mm512_loadu_si512(src + i);
+
+				if (_mm512_test_epi32_mask(s, alphaMask) == 0) {
+					continue;
+				}
+				if (opacity == 255 && _mm512_cmpeq_epi32_mask(_mm512_and_si512(s, alphaMask), alphaMask) == 0xFFFF) {
+					_mm512_storeu_si512(dst + i, s);
+					continue;
+				}
+
+				const __m512i d = _mm512_loadu_si512(dst + i);
+				const __m512i sOpaque = _mm512_or_si512(s, alphaMask);
+
+				const __m512i sLo = _mm512_unpacklo_epi8(s, zero);
+				const __m512i sHi = _mm512_unpackhi_epi8(s, zero);
+				const __m512i aLo = div255Epu16Avx512(_mm512_mullo_epi16(broadcastAlphaAvx512(sLo), opacity16));
+				const __m512i aHi = div255Epu16Avx512(_mm512_mullo_epi16(broadcastAlphaAvx512(sHi), opacity16));
+
+				const __m512i lo =
+						blendNormal16(_mm512_unpacklo_epi8(d, zero), _mm512_unpacklo_epi8(sOpaque, zero), aLo);
+				const __m512i hi =
+						blendNormal16(_mm512_unpackhi_epi8(d, zero), _mm512_unpackhi_epi8(sOpaque, zero), aHi);
+				_mm512_storeu_si512(dst + i, _mm512_packus_epi16(lo, hi));
+			}
+			blendRowNormalAvx2(dst + i, src + i, count - i, opacity);
+		}
+
+		PXR_TARGET(PXR_AVX512) void blendRowAddAvx512(uint32_t *dst, const uint32_t *src, int count,
+													  uint8_t opacity) {
+			const __m512i zero = _mm512_setzero_si512();
+			const __m512i colorMask = _mm512_set1_epi32(0x00FFFFFF);
+			const __m512i opacity16 = _mm512_set1_epi16(opacity);
+			int i = 0;
+			for (; i + 16 <= count; i += 16) {
+				const __m512i s = _mm512_loadu_si512(src + i);
+				const __m512i d = _mm512_loadu_si512(dst + i);
+
+				const __m512i sLo = _mm512_unpacklo_epi8(s, zero);
+				const __m512i sHi = _mm512_unpackhi_epi8(s, zero);
+				const __m512i aLo = div255Epu16Avx512(_mm512_mullo_epi16(broadcastAlphaAvx512(sLo), opacity16));
+				const __m512i aHi = div255Epu16Avx512(_mm512_mullo_epi16(broadcastAlphaAvx512(sHi), opacity16));
+
+				const __m512i scaled = _mm512_packus_epi16(div255Epu16Avx512(_mm512_mullo_epi16(sLo, aLo)),
+														   div255Epu16Avx512(_mm512_mullo_epi16(sHi, aHi)));
+				_mm512_storeu_si512(dst + i, _mm512_adds_epu8(d, _mm512_and_si512(scaled, colorMask)));
+			}
+			blendRowAddAvx2(dst + i, src + i, count - i, opacity);
+		}
+
+		PXR_TARGET(PXR_AVX512) void blendRowAvx512(uint32_t *dst, const uint32_t *src, int count, uint8_t opacity,
+												   BlendMode mode) {
+			switch (mode) {
+				case BlendMode::Normal:
+					blendRowNormalAvx512(dst, src, count, opacity);
+					break;
+				case BlendMode::Add:
+					blendRowAddAvx512(dst, src, count, opacity);
+					break;
+				default:
+					scalarKernels().blendRow(dst, src, count, opacity, mode);
+					break;
+			}
+		}
+
+		PXR_TARGET(PXR_AVX512) void swapRedBlueRowAvx512(uint32_t *dst, const uint32_t *src, int count) {
+			const __m512i order = _mm512_broadcast_i32x4(
+					_mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15));
+			int i = 0;
+			for (; i + 16 <= count; i += 16) {
+				_mm512_storeu_si512(dst + i, _mm512_shuffle_epi8(_mm512_loadu_si512(src + i), order));
+			}
+			if (i < count) {
+				const __mmask16 mask = tailMask(count - i);
+				const __m512i s = _mm512_maskz_loadu_epi32(mask, src + i);
+				_mm512_mask_storeu_epi32(dst + i, mask, _mm512_shuffle_epi8(s, order));
+			}
+		}
+
+		template <int GreenBits>
+		PXR_TARGET(PXR_AVX512) inline __m512i toRgb16Avx512(__m512i s) {
+			using Format = Rgb16<GreenBits>;
+			const __m512i r = _mm512_srli_epi32(_mm512_and_si512(s, _mm512_set1_epi32(0xF80000)), Format::RedShift);
+			const __m512i g =
+					_mm512_srli_epi32(_mm512_and_si512(s, _mm512_set1_epi32(Format::GreenMask)), Format::GreenShift);
+			const __m512i b = _mm512_srli_epi32(_mm512_and_si512(s, _mm512_set1_epi32(0x0000F8)), 3);
+			return _mm512_or_si512(_mm512_or_si512(r, g), b);
+		}
+
+		template <int GreenBits>
+		PXR_TARGET(PXR_AVX512) void packRgb16RowAvx512(uint16_t *dst, const uint32_t *src, int count) {
+			int i = 0;
+			for (; i + 16 <= count; i += 16) {
+				const __m512i v = toRgb16Avx512<GreenBits>(_mm512_loadu_si512(src + i));
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm512_cvtepi32_epi16(v));
+			}
+			if (i < count) {
+				const __mmask16 mask = tailMask(count - i);
+				const __m512i v = toRgb16Avx512<GreenBits>(_mm512_maskz_loadu_epi32(mask, src + i));
+				_mm512_mask_cvtepi32_storeu_epi16(dst + i, mask, v);
+			}
+		}
+
+		PXR_TARGET(PXR_AVX512) uint64_t hashRowAvx512(const uint32_t *src, int count, uint64_t seed) {
+			alignas(64) uint64_t lanes[HashLanes];
+			for (int lane = 0; lane < HashLanes; ++lane) {
+				lanes[lane] = hashLaneStart(seed, lane);
+			}
+			const __m512i primeLow = _mm512_set1_epi64(0x1B3);
+			__m512i state = _mm512_load_si512(lanes);
+			int i = 0;
+			for (; i + HashLanes <= count; i += HashLanes) {
+				const auto *chunk = reinterpret_cast<const __m256i *>(src + i);
+				const __m512i pixels = _mm512_cvtepu32_epi64(_mm256_loadu_si256(chunk));
+				const __m512i h = _mm512_xor_si512(state, pixels);
+				const __m512i low = _mm512_mul_epu32(h, primeLow);
+				const __m512i high = _mm512_slli_epi64(_mm512_mul_epu32(_mm512_srli_epi64(h, 32), primeLow), 32);
+				state = _mm512_add_epi64(_mm512_add_epi64(low, high), _mm512_slli_epi64(h, 40));
+			}
+			_mm512_store_si512(lanes, state);
+			hashLanes(lanes, src, i, count);
+			return hashFinish(lanes, count, seed);
+		}
+
+	} // namespace
+
+	const KernelTable *sse2Kernels() {
+		static const KernelTable table = [] {
+			KernelTable kernels = scalarKernels();
+			kernels.name = "sse2";
+			kernels.blendRow = blendRowSse2;
+			kernels.scaleRow = scaleRowSse2;
+			kernels.swapRedBlueRow = swapRedBlueRowSse2;
+			kernels.packRgb565Row = packRgb16RowSse2<6>;
+			kernels.packRgb555Row = packRgb16RowSse2<5>;
+			kernels.packGrey8Row = packGrey8RowSse2;
+			kernels.packRgbaF32Row = packRgbaF32RowSse2;
+			kernels.unpackRgb565Row = unpackRgb16RowSse2<6>;
+			kernels.unpackRgb555Row = unpackRgb16RowSse2<5>;
+			kernels.unpackGrey8Row = unpackGrey8RowSse2;
+			kernels.unpackRgbaF32Row = unpackRgbaF32RowSse2;
+			kernels.premultiplyRow = premultiplyRowSse2;
+			kernels.packYuvRows = packYuvRowsSse2;
+			kernels.unpackYuvRow = unpackYuvRowSse2;
+			kernels.hashRow = hashRowSse2;
+			return kernels;
+		}();
+		return &table;
+	}
+
+	const KernelTable *avx2Kernels() {
+		static const KernelTable table = [] {
+			KernelTable kernels = *sse2Kernels();
+			kernels.name = "avx2";
+			kernels.fillRow = fillRowAvx2;
+			kernels.blendRow = blendRowAvx2;
+			kernels.swapRedBlueRow = swapRedBlueRowAvx2;
+			kernels.packRgb565Row = packRgb16RowAvx2<6>;
+			kernels.packRgb555Row = packRgb16RowAvx2<5>;
+			kernels.packBgr24Row = packBgr24RowAvx2;
+			kernels.packRgb24Row = packRgb24RowAvx2;
+			kernels.unpackBgr24Row = unpackBgr24RowAvx2;
+			kernels.unpackRgb24Row = unpackRgb24RowAvx2;
+			kernels.hashRow = hashRowAvx2;
+			return kernels;
+		}();
+		return &table;
+	}
+
+	const KernelTable *avx512Kernels() {
+		static const KernelTable table = [] {
+			KernelTable kernels = *avx2Kernels();
+			kernels.name = "avx512";
+			kernels.fillRow = fillRowAvx512;
+			kernels.blendRow = blendRowAvx512;
+			kernels.swapRedBlueRow = swapRedBlueRowAvx512;
+			kernels.packRgb565Row = packRgb16RowAvx512<6>;
+			kernels.packRgb555Row = packRgb16RowAvx512<5>;
+			kernels.hashRow = hashRowAvx512;
+			return kernels;
+		}();
+		return &table;
+	}
+
+} // namespace pxr::kernels
+
+#else
+
+namespace pxr::kernels {
+
+	const KernelTable *sse2Kernels() { return nullptr; }
+
+	const KernelTable *avx2Kernels() { return nullptr; }
+
+	const KernelTable *avx512Kernels() { return nullptr; }
+
+} // namespace pxr::kernels
+
+#endif
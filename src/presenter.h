@@ -0,0 +1,72 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <optional>
+#include "pxr/surface.h"
+#include "pxr/types.h"
+
+namespace pxr {
+
+	class Graphics;
+	class Window;
+
+	/**
+	 * @brief Puts the app's frames on screen.
+	 *
+	 * The app feeds changed regions of the presented surface through upload(),
+	 * possibly spread over several frames by the upload scheduler, and calls
+	 * present() once per frame.
+	 */
+	class Presenter {
+	public:
+		virtual ~Presenter() = default;
+
+		/**
+		 * @brief Prepares presentation for a window that has already been created.
+		 * @param window The output window.
+		 * @param surface The surface whose dimensions define the frame size.
+		 * @param pixelSize Integer scale from surface pixels to window pixels.
+		 */
+		virtual void initialize(Window &window, const Surface &surface, int pixelSize) = 0;
+
+		/**
+		 * @brief Copies a region of a frame into the presenter's back buffer.
+		 * @param surface The frame, with the dimensions passed to initialize().
+		 * @param rect Region to copy, in surface pixels.
+		 */
+		virtual void upload(const Surface &surface, const Rect &rect) = 0;
+
+		/**
+		 * @brief Shows the back buffer.
+		 */
+		virtual void present() = 0;
+
+		/**
+		 * @brief Returns how long until output held back by the presenter can be shown.
+		 *
+		 * Presenters that limit their output rate keep changes made too soon
+		 * and send them with a later present(). An app rendering on demand
+		 * presents again once this time has passed, even without new changes.
+		 *
+		 * @return 0 if held-back output can go out now, nothing if none is held back.
+		 */
+		[[nodiscard]] virtual std::optional<double> getSecondsUntilFlush() const { return std::nullopt; }
+
+		/**
+		 * @brief Returns the OpenGL graphics backend, if the presenter has one.
+		 *
+		 * GPU compositing of layers and asynchronous frame readback are only
+		 * available through it.
+		 */
+		[[nodiscard]] virtual Graphics *getGraphics() { return nullptr; }
+	};
+
+} // namespace pxr
@@ -0,0 +1,141 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "pxr/profiler.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+namespace pxr {
+
+	namespace {
+
+		/// Adds a visit, or the totals of another thread's zone, to the matching entry of a list.
+		void accumulate(std::vector<ProfileZoneStats> &zones, const ProfileZoneStats &sample) {
+			// Zones are few; a linear scan beats hashing and compares pointers before falling back to strcmp().
+			auto it = std::find_if(zones.begin(), zones.end(), [&sample](const ProfileZoneStats &stats) {
+				return stats.name == sample.name || std::strcmp(stats.name, sample.name) == 0;
+			});
+			if (it == zones.end()) {
+				it = zones.insert(zones.end(), ProfileZoneStats{sample.name});
+			}
+			it->count += sample.count;
+			it->totalSeconds += sample.totalSeconds;
+			it->maxSeconds = std::max(it->maxSeconds, sample.maxSeconds);
+		}
+
+		/// Totals recorded by one thread. Its lock is only contended while a report is taken.
+		struct ThreadZones {
+			std::mutex mutex;
+			std::vector<ProfileZoneStats> zones;
+		};
+
+		/// Every thread that entered a zone, and the totals of threads that have exited.
+		struct Registry {
+			std::mutex mutex;
+			std::vector<std::shared_ptr<ThreadZones>> threads;
+			std::vector<ProfileZoneStats> retired;
+		};
+
+		Registry &registry() {
+			static Registry instance;
+			return instance;
+		}
+
+		/// Registers the calling thread's totals on first use and folds them into the retired ones on exit.
+		struct ThreadZonesHandle {
+			std::shared_ptr<ThreadZones> zones = std::make_shared<ThreadZones>();
+
+			ThreadZonesHandle() {
+				Registry &shared = registry();
+				std::lock_guard lock(shared.mutex);
+				shared.threads.push_back(zones);
+			}
+
+			~ThreadZonesHandle() {
+				Registry &shared = registry();
+				std::lock_guard lock(shared.mutex);
+				for (const ProfileZoneStats &zone: zones->zones) {
+					accumulate(shared.retired, zone);
+				}
+				std::erase(shared.threads, zones);
+			}
+		};
+
+		ThreadZones &threadZones() {
+			thread_local ThreadZonesHandle handle;
+			return *handle.zones;
+		}
+
+		/// Innermost zone of each thread.
+		thread_local ProfileZone *currentZone = nullptr;
+
+	} // namespace
+
+	ProfileZone::ProfileZone(const char *name) :
+		name(name), parent(currentZone), start(std::chrono::steady_clock::now()) {
+		currentZone = this;
+	}
+
+	ProfileZone::~ProfileZone() {
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		currentZone = parent;
+
+		ThreadZones &zones = threadZones();
+		std::lock_guard lock(zones.mutex);
+		accumulate(zones.zones, ProfileZoneStats{name, 1, elapsed.count(), elapsed.count()});
+	}
+
+	const char *ProfileZone::getName() const { return name; }
+
+	const ProfileZone *ProfileZone::getCurrent() { return currentZone; }
+
+	namespace profiler {
+
+		std::vector<ProfileZoneStats> getZones() {
+			Registry &shared = registry();
+			std::lock_guard lock(shared.mutex);
+			std::vector<ProfileZoneStats> zones = shared.retired;
+			for (const auto &thread: shared.threads) {
+				std::lock_guard threadLock(thread->mutex);
+				for (const ProfileZoneStats &zone: thread->zones) {
+					accumulate(zones, zone);
+				}
+			}
+			return zones;
+		}
+
+		void reset() {
+			Registry &shared = registry();
+			std::lock_guard lock(shared.mutex);
+			shared.retired.clear();
+			for (const auto &thread: shared.threads) {
+				std::lock_guard threadLock(thread->mutex);
+				thread->zones.clear();
+			}
+		}
+
+		std::string formatReport() {
+			std::string report = "zone                          count    total ms      avg ms      max ms\n";
+			char line[160];
+			for (const ProfileZoneStats &zone: getZones()) {
+				std::snprintf(line, sizeof(line), "%-28s %6llu %11.3f %11.3f %11.3f\n", zone.name,
+							  static_cast<unsigned long long>(zone.count), zone.totalSeconds * 1000.0,
+							  zone.totalSeconds * 1000.0 / static_cast<double>(zone.count), zone.maxSeconds * 1000.0);
+				report += line;
+			}
+			return report;
+		}
+
+	} // namespace profiler
+
+} // namespace pxr
@@ -0,0 +1,181 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "program_cache.h"
+#include "gl_includes.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace pxr {
+
+	namespace {
+
+		/// Identifies cache files and their layout; bump when the layout changes.
+		constexpr uint32_t CacheMagic = 0x31425850; // "PXB1"
+
+		/// Header preceding the binary in a cache file.
+		struct CacheHeader {
+			uint32_t magic; ///< CacheMagic.
+			uint32_t format; ///< Binary format reported by the driver.
+			uint32_t length; ///< Binary size in bytes.
+		};
+
+		/// FNV-1a, continued from a previous hash.
+		uint64_t hashString(std::string_view text, uint64_t hash = 0xCBF29CE484222325ull) {
+			for (const char c: text) {
+				hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001B3ull;
+			}
+			return hash;
+		}
+
+		/// Returns the directory selected by PXR_SHADER_CACHE or the platform's cache location, or an empty path.
+		std::filesystem::path findCacheDirectory() {
+			if (const char *env = std::getenv("PXR_SHADER_CACHE")) {
+				return std::string_view(env) == "0" ? std::filesystem::path() : std::filesystem::path(env);
+			}
+			std::filesystem::path base;
+#if defined(_WIN32)
+			if (const char *local = std::getenv("LOCALAPPDATA")) {
+				base = local;
+			}
+#elif defined(__APPLE__)
+			if (const char *home = std::getenv("HOME")) {
+				base = std::filesystem::path(home) / "Library" / "Caches";
+			}
+#else
+			if (const char *xdg = std::getenv("XDG_CACHE_HOME"); xdg && *xdg) {
+				base = xdg;
+			} else if (const char *home = std::getenv("HOME")) {
+				base = std::filesystem::path(home) / ".cache";
+			}
+#endif
+			return base.empty() ? base : base / "pixel_runtime" / "shaders";
+		}
+
+		/// Returns a GL string, or an empty one if the driver reports none.
+		std::string glString(GLenum name) {
+			const auto *value = reinterpret_cast<const char *>(glGetString(name));
+			return value ? value : "";
+		}
+
+	} // namespace
+
+	ProgramCache::ProgramCache() {
+		if (!GLAD_GL_ARB_get_program_binary) {
+			return;
+		}
+		int formats = 0;
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+		if (formats <= 0) {
+			return; // Some drivers, macOS among them, expose the entry points without any format.
+		}
+		directory = findCacheDirectory();
+		driver = glString(GL_VENDOR) + '\n' + glString(GL_RENDERER) + '\n' + glString(GL_VERSION);
+	}
+
+	std::string ProgramCache::makeKey(const char *vertexSrc, const char *fragmentSrc) const {
+		if (directory.empty()) {
+			return {};
+		}
+		const uint64_t hash = hashString(fragmentSrc, hashString(vertexSrc, hashString(driver)));
+		char key[17];
+		std::snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(hash));
+		return key;
+	}
+
+	unsigned int ProgramCache::load(const std::string &key) const {
+		if (key.empty()) {
+			return 0;
+		}
+		const std::filesystem::path path = directory / (key + ".bin");
+		std::ifstream file(path, std::ios::binary);
+		CacheHeader header{};
+		if (!file.read(reinterpret_cast<char *>(&header), sizeof(header)) || header.magic != CacheMagic) {
+			return 0;
+		}
+		// A truncated or corrupt entry must not size the buffer: it would allocate up to 4 GiB for nothing.
+		std::error_code error;
+		const auto fileSize = std::filesystem::file_size(path, error);
+		if (error || fileSize != sizeof(header) + header.length) {
+			return 0;
+		}
+		std::vector<char> binary(header.length);
+		if (!file.read(binary.data(), static_cast<std::streamsize>(binary.size()))) {
+			return 0;
+		}
+
+		const unsigned int program = glCreateProgram();
+		glProgramBinary(program, header.format, binary.data(), static_cast<GLsizei>(binary.size()));
+		int success = 0;
+		glGetProgramiv(program, GL_LINK_STATUS, &success);
+		if (!success) {
+			glDeleteProgram(program); // Stale or foreign binary; the caller rebuilds and overwrites it.
+			while (glGetError() != GL_NO_ERROR) {
+				// An unknown format also raises an error; clear it so it is not blamed on later calls.
+			}
+			return 0;
+		}
+		return program;
+	}
+
+	void ProgramCache::prepare(unsigned int program) const {
+		if (!directory.empty()) {
+			glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+		}
+	}
+
+	void ProgramCache::store(const std::string &key, unsigned int program) const {
+		if (key.empty()) {
+			return;
+		}
+		int length = 0;
+		glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+		if (length <= 0) {
+			return;
+		}
+		std::vector<char> binary(length);
+		CacheHeader header{CacheMagic, 0, 0};
+		GLsizei written = 0;
+		glGetProgramBinary(program, length, &written, &header.format, binary.data());
+		header.length = static_cast<uint32_t>(written);
+
+		std::error_code ec;
+		std::filesystem::create_directories(directory, ec);
+		// Apps starting at the same time may store the same key; each writes its own file and renames it into place.
+		const auto unique = std::hash<std::thread::id>()(std::this_thread::get_id()) ^
+							static_cast<size_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+		const std::filesystem::path target = directory / (key + ".bin");
+		const std::filesystem::path temporary = directory / (key + "." + std::to_string(unique) + ".tmp");
+		{
+			std::ofstream file(temporary, std::ios::binary);
+			file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+			file.write(binary.data(), written);
+			if (!file) {
+				file.close();
+				std::filesystem::remove(temporary, ec);
+				return;
+			}
+		}
+		std::filesystem::rename(temporary, target, ec);
+		if (ec) {
+			std::filesystem::remove(temporary, ec);
+		}
+	}
+
+} // namespace pxr
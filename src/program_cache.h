@@ -0,0 +1,63 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+
+namespace pxr {
+
+	/**
+	 * @brief Keeps linked shader programs on disk so later runs skip compiling them.
+	 *
+	 * Programs are stored with `glGetProgramBinary()` under a key derived from
+	 * their sources and the driver's vendor, renderer and version strings, so a
+	 * driver update simply misses the cache. A binary the driver rejects is
+	 * ignored and replaced after the program is rebuilt.
+	 *
+	 * The cache lives in the user's cache directory (`$XDG_CACHE_HOME`,
+	 * `~/Library/Caches` or `%LOCALAPPDATA%`, under `pixel_runtime/shaders`).
+	 * `PXR_SHADER_CACHE` selects another directory, or disables the cache when
+	 * set to `0`. It is also disabled when the driver offers no binary formats.
+	 */
+	class ProgramCache {
+	public:
+		/**
+		 * @brief Prepares the cache for the current OpenGL context.
+		 */
+		ProgramCache();
+
+		/**
+		 * @brief Returns the key identifying a program built from the given sources.
+		 */
+		[[nodiscard]] std::string makeKey(const char *vertexSrc, const char *fragmentSrc) const;
+
+		/**
+		 * @brief Creates a program from a stored binary.
+		 * @return The linked program, or 0 if it is not cached or the driver rejected it.
+		 */
+		unsigned int load(const std::string &key) const;
+
+		/**
+		 * @brief Asks the driver to keep the binary of a program about to be linked.
+		 */
+		void prepare(unsigned int program) const;
+
+		/**
+		 * @brief Stores the binary of a linked program; failures are ignored.
+		 */
+		void store(const std::string &key, unsigned int program) const;
+
+	private:
+		std::filesystem::path directory; ///< Where binaries are kept; empty when disabled.
+		std::string driver; ///< Vendor, renderer and version, part of every key.
+	};
+
+} // namespace pxr
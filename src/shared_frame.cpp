@@ -0,0 +1,177 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "pxr/shared_frame.h"
+
+#include <limits>
+#include <new>
+#include "error_handling.h"
+#include "pixel_kernels.h"
+#include "shared_memory.h"
+
+namespace pxr {
+
+	namespace {
+
+		constexpr size_t HeaderSize = 64;
+		constexpr uint64_t NoSlot = std::numeric_limits<uint64_t>::max();
+
+		static_assert(sizeof(SharedFrameHeader) <= HeaderSize, "Shared frame header exceeds its reserved space.");
+		static_assert(sizeof(SharedFrameSlot) <= SharedFrameSlot::PixelOffset, "Slot header overlaps pixel data.");
+
+		size_t alignUp(size_t value, size_t alignment) { return (value + alignment - 1) / alignment * alignment; }
+
+		uint8_t *slotBase(const SharedMemory &memory, const SharedFrameHeader *header, uint64_t index) {
+			return static_cast<uint8_t *>(memory.data()) + HeaderSize + index * header->slotStride;
+		}
+
+	} // namespace
+
+	//--------------------------------------------------------------------------
+	// Writer
+	//--------------------------------------------------------------------------
+
+	SharedFrameWriter::SharedFrameWriter(const std::string &name, int width, int height, int slotCount) :
+		slotDamage(slotCount, Rect{0, 0, width, height}) {
+		PXR_ASSERT(width > 0 && height > 0, "Shared frame dimensions must be positive.");
+		PXR_ASSERT(slotCount >= 2, "A shared frame ring needs at least two slots.");
+
+		const size_t slotStride =
+				alignUp(SharedFrameSlot::PixelOffset + static_cast<size_t>(width) * height * sizeof(uint32_t), 64);
+		memory = std::make_unique<SharedMemory>(SharedMemory::create(name, HeaderSize + slotStride * slotCount));
+
+		// Fresh shared memory is zero-filled: every slot sequence starts at 0 (even, empty).
+		header = new (memory->data()) SharedFrameHeader{};
+		header->width = static_cast<uint32_t>(width);
+		header->height = static_cast<uint32_t>(height);
+		header->slotCount = static_cast<uint32_t>(slotCount);
+		header->slotStride = slotStride;
+		header->latestSlot.store(NoSlot, std::memory_order_relaxed);
+		header->publishedFrames.store(0, std::memory_order_relaxed);
+		for (int i = 0; i < slotCount; ++i) {
+			new (slotBase(*memory, header, i)) SharedFrameSlot{};
+		}
+		header->version = SharedFrameHeader::Version;
+		std::atomic_thread_fence(std::memory_order_release);
+		header->magic = SharedFrameHeader::Magic;
+	}
+
+	SharedFrameWriter::~SharedFrameWriter() = default;
+
+	void SharedFrameWriter::publish(const Surface &surface, const Rect &damage, uint64_t frameNumber) {
+		const int width = static_cast<int>(header->width);
+		const int height = static_cast<int>(header->height);
+		PXR_ASSERT(surface.getWidth() == width && surface.getHeight() == height, "Shared frame size mismatch.");
+
+		// Every slot now lacks the new damage; the slot about to be written catches up on all it missed.
+		for (auto &missing: slotDamage) {
+			missing = missing.united(damage);
+		}
+		const uint32_t index = nextSlot;
+		const Rect rows = slotDamage[index].intersected(Rect{0, 0, width, height});
+		slotDamage[index] = Rect{};
+		nextSlot = (nextSlot + 1) % header->slotCount;
+
+		uint8_t *base = slotBase(*memory, header, index);
+		auto *slot = reinterpret_cast<SharedFrameSlot *>(base);
+		auto *pixels = reinterpret_cast<uint32_t *>(base + SharedFrameSlot::PixelOffset);
+
+		const uint64_t sequence = slot->sequence.load(std::memory_order_relaxed);
+		slot->sequence.store(sequence + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		if (!rows.isEmpty()) {
+			// Whole rows are contiguous, which beats copying the damaged columns row by row.
+			kernels::copyRow(pixels + rows.y * width, surface.data() + rows.y * width, rows.height * width);
+		}
+		slot->frameNumber = frameNumber;
+
+		slot->sequence.store(sequence + 2, std::memory_order_release);
+		header->latestSlot.store(index, std::memory_order_release);
+		header->publishedFrames.fetch_add(1, std::memory_order_release);
+	}
+
+	const std::string &SharedFrameWriter::getName() const { return memory->getName(); }
+
+	//--------------------------------------------------------------------------
+	// Reader
+	//--------------------------------------------------------------------------
+
+	SharedFrameReader::SharedFrameReader(const std::string &name) :
+		memory(std::make_unique<SharedMemory>(SharedMemory::open(name, false))) {
+		PXR_ASSERT(memory->size() >= HeaderSize, "Shared memory object is too small for a frame ring.");
+
+		header = static_cast<const SharedFrameHeader *>(memory->data());
+		PXR_ASSERT(header->magic == SharedFrameHeader::Magic, "Shared memory object is not a frame ring.");
+		std::atomic_thread_fence(std::memory_order_acquire);
+		PXR_ASSERT(header->version == SharedFrameHeader::Version, "Unsupported shared frame ring version.");
+		PXR_ASSERT(HeaderSize + header->slotStride * header->slotCount <= memory->size(),
+				   "Shared frame ring is truncated.");
+	}
+
+	SharedFrameReader::~SharedFrameReader() = default;
+
+	int SharedFrameReader::getWidth() const { return static_cast<int>(header->width); }
+
+	int SharedFrameReader::getHeight() const { return static_cast<int>(header->height); }
+
+	const SharedFrameSlot *SharedFrameReader::slotAt(uint64_t index) const {
+		return reinterpret_cast<const SharedFrameSlot *>(slotBase(*memory, header, index % header->slotCount));
+	}
+
+	bool SharedFrameReader::acquireLatest(SharedFrameView &view) const {
+		for (;;) {
+			const uint64_t index = header->latestSlot.load(std::memory_order_acquire);
+			if (index == NoSlot) {
+				return false;
+			}
+
+			const SharedFrameSlot *slot = slotAt(index);
+			const uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+			if (sequence & 1) {
+				continue; // The producer lapped the ring and is rewriting this slot; pick the new latest.
+			}
+
+			view.pixels = reinterpret_cast<const uint32_t *>(reinterpret_cast<const uint8_t *>(slot) +
+															  SharedFrameSlot::PixelOffset);
+			view.width = getWidth();
+			view.height = getHeight();
+			view.frameNumber = slot->frameNumber;
+			view.sequence = sequence;
+			view.slot = static_cast<uint32_t>(index);
+			if (isStillValid(view)) {
+				return true;
+			}
+		}
+	}
+
+	bool SharedFrameReader::isStillValid(const SharedFrameView &view) const {
+		std::atomic_thread_fence(std::memory_order_acquire);
+		return slotAt(view.slot)->sequence.load(std::memory_order_relaxed) == view.sequence;
+	}
+
+	bool SharedFrameReader::readInto(Surface &target, uint64_t *frameNumber) const {
+		PXR_ASSERT(target.getWidth() == getWidth() && target.getHeight() == getHeight(), "Target size mismatch.");
+
+		SharedFrameView view;
+		do {
+			if (!acquireLatest(view)) {
+				return false;
+			}
+			kernels::copyRow(target.data(), view.pixels, view.width * view.height);
+		} while (!isStillValid(view));
+
+		target.markDirty();
+		if (frameNumber) {
+			*frameNumber = view.frameNumber;
+		}
+		return true;
+	}
+
+} // namespace pxr
@@ -0,0 +1,125 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "shared_input.h"
+
+#include <bit>
+#include <new>
+#include "error_handling.h"
+#include "shared_memory.h"
+
+namespace pxr {
+
+	namespace {
+
+		SharedInputEvent *eventsOf(const SharedMemory &memory) {
+			return reinterpret_cast<SharedInputEvent *>(static_cast<uint8_t *>(memory.data()) +
+														SharedInputHeader::EventOffset);
+		}
+
+	} // namespace
+
+	//--------------------------------------------------------------------------
+	// Writer
+	//--------------------------------------------------------------------------
+
+	SharedInputWriter::SharedInputWriter(const std::string &name) :
+		memory(std::make_unique<SharedMemory>(SharedMemory::open(name, true))) {
+		PXR_ASSERT(memory->size() >= SharedInputHeader::EventOffset,
+				   "Shared memory object is too small for an input ring.");
+
+		header = static_cast<SharedInputHeader *>(memory->data());
+		PXR_ASSERT(header->magic == SharedInputHeader::Magic, "Shared memory object is not an input ring.");
+		std::atomic_thread_fence(std::memory_order_acquire);
+		PXR_ASSERT(header->version == SharedInputHeader::Version, "Unsupported shared input ring version.");
+		const size_t ringSize = SharedInputHeader::EventOffset + header->capacity * sizeof(SharedInputEvent);
+		PXR_ASSERT(std::has_single_bit(header->capacity) && ringSize <= memory->size(),
+				   "Shared input ring is truncated.");
+		events = eventsOf(*memory);
+	}
+
+	SharedInputWriter::~SharedInputWriter() = default;
+
+	bool SharedInputWriter::push(const SharedInputEvent &event) {
+		const uint64_t head = header->head.load(std::memory_order_relaxed);
+		if (head - header->tail.load(std::memory_order_acquire) >= header->capacity) {
+			return false;
+		}
+		events[head & (header->capacity - 1)] = event;
+		header->head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool SharedInputWriter::pressKey(KeyCode key) {
+		return push({SharedInputType::Key, 1, static_cast<int32_t>(key), 0, 0});
+	}
+
+	bool SharedInputWriter::releaseKey(KeyCode key) {
+		return push({SharedInputType::Key, 0, static_cast<int32_t>(key), 0, 0});
+	}
+
+	bool SharedInputWriter::pressMouse(MouseButton button) {
+		return push({SharedInputType::MouseButton, 1, static_cast<int32_t>(button), 0, 0});
+	}
+
+	bool SharedInputWriter::releaseMouse(MouseButton button) {
+		return push({SharedInputType::MouseButton, 0, static_cast<int32_t>(button), 0, 0});
+	}
+
+	bool SharedInputWriter::moveMouse(int x, int y) { return push({SharedInputType::MouseMove, 0, 0, x, y}); }
+
+	//--------------------------------------------------------------------------
+	// Source
+	//--------------------------------------------------------------------------
+
+	SharedInputSource::SharedInputSource(const std::string &name, int capacity) {
+		PXR_ASSERT(capacity > 0, "Shared input capacity must be positive.");
+
+		slots = std::bit_ceil(static_cast<uint32_t>(capacity));
+		memory = std::make_unique<SharedMemory>(
+				SharedMemory::create(name, SharedInputHeader::EventOffset + slots * sizeof(SharedInputEvent)));
+
+		header = new (memory->data()) SharedInputHeader{};
+		header->capacity = slots;
+		header->head.store(0, std::memory_order_relaxed);
+		header->tail.store(0, std::memory_order_relaxed);
+		header->version = SharedInputHeader::Version;
+		std::atomic_thread_fence(std::memory_order_release);
+		header->magic = SharedInputHeader::Magic;
+		events = eventsOf(*memory);
+	}
+
+	SharedInputSource::~SharedInputSource() = default;
+
+	void SharedInputSource::poll(Input &input) {
+		const uint64_t head = header->head.load(std::memory_order_acquire);
+		uint64_t tail = header->tail.load(std::memory_order_relaxed);
+		if (head - tail > slots) {
+			// The writer lapped the reader, or a counter was corrupted: only the last ring's worth is still there.
+			tail = head - slots;
+		}
+
+		for (; tail != head; ++tail) {
+			const SharedInputEvent event = events[tail & (slots - 1)];
+			switch (event.type) {
+				case SharedInputType::Key:
+					input.setKey(event.code, event.pressed != 0);
+					break;
+				case SharedInputType::MouseButton:
+					input.setMouseButton(event.code, event.pressed != 0);
+					break;
+				case SharedInputType::MouseMove:
+					input.setMousePosition(event.x, event.y);
+					break;
+			}
+		}
+		header->tail.store(tail, std::memory_order_release);
+	}
+
+} // namespace pxr
@@ -0,0 +1,48 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "input.h"
+#include "pxr/shared_input.h"
+
+namespace pxr {
+
+	/**
+	 * @brief Input source draining a shared-memory event ring written by another process.
+	 *
+	 * The ring is created when the source is constructed and unlinked when it is
+	 * destroyed. Events are applied in order during poll(). The header is
+	 * writable by other processes, so poll() never trusts its capacity and
+	 * reads at most one ring's worth of events per call.
+	 */
+	class SharedInputSource final : public InputSource {
+	public:
+		/**
+		 * @brief Creates (or replaces) a shared input ring.
+		 * @param name Shared-memory object name, e.g. "/my_app_input".
+		 * @param capacity Number of event slots; rounded up to a power of two.
+		 */
+		SharedInputSource(const std::string &name, int capacity);
+
+		~SharedInputSource() override;
+
+		void poll(Input &input) override;
+
+	private:
+		std::unique_ptr<class SharedMemory> memory; ///< Mapped shared-memory object.
+		SharedInputHeader *header = nullptr; ///< Ring header inside the mapping.
+		const SharedInputEvent *events = nullptr; ///< Event slots inside the mapping.
+		uint32_t slots = 0; ///< Ring size chosen here; the header copy may be changed by other processes.
+	};
+
+} // namespace pxr
@@ -0,0 +1,120 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "shared_memory.h"
+
+#include <utility>
+#include "error_handling.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace pxr {
+
+	namespace {
+
+		/// POSIX requires shared-memory names to start with a slash.
+		std::string normalizeName(const std::string &name) { return name.starts_with('/') ? name : "/" + name; }
+
+	} // namespace
+
+	SharedMemory SharedMemory::create(const std::string &name, size_t size) {
+		SharedMemory shm;
+		shm.name = normalizeName(name);
+#ifdef _WIN32
+		(void) size;
+		PXR_ASSERT(false, "Shared memory requires a POSIX system.");
+#else
+		shm_unlink(shm.name.c_str());
+		const int fd = shm_open(shm.name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+		PXR_ASSERT(fd >= 0, "shm_open() failed to create a shared-memory object.");
+
+		void *mapping = MAP_FAILED;
+		if (ftruncate(fd, static_cast<off_t>(size)) == 0) {
+			mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		}
+		close(fd);
+		if (mapping == MAP_FAILED) {
+			shm_unlink(shm.name.c_str());
+		}
+		PXR_ASSERT(mapping != MAP_FAILED, "Failed to size or map a shared-memory object.");
+
+		shm.mapping = mapping;
+		shm.mappingSize = size;
+		shm.owner = true;
+#endif
+		return shm;
+	}
+
+	SharedMemory SharedMemory::open(const std::string &name, bool writable) {
+		SharedMemory shm;
+		shm.name = normalizeName(name);
+#ifdef _WIN32
+		(void) writable;
+		PXR_ASSERT(false, "Shared memory requires a POSIX system.");
+#else
+		const int fd = shm_open(shm.name.c_str(), writable ? O_RDWR : O_RDONLY, 0);
+		PXR_ASSERT(fd >= 0, "Shared-memory object not found. Is the owning process running?");
+
+		struct stat info {};
+		void *mapping = MAP_FAILED;
+		if (fstat(fd, &info) == 0 && info.st_size > 0) {
+			shm.mappingSize = static_cast<size_t>(info.st_size);
+			mapping = mmap(nullptr, shm.mappingSize, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+		}
+		close(fd);
+		PXR_ASSERT(mapping != MAP_FAILED, "Failed to map a shared-memory object.");
+
+		shm.mapping = mapping;
+#endif
+		return shm;
+	}
+
+	SharedMemory::~SharedMemory() { release(); }
+
+	SharedMemory::SharedMemory(SharedMemory &&other) noexcept :
+		name(std::move(other.name)), mapping(std::exchange(other.mapping, nullptr)),
+		mappingSize(std::exchange(other.mappingSize, 0)), owner(std::exchange(other.owner, false)) {}
+
+	SharedMemory &SharedMemory::operator=(SharedMemory &&other) noexcept {
+		if (this != &other) {
+			release();
+			name = std::move(other.name);
+			mapping = std::exchange(other.mapping, nullptr);
+			mappingSize = std::exchange(other.mappingSize, 0);
+			owner = std::exchange(other.owner, false);
+		}
+		return *this;
+	}
+
+	void *SharedMemory::data() const { return mapping; }
+
+	size_t SharedMemory::size() const { return mappingSize; }
+
+	const std::string &SharedMemory::getName() const { return name; }
+
+	void SharedMemory::release() {
+#ifndef _WIN32
+		if (mapping) {
+			munmap(mapping, mappingSize);
+			if (owner) {
+				shm_unlink(name.c_str());
+			}
+		}
+#endif
+		mapping = nullptr;
+		mappingSize = 0;
+		owner = false;
+	}
+
+} // namespace pxr
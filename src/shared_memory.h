@@ -0,0 +1,69 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace pxr {
+
+	/**
+	 * @brief A mapped POSIX shared-memory object.
+	 *
+	 * Wraps `shm_open()` and `mmap()`. An object created by this class is unlinked
+	 * again when the owner is destroyed; objects that were only opened are just
+	 * unmapped. Failures are reported through PXR_ASSERT. Not available on Windows.
+	 */
+	class SharedMemory {
+	public:
+		/**
+		 * @brief Creates a new zero-filled object, replacing any stale one with the same name.
+		 * @param name Object name; a leading slash is added if missing.
+		 * @param size Size in bytes.
+		 */
+		static SharedMemory create(const std::string &name, size_t size);
+
+		/**
+		 * @brief Maps an existing object in its entirety.
+		 * @param name Object name; a leading slash is added if missing.
+		 * @param writable True to map it read-write, false for read-only.
+		 */
+		static SharedMemory open(const std::string &name, bool writable);
+
+		SharedMemory() = default;
+		~SharedMemory();
+
+		SharedMemory(const SharedMemory &) = delete;
+		SharedMemory &operator=(const SharedMemory &) = delete;
+		SharedMemory(SharedMemory &&other) noexcept;
+		SharedMemory &operator=(SharedMemory &&other) noexcept;
+
+		/// @brief Returns the start of the mapping.
+		[[nodiscard]] void *data() const;
+
+		/// @brief Returns the mapping size in bytes.
+		[[nodiscard]] size_t size() const;
+
+		/// @brief Returns the normalized object name.
+		[[nodiscard]] const std::string &getName() const;
+
+	private:
+		/**
+		 * @brief Unmaps the object and unlinks it if this instance created it.
+		 */
+		void release();
+
+		std::string name; ///< Normalized object name.
+		void *mapping = nullptr; ///< Start of the mapping, or nullptr.
+		size_t mappingSize = 0; ///< Mapping size in bytes.
+		bool owner = false; ///< Whether the object is unlinked on destruction.
+	};
+
+} // namespace pxr
@@ -0,0 +1,70 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "software_presenter.h"
+
+#include "error_handling.h"
+#include "pixel_kernels.h"
+
+namespace pxr {
+
+	void SoftwarePresenter::setTarget(uint32_t *pixels, int stride, int width, int height, int pixelSize) {
+		PXR_ASSERT(pixels != nullptr && stride >= width, "Invalid presenter target buffer.");
+		PXR_ASSERT(pixelSize >= 1, "Pixel size must be at least 1.");
+		target = pixels;
+		targetStride = stride;
+		targetWidth = width;
+		targetHeight = height;
+		scale = pixelSize;
+		damage = Rect{};
+	}
+
+	void SoftwarePresenter::markTargetDirty() { damage = Rect{0, 0, targetWidth, targetHeight}; }
+
+	void SoftwarePresenter::upload(const Surface &surface, const Rect &rect) {
+		// Only the part of the frame that fits the buffer is copied; partial edge pixels are cropped.
+		const Rect visible{0, 0, (targetWidth + scale - 1) / scale, (targetHeight + scale - 1) / scale};
+		const Rect area = rect.intersected(Rect{0, 0, surface.getWidth(), surface.getHeight()}).intersected(visible);
+		if (area.isEmpty() || !target) {
+			return;
+		}
+
+		const Rect out = Rect{area.x * scale, area.y * scale, area.width * scale, area.height * scale}.intersected(
+				Rect{0, 0, targetWidth, targetHeight});
+		const uint32_t *pixels = surface.data();
+		const uint32_t *scaled = nullptr;
+		for (int y = out.y; y < out.bottom(); ++y) {
+			uint32_t *row = target + static_cast<size_t>(y) * targetStride + out.x;
+			if (scaled && y % scale != 0) {
+				// Further copies of the same source row are plain copies of the first one.
+				kernels::copyRow(row, scaled, out.width);
+				continue;
+			}
+			const uint32_t *src = pixels + static_cast<size_t>(y / scale) * surface.getWidth() + area.x;
+			if (out.right() == area.right() * scale) {
+				kernels::scaleRow(row, src, area.width, scale);
+			} else {
+				// The last source pixel is cut by the buffer edge: scale all but it, then fill the remainder.
+				kernels::scaleRow(row, src, area.width - 1, scale);
+				const int done = (area.width - 1) * scale;
+				kernels::fillRow(row + done, src[area.width - 1], out.width - done);
+			}
+			scaled = row;
+		}
+		damage = damage.united(out);
+	}
+
+	void SoftwarePresenter::present() {
+		if (!damage.isEmpty()) {
+			flush(damage);
+			damage = Rect{};
+		}
+	}
+
+} // namespace pxr
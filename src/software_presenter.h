@@ -0,0 +1,62 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include "presenter.h"
+
+namespace pxr {
+
+	/**
+	 * @brief Base for presenters that scale frames on the CPU into a 32-bit pixel buffer.
+	 *
+	 * Subclasses provide the buffer (a mapped framebuffer, a shared-memory image,
+	 * ...) through setTarget() and put the damaged region on screen in flush().
+	 * Uploaded regions are scaled by the pixel size with integer pixel replication
+	 * and clipped to the buffer.
+	 */
+	class SoftwarePresenter : public Presenter {
+	public:
+		void upload(const Surface &surface, const Rect &rect) override;
+
+		void present() override;
+
+	protected:
+		/**
+		 * @brief Sets the buffer receiving scaled pixels.
+		 * @param pixels First pixel of the buffer, 0xAARRGGBB (or 0xXXRRGGBB) per pixel.
+		 * @param stride Distance between rows, in pixels.
+		 * @param width Buffer width in pixels.
+		 * @param height Buffer height in pixels.
+		 * @param pixelSize Integer scale from surface pixels to buffer pixels.
+		 */
+		void setTarget(uint32_t *pixels, int stride, int width, int height, int pixelSize);
+
+		/**
+		 * @brief Marks the whole buffer as changed, so the next present() shows all of it.
+		 */
+		void markTargetDirty();
+
+		/**
+		 * @brief Shows a region of the buffer. Called by present() when something changed.
+		 * @param damage Changed region, in buffer pixels.
+		 */
+		virtual void flush(const Rect &damage) = 0;
+
+	private:
+		uint32_t *target = nullptr; ///< Buffer receiving scaled pixels.
+		int targetStride = 0; ///< Row distance in pixels.
+		int targetWidth = 0; ///< Buffer width in pixels.
+		int targetHeight = 0; ///< Buffer height in pixels.
+		int scale = 1; ///< Surface-to-buffer scale.
+		Rect damage; ///< Region written since the last present().
+	};
+
+} // namespace pxr
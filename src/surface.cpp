@@ -8,21 +8,28 @@
  */
 
 #include "pxr/surface.h"
-#include <algorithm>
+
+#include <cstring>
 #include "error_handling.h"
+#include "pixel_kernels.h"
 
 namespace pxr {
 
 	Surface::Surface(int width, int height, Color backgroundColor) :
-		width(width), height(height), pixels(width * height, backgroundColor.toUInt32()) {
+		width(width), height(height), pixels(width * height, backgroundColor.toUInt32()),
+		dirtyRect{0, 0, width, height} {
 		PXR_ASSERT(width > 0 && height > 0, "Surface dimensions must be positive.");
 	}
 
-	void Surface::clear(const Color &color) { std::ranges::fill(pixels, color.toUInt32()); }
+	void Surface::clear(const Color &color) {
+		kernels::fillRow(pixels.data(), color.toUInt32(), static_cast<int>(pixels.size()));
+		markDirty();
+	}
 
 	void Surface::setPixel(int x, int y, Color color) {
 		PXR_ASSERT(isInBounds(x, y), "setPixel() out of bounds.");
 		pixels[y * width + x] = color.toUInt32();
+		expandDirty(x, y);
 	}
 
 	void Surface::setPixel(int x, int y, uint8_t r, uint8_t g, uint8_t b) { setPixel(x, y, Color(r, g, b)); }
@@ -33,21 +40,47 @@ namespace pxr {
 	}
 
 	void Surface::blitTo(Surface &target, int dstX, int dstY) const {
-		for (int y = 0; y < height; ++y) {
-			for (int x = 0; x < width; ++x) {
-				int tx = dstX + x;
-				int ty = dstY + y;
-				if (target.isInBounds(tx, ty)) {
-					target.setPixel(tx, ty, getPixel(x, y));
-				}
+		const Rect area = Rect{dstX, dstY, width, height}.intersected(Rect{0, 0, target.width, target.height});
+		if (area.isEmpty()) {
+			return;
+		}
+
+		if (&target == this) {
+			// Source and destination overlap: walk rows against the shift and move each one.
+			uint32_t *const data = target.pixels.data();
+			const size_t rowBytes = static_cast<size_t>(area.width) * sizeof(uint32_t);
+			const bool bottomUp = dstY > 0;
+			for (int i = 0; i < area.height; ++i) {
+				const int y = bottomUp ? area.bottom() - 1 - i : area.y + i;
+				std::memmove(data + y * width + area.x, data + (y - dstY) * width + (area.x - dstX), rowBytes);
+			}
+		} else {
+			for (int y = area.y; y < area.bottom(); ++y) {
+				const uint32_t *src = pixels.data() + (y - dstY) * width + (area.x - dstX);
+				kernels::copyRow(target.pixels.data() + y * target.width + area.x, src, area.width);
 			}
 		}
+		target.markDirty(area);
 	}
 
+	bool Surface::isDirty() const { return !dirtyRect.isEmpty(); }
+
+	Rect Surface::getDirtyRect() const { return dirtyRect; }
+
+	void Surface::markDirty() { dirtyRect = Rect{0, 0, width, height}; }
+
+	void Surface::markDirty(const Rect &rect) {
+		dirtyRect = dirtyRect.united(rect.intersected(Rect{0, 0, width, height}));
+	}
+
+	void Surface::clearDirty() { dirtyRect = Rect{}; }
+
 	const std::vector<uint32_t> &Surface::getPixels() const { return pixels; }
 
 	const uint32_t *Surface::data() const { return pixels.data(); }
 
+	uint32_t *Surface::data() { return pixels.data(); }
+
 	int Surface::getWidth() const { return width; }
 
 	int Surface::getHeight() const { return height; }
@@ -55,9 +88,10 @@ namespace pxr {
 	Size Surface::getSize() const { return Size{width, height}; }
 
 	Surface::Surface(Surface &&other) noexcept :
-		width(other.width), height(other.height), pixels(std::move(other.pixels)) {
+		width(other.width), height(other.height), pixels(std::move(other.pixels)), dirtyRect(other.dirtyRect) {
 		other.width = 0;
 		other.height = 0;
+		other.dirtyRect = Rect{};
 	}
 
 	Surface &Surface::operator=(Surface &&other) noexcept {
@@ -65,12 +99,33 @@ namespace pxr {
 			width = other.width;
 			height = other.height;
 			pixels = std::move(other.pixels);
+			dirtyRect = other.dirtyRect;
 			other.width = 0;
 			other.height = 0;
+			other.dirtyRect = Rect{};
 		}
 		return *this;
 	}
 
 	bool Surface::isInBounds(int x, int y) const { return x >= 0 && y >= 0 && x < width && y < height; }
 
+	void Surface::expandDirty(int x, int y) {
+		if (dirtyRect.isEmpty()) {
+			dirtyRect = Rect{x, y, 1, 1};
+			return;
+		}
+		if (x < dirtyRect.x) {
+			dirtyRect.width += dirtyRect.x - x;
+			dirtyRect.x = x;
+		} else if (x >= dirtyRect.right()) {
+			dirtyRect.width = x - dirtyRect.x + 1;
+		}
+		if (y < dirtyRect.y) {
+			dirtyRect.height += dirtyRect.y - y;
+			dirtyRect.y = y;
+		} else if (y >= dirtyRect.bottom()) {
+			dirtyRect.height = y - dirtyRect.y + 1;
+		}
+	}
+
 } // namespace pxr
@@ -0,0 +1,93 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "pxr/task.h"
+
+#include <array>
+#include <new>
+#include "task_scheduler.h"
+
+namespace pxr::detail {
+
+	namespace {
+
+		constexpr std::size_t FrameGranularity = 64; ///< Frame sizes are rounded up to this.
+		constexpr std::size_t FrameClassCount = 32; ///< Pooled sizes: 64 bytes to 2 KiB.
+
+		/**
+		 * @brief Unused coroutine frame, linked into its size class.
+		 */
+		struct FreeFrame {
+			FreeFrame *next;
+		};
+
+		/**
+		 * @brief Per-thread free lists of coroutine frames, one per size class.
+		 *
+		 * Frames are not returned to the heap until the thread exits, so a task
+		 * started every frame reuses the same block. A frame freed on another
+		 * thread than the one that allocated it simply joins that thread's lists.
+		 */
+		struct FramePool {
+			std::array<FreeFrame *, FrameClassCount> lists{};
+
+			~FramePool();
+		};
+
+		thread_local FramePool framePool;
+		thread_local bool framePoolDestroyed = false; // Trivially destructible, so still readable at thread exit.
+
+		FramePool::~FramePool() {
+			for (FreeFrame *&list: lists) {
+				while (list) {
+					::operator delete(std::exchange(list, list->next));
+				}
+			}
+			framePoolDestroyed = true;
+		}
+
+		std::size_t frameClass(std::size_t size) { return (size + FrameGranularity - 1) / FrameGranularity - 1; }
+
+	} // namespace
+
+	void *allocateTaskFrame(std::size_t size) {
+		const std::size_t sizeClass = frameClass(size);
+		if (sizeClass >= FrameClassCount || framePoolDestroyed) {
+			return ::operator new(size);
+		}
+		FreeFrame *&list = framePool.lists[sizeClass];
+		if (list) {
+			return std::exchange(list, list->next);
+		}
+		return ::operator new((sizeClass + 1) * FrameGranularity);
+	}
+
+	void freeTaskFrame(void *frame, std::size_t size) noexcept {
+		const std::size_t sizeClass = frameClass(size);
+		if (sizeClass >= FrameClassCount || framePoolDestroyed) {
+			::operator delete(frame);
+			return;
+		}
+		FreeFrame *&list = framePool.lists[sizeClass];
+		list = new (frame) FreeFrame{list};
+	}
+
+	void scheduleNextFrame(TaskScheduler &scheduler, std::coroutine_handle<> handle) {
+		scheduler.scheduleNextFrame(handle);
+	}
+
+	void scheduleAfter(TaskScheduler &scheduler, float seconds, std::coroutine_handle<> handle) {
+		scheduler.scheduleAfter(seconds, handle);
+	}
+
+	void scheduleOnWorker(TaskScheduler &scheduler, std::function<void()> job, std::coroutine_handle<> handle) {
+		scheduler.scheduleOnWorker(std::move(job), handle);
+	}
+
+} // namespace pxr::detail
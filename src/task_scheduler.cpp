@@ -0,0 +1,169 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "task_scheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace pxr {
+
+	namespace {
+
+		/// How often an idle on-demand app checks for finished worker jobs.
+		constexpr double WorkerPollInterval = 1.0 / 60.0;
+
+	} // namespace
+
+	TaskScheduler::TaskScheduler(int workerCount) : workerCount(workerCount) {
+		if (this->workerCount <= 0) {
+			// Leave one hardware thread to the frame loop.
+			this->workerCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+		}
+	}
+
+	TaskScheduler::~TaskScheduler() {
+		{
+			std::lock_guard lock(mutex);
+			stopping = true;
+			jobs.clear();
+		}
+		wakeUp.notify_all();
+		for (auto &worker: workers) {
+			worker.join();
+		}
+		// Destroying a root also destroys the child tasks stored in its frame.
+		for (auto root: roots) {
+			root.destroy();
+		}
+	}
+
+	void TaskScheduler::start(Task task) {
+		auto handle = std::exchange(task.handle, {});
+		if (!handle) {
+			return;
+		}
+		handle.promise().scheduler = this;
+		roots.push_back(handle);
+		ready.push_back(handle);
+	}
+
+	void TaskScheduler::run(float deltaTime, float timeSlice) {
+		time += deltaTime;
+
+		// Order of resumption: leftovers of the last slice, next-frame waits, timers, finished jobs.
+		for (auto handle: waitingForFrame) {
+			ready.push_back(handle);
+		}
+		waitingForFrame.clear();
+		while (!timers.empty() && timers.top().due <= time) {
+			ready.push_back(timers.top().handle);
+			timers.pop();
+		}
+		{
+			std::lock_guard lock(mutex);
+			for (auto handle: completed) {
+				ready.push_back(handle);
+			}
+			completed.clear();
+		}
+
+		using Clock = std::chrono::steady_clock;
+		const auto deadline = Clock::now() + std::chrono::duration<float>(timeSlice);
+		while (!ready.empty()) {
+			const auto handle = ready.front();
+			ready.pop_front();
+			handle.resume();
+			if (timeSlice > 0.0f && Clock::now() >= deadline) {
+				break;
+			}
+		}
+
+		collectFinished();
+	}
+
+	size_t TaskScheduler::getTaskCount() const { return roots.size(); }
+
+	std::optional<double> TaskScheduler::getSecondsUntilResume() const {
+		if (!ready.empty() || !waitingForFrame.empty()) {
+			return 0.0;
+		}
+		std::optional<double> wait;
+		if (!timers.empty()) {
+			wait = std::max(timers.top().due - time, 0.0);
+		}
+		std::lock_guard lock(mutex);
+		if (!completed.empty()) {
+			return 0.0;
+		}
+		if (jobsInFlight > 0) {
+			// Workers cannot wake a sleeping window; poll for their results instead.
+			wait = std::min(wait.value_or(WorkerPollInterval), WorkerPollInterval);
+		}
+		return wait;
+	}
+
+	void TaskScheduler::scheduleNextFrame(std::coroutine_handle<> handle) { waitingForFrame.push_back(handle); }
+
+	void TaskScheduler::scheduleAfter(float seconds, std::coroutine_handle<> handle) {
+		timers.push(Timer{time + seconds, timerCount++, handle});
+	}
+
+	void TaskScheduler::scheduleOnWorker(std::function<void()> job, std::coroutine_handle<> handle) {
+		{
+			std::lock_guard lock(mutex);
+			if (workers.empty()) {
+				for (int i = 0; i < workerCount; ++i) {
+					workers.emplace_back(&TaskScheduler::workerLoop, this);
+				}
+			}
+			jobs.push_back(Job{std::move(job), handle});
+			++jobsInFlight;
+		}
+		wakeUp.notify_one();
+	}
+
+	void TaskScheduler::workerLoop() {
+		std::unique_lock lock(mutex);
+		for (;;) {
+			wakeUp.wait(lock, [this] { return stopping || !jobs.empty(); });
+			if (stopping) {
+				return;
+			}
+			Job job = std::move(jobs.front());
+			jobs.pop_front();
+
+			lock.unlock();
+			job.function(); // Never throws: runOnWorker() stores exceptions for the awaiting task.
+			lock.lock();
+
+			completed.push_back(job.handle);
+			--jobsInFlight;
+		}
+	}
+
+	void TaskScheduler::collectFinished() {
+		std::exception_ptr error;
+		std::erase_if(roots, [&](std::coroutine_handle<Task::promise_type> root) {
+			if (!root.done()) {
+				return false;
+			}
+			if (!error) {
+				error = root.promise().error;
+			}
+			root.destroy();
+			return true;
+		});
+		if (error) {
+			std::rethrow_exception(error);
+		}
+	}
+
+} // namespace pxr
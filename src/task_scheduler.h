@@ -0,0 +1,133 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <thread>
+#include <vector>
+#include "pxr/task.h"
+
+namespace pxr {
+
+	/**
+	 * @brief Resumes the app's coroutine tasks from the frame loop.
+	 *
+	 * All coroutines are resumed on the thread calling run(). Work passed to
+	 * runOnWorker() executes on a small set of worker threads, started on first
+	 * use; when it finishes, the waiting coroutine is queued for the next run().
+	 */
+	class TaskScheduler {
+	public:
+		/**
+		 * @param workerCount Threads for runOnWorker() jobs, or 0 for one per hardware thread but one.
+		 */
+		explicit TaskScheduler(int workerCount = 0);
+
+		/**
+		 * @brief Stops the workers and destroys every unfinished task.
+		 */
+		~TaskScheduler();
+
+		TaskScheduler(const TaskScheduler &) = delete;
+		TaskScheduler &operator=(const TaskScheduler &) = delete;
+
+		/**
+		 * @brief Takes ownership of a task and queues it to start in the current frame.
+		 */
+		void start(Task task);
+
+		/**
+		 * @brief Advances the clock and resumes the tasks that are due.
+		 *
+		 * Rethrows the first exception that escaped a started task.
+		 *
+		 * @param deltaTime Seconds since the previous call.
+		 * @param timeSlice Seconds after which no further task is resumed, or 0 for no limit.
+		 */
+		void run(float deltaTime, float timeSlice);
+
+		/**
+		 * @brief Returns the number of started tasks that did not finish yet.
+		 */
+		[[nodiscard]] size_t getTaskCount() const;
+
+		/**
+		 * @brief Returns how long the frame loop may sleep before a task needs resuming.
+		 * @return 0 if a task is ready, nothing if no task is waiting for anything.
+		 */
+		[[nodiscard]] std::optional<double> getSecondsUntilResume() const;
+
+		/// @copydoc detail::scheduleNextFrame
+		void scheduleNextFrame(std::coroutine_handle<> handle);
+
+		/// @copydoc detail::scheduleAfter
+		void scheduleAfter(float seconds, std::coroutine_handle<> handle);
+
+		/// @copydoc detail::scheduleOnWorker
+		void scheduleOnWorker(std::function<void()> job, std::coroutine_handle<> handle);
+
+	private:
+		/**
+		 * @brief A coroutine waiting for a point in time.
+		 */
+		struct Timer {
+			double due; ///< App time at which to resume.
+			uint64_t order; ///< Keeps timers with equal due times in FIFO order.
+			std::coroutine_handle<> handle; ///< Coroutine to resume.
+
+			bool operator>(const Timer &other) const {
+				return due != other.due ? due > other.due : order > other.order;
+			}
+		};
+
+		/**
+		 * @brief Work handed to a worker thread.
+		 */
+		struct Job {
+			std::function<void()> function; ///< Work to run.
+			std::coroutine_handle<> handle; ///< Coroutine to resume afterwards.
+		};
+
+		/**
+		 * @brief Runs jobs until the scheduler is destroyed.
+		 */
+		void workerLoop();
+
+		/**
+		 * @brief Destroys finished tasks and rethrows the first exception among them.
+		 */
+		void collectFinished();
+
+		std::vector<std::coroutine_handle<Task::promise_type>> roots; ///< Started tasks, owned.
+		std::deque<std::coroutine_handle<>> ready; ///< Coroutines to resume in the current frame.
+		std::vector<std::coroutine_handle<>> waitingForFrame; ///< Coroutines to resume in the next frame.
+		std::priority_queue<Timer, std::vector<Timer>, std::greater<>> timers; ///< Coroutines waiting for time.
+		double time = 0.0; ///< App time in seconds.
+		uint64_t timerCount = 0; ///< Timers created so far.
+		int workerCount; ///< Threads started by the first runOnWorker() job.
+
+		mutable std::mutex mutex; ///< Guards the members below.
+		std::condition_variable wakeUp; ///< Signals new jobs or shutdown.
+		std::deque<Job> jobs; ///< Jobs not yet picked up by a worker.
+		std::vector<std::coroutine_handle<>> completed; ///< Coroutines whose job finished.
+		size_t jobsInFlight = 0; ///< Jobs queued or running.
+		bool stopping = false; ///< Set when the workers should exit.
+		std::vector<std::thread> workers; ///< Started on the first job.
+	};
+
+} // namespace pxr
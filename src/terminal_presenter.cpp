@@ -0,0 +1,276 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "terminal_presenter.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "error_handling.h"
+
+namespace pxr {
+
+	namespace {
+
+		/// Marks a cell as never sent; real cells have zero high bytes in both halves.
+		constexpr uint64_t UnsentCell = ~uint64_t{0};
+
+		/// Sixel palette: a 6×6×6 color cube.
+		constexpr int SixelLevels = 6;
+		constexpr int SixelColors = SixelLevels * SixelLevels * SixelLevels;
+
+		void appendColor(std::string &out, const char *prefix, uint32_t rgb) {
+			char buffer[32];
+			const int length = std::snprintf(buffer, sizeof(buffer), "\x1b[%s;2;%u;%u;%um", prefix, (rgb >> 16) & 0xFF,
+											 (rgb >> 8) & 0xFF, rgb & 0xFF);
+			out.append(buffer, length);
+		}
+
+		int sixelIndex(uint32_t pixel) {
+			const auto level = [](uint32_t channel) { return static_cast<int>((channel * 5 + 127) / 255); };
+			return level((pixel >> 16) & 0xFF) * 36 + level((pixel >> 8) & 0xFF) * 6 + level(pixel & 0xFF);
+		}
+
+		void appendSixelRun(std::string &out, char sixel, int count) {
+			if (count > 3) {
+				out += '!';
+				out += std::to_string(count);
+				out += sixel;
+			} else {
+				out.append(count, sixel);
+			}
+		}
+
+	} // namespace
+
+	TerminalPresenter::TerminalPresenter() {
+		const char *mode = std::getenv("PXR_TERMINAL");
+		sixel = mode && std::strcmp(mode, "sixel") == 0;
+
+		const char *fps = std::getenv("PXR_TERMINAL_FPS");
+		const int rate = fps && std::atoi(fps) > 0 ? std::atoi(fps) : 30;
+		minInterval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::seconds(1)) / rate;
+	}
+
+	TerminalPresenter::~TerminalPresenter() {
+		if (!writer.joinable()) {
+			return;
+		}
+
+		// Wait for the writer, send whatever the rate cap held back, then restore the terminal.
+		std::unique_lock lock(mutex);
+		wake.wait(lock, [this] { return !writing; });
+		std::string out;
+		if (!pending.isEmpty()) {
+			if (sixel) {
+				encodeSixel(out);
+			} else {
+				encodeCells(out);
+			}
+		}
+		if (!sixel) {
+			// Leave the cursor below the picture; sixel output already ends there.
+			out += "\x1b[" + std::to_string((frameHeight + 1) / 2 + 1) + ";1H";
+		}
+		out += "\x1b[0m\x1b[?25h";
+		outbox = std::move(out);
+		writing = true;
+		stopping = true;
+		lock.unlock();
+		wake.notify_all();
+		writer.join();
+	}
+
+	void TerminalPresenter::initialize(Window &, const Surface &surface, int pixelSize) {
+		// Cells are far larger than pixels: half-block mode always draws one surface pixel per half cell.
+		const int scale = sixel ? pixelSize : 1;
+		frameWidth = surface.getWidth() * scale;
+		frameHeight = surface.getHeight() * scale;
+		frame.assign(static_cast<size_t>(frameWidth) * frameHeight, 0);
+		cells.assign(static_cast<size_t>(frameWidth) * ((frameHeight + 1) / 2), UnsentCell);
+		setTarget(frame.data(), frameWidth, frameWidth, frameHeight, scale);
+
+		// Hide the cursor and clear the screen.
+		outbox = "\x1b[?25l\x1b[2J";
+		writing = true;
+		lastEmit = std::chrono::steady_clock::now() - minInterval;
+		writer = std::thread(&TerminalPresenter::writerLoop, this);
+	}
+
+	void TerminalPresenter::present() {
+		SoftwarePresenter::present();
+		if (!pending.isEmpty()) {
+			emit();
+		}
+	}
+
+	std::optional<double> TerminalPresenter::getSecondsUntilFlush() const {
+		if (pending.isEmpty()) {
+			return std::nullopt;
+		}
+		auto wait = lastEmit + minInterval - std::chrono::steady_clock::now();
+		{
+			std::lock_guard lock(mutex);
+			if (writing) {
+				// The writer gives no wake-up when it finishes; look again after another interval.
+				wait = std::max(wait, minInterval);
+			}
+		}
+		return std::max(std::chrono::duration<double>(wait).count(), 0.0);
+	}
+
+	void TerminalPresenter::flush(const Rect &damage) { pending = pending.united(damage); }
+
+	void TerminalPresenter::emit() {
+		const auto now = std::chrono::steady_clock::now();
+		if (now - lastEmit < minInterval) {
+			return;
+		}
+		{
+			std::lock_guard lock(mutex);
+			if (writing) {
+				return;
+			}
+		}
+
+		// The writer is idle and only touches the outbox, so encoding can run unlocked.
+		std::string out;
+		if (sixel) {
+			encodeSixel(out);
+		} else {
+			encodeCells(out);
+		}
+		pending = Rect{};
+		lastEmit = now;
+		if (out.empty()) {
+			return;
+		}
+
+		{
+			std::lock_guard lock(mutex);
+			outbox = std::move(out);
+			writing = true;
+		}
+		wake.notify_all();
+	}
+
+	void TerminalPresenter::encodeCells(std::string &out) {
+		const int firstRow = pending.y / 2;
+		const int lastRow = (pending.bottom() + 1) / 2;
+		int cursorRow = -1;
+		int cursorColumn = -1;
+		uint32_t foreground = 0xFFFFFFFF;
+		uint32_t background = 0xFFFFFFFF;
+
+		for (int row = firstRow; row < lastRow; ++row) {
+			const uint32_t *top = frame.data() + static_cast<size_t>(row * 2) * frameWidth;
+			const uint32_t *bottom = row * 2 + 1 < frameHeight ? top + frameWidth : nullptr;
+			uint64_t *sent = cells.data() + static_cast<size_t>(row) * frameWidth;
+
+			for (int column = pending.x; column < pending.right(); ++column) {
+				const uint32_t upper = top[column] & 0xFFFFFF;
+				const uint32_t lower = bottom ? bottom[column] & 0xFFFFFF : 0;
+				const uint64_t cell = static_cast<uint64_t>(upper) << 32 | lower;
+				if (sent[column] == cell) {
+					continue;
+				}
+				sent[column] = cell;
+
+				if (row != cursorRow || column != cursorColumn) {
+					out += "\x1b[" + std::to_string(row + 1) + ';' + std::to_string(column + 1) + 'H';
+				}
+				if (upper != foreground) {
+					appendColor(out, "38", upper);
+					foreground = upper;
+				}
+				if (lower != background) {
+					appendColor(out, "48", lower);
+					background = lower;
+				}
+				out += "\xe2\x96\x80"; // U+2580 UPPER HALF BLOCK
+				cursorRow = row;
+				cursorColumn = column + 1;
+			}
+		}
+		if (!out.empty()) {
+			out += "\x1b[0m";
+		}
+	}
+
+	void TerminalPresenter::encodeSixel(std::string &out) const {
+		out += "\x1b[H\x1bPq\"1;1;" + std::to_string(frameWidth) + ';' + std::to_string(frameHeight);
+		for (int i = 0; i < SixelColors; ++i) {
+			const auto percent = [](int level) { return std::to_string(level * 100 / (SixelLevels - 1)); };
+			out += '#' + std::to_string(i) + ";2;" + percent(i / 36) + ';' + percent(i / 6 % 6) + ';' +
+				   percent(i % 6);
+		}
+
+		std::vector<uint8_t> indices(static_cast<size_t>(frameWidth) * 6);
+		for (int bandTop = 0; bandTop < frameHeight; bandTop += 6) {
+			const int bandRows = std::min(6, frameHeight - bandTop);
+			std::bitset<SixelColors> used;
+			for (int k = 0; k < bandRows; ++k) {
+				const uint32_t *row = frame.data() + static_cast<size_t>(bandTop + k) * frameWidth;
+				for (int x = 0; x < frameWidth; ++x) {
+					const int index = sixelIndex(row[x]);
+					indices[static_cast<size_t>(k) * frameWidth + x] = static_cast<uint8_t>(index);
+					used.set(index);
+				}
+			}
+
+			// One pass per color in the band; '$' returns to the band start, '-' moves to the next band.
+			for (int color = 0; color < SixelColors; ++color) {
+				if (!used.test(color)) {
+					continue;
+				}
+				out += '#' + std::to_string(color);
+				char run = 0;
+				int runLength = 0;
+				for (int x = 0; x < frameWidth; ++x) {
+					int bits = 0;
+					for (int k = 0; k < bandRows; ++k) {
+						bits |= (indices[static_cast<size_t>(k) * frameWidth + x] == color) << k;
+					}
+					const char sixelChar = static_cast<char>(63 + bits);
+					if (sixelChar != run && runLength > 0) {
+						appendSixelRun(out, run, runLength);
+						runLength = 0;
+					}
+					run = sixelChar;
+					++runLength;
+				}
+				appendSixelRun(out, run, runLength);
+				out += '$';
+			}
+			out += '-';
+		}
+		out += "\x1b\\";
+	}
+
+	void TerminalPresenter::writerLoop() {
+		std::unique_lock lock(mutex);
+		while (true) {
+			wake.wait(lock, [this] { return !outbox.empty() || stopping; });
+			if (outbox.empty()) {
+				break;
+			}
+			const std::string data = std::move(outbox);
+			outbox.clear();
+			lock.unlock();
+			std::fwrite(data.data(), 1, data.size(), stdout);
+			std::fflush(stdout);
+			lock.lock();
+			writing = false;
+			wake.notify_all();
+		}
+	}
+
+} // namespace pxr
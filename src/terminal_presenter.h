@@ -0,0 +1,97 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "software_presenter.h"
+
+namespace pxr {
+
+	/**
+	 * @brief Draws frames on the terminal attached to standard output.
+	 *
+	 * The default mode prints two pixels per character cell with the upper half
+	 * block and 24-bit ANSI colors, and only emits changed cells. Setting
+	 * `PXR_TERMINAL=sixel` sends sixel graphics at the app's pixel size instead,
+	 * redrawing the frame whenever it changes. Output is capped at
+	 * `PXR_TERMINAL_FPS` updates per second (default 30) and written by a
+	 * background thread; while a write is still in flight, changes accumulate
+	 * and go out with the next update, so a slow link drops frames instead of
+	 * stalling the app. Held-back changes are reported through
+	 * getSecondsUntilFlush(), so an app rendering on demand presents them once
+	 * the cap allows.
+	 */
+	class TerminalPresenter final : public SoftwarePresenter {
+	public:
+		TerminalPresenter();
+
+		/**
+		 * @brief Finishes pending output and restores the terminal.
+		 */
+		~TerminalPresenter() override;
+
+		TerminalPresenter(const TerminalPresenter &) = delete;
+		TerminalPresenter &operator=(const TerminalPresenter &) = delete;
+
+		void initialize(Window &window, const Surface &surface, int pixelSize) override;
+
+		void present() override;
+
+		[[nodiscard]] std::optional<double> getSecondsUntilFlush() const override;
+
+	protected:
+		void flush(const Rect &damage) override;
+
+	private:
+		/**
+		 * @brief Encodes pending changes and hands them to the writer if it is idle and the rate cap allows.
+		 */
+		void emit();
+
+		/**
+		 * @brief Appends escape sequences for the changed cells inside the pending region.
+		 */
+		void encodeCells(std::string &out);
+
+		/**
+		 * @brief Appends the whole frame as a sixel image.
+		 */
+		void encodeSixel(std::string &out) const;
+
+		/**
+		 * @brief Writer thread body: writes each handed-over buffer to standard output.
+		 */
+		void writerLoop();
+
+		bool sixel = false; ///< Sixel output instead of half-block cells.
+		std::vector<uint32_t> frame; ///< Latest frame at output resolution.
+		int frameWidth = 0; ///< Frame width in pixels.
+		int frameHeight = 0; ///< Frame height in pixels.
+		std::vector<uint64_t> cells; ///< Colors last sent per cell (top pixel high, bottom pixel low).
+		Rect pending; ///< Changed region not yet sent.
+		std::chrono::steady_clock::duration minInterval{}; ///< Rate cap.
+		std::chrono::steady_clock::time_point lastEmit; ///< Time of the last handed-over update.
+
+		std::thread writer; ///< Background writer.
+		mutable std::mutex mutex; ///< Guards the fields below.
+		std::condition_variable wake; ///< Signals new output or shutdown.
+		std::string outbox; ///< Output handed to the writer; empty when the writer is idle.
+		bool writing = false; ///< Whether the writer is busy with a buffer.
+		bool stopping = false; ///< Set to end the writer thread.
+	};
+
+} // namespace pxr
@@ -0,0 +1,151 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <utility>
+#include "error_handling.h"
+
+namespace pxr {
+
+	ThreadPool::ThreadPool(int threadCount) {
+		if (threadCount <= 0) {
+			threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+		}
+		for (int i = 0; i < threadCount; ++i) {
+			queues.push_back(std::make_unique<Queue>());
+		}
+		for (int i = 1; i < threadCount; ++i) {
+			threads.emplace_back(&ThreadPool::workerLoop, this, i);
+		}
+	}
+
+	ThreadPool::~ThreadPool() {
+		{
+			std::lock_guard lock(mutex);
+			stopping = true;
+		}
+		wakeUp.notify_all();
+		for (auto &thread: threads) {
+			thread.join();
+		}
+	}
+
+	int ThreadPool::getThreadCount() const { return static_cast<int>(queues.size()); }
+
+	void ThreadPool::parallelFor(int count, const std::function<void(int)> &function) {
+		if (count <= 0) {
+			return;
+		}
+		if (threads.empty() || count == 1) {
+			std::exception_ptr firstError;
+			for (int i = 0; i < count; ++i) {
+				try {
+					function(i);
+				} catch (...) {
+					if (!firstError) {
+						firstError = std::current_exception();
+					}
+				}
+			}
+			if (firstError) {
+				std::rethrow_exception(firstError);
+			}
+			return;
+		}
+
+		{
+			std::lock_guard lock(mutex);
+			PXR_ASSERT(task == nullptr, "ThreadPool::parallelFor() cannot be nested.");
+			task = &function;
+			remaining.store(count, std::memory_order_relaxed);
+
+			// Contiguous blocks keep neighbouring indices on one thread until stealing kicks in.
+			const int threadCount = getThreadCount();
+			for (int t = 0; t < threadCount; ++t) {
+				std::lock_guard queueLock(queues[t]->mutex);
+				const int begin = static_cast<int>(static_cast<int64_t>(count) * t / threadCount);
+				const int end = static_cast<int>(static_cast<int64_t>(count) * (t + 1) / threadCount);
+				for (int i = begin; i < end; ++i) {
+					queues[t]->indices.push_back(i);
+				}
+			}
+			++generation;
+		}
+		wakeUp.notify_all();
+
+		runPending(0);
+
+		std::unique_lock lock(mutex);
+		finished.wait(lock, [this] { return remaining.load(std::memory_order_acquire) == 0; });
+		task = nullptr;
+		if (error) {
+			std::rethrow_exception(std::exchange(error, nullptr));
+		}
+	}
+
+	void ThreadPool::workerLoop(int worker) {
+		uint64_t seen = 0;
+		for (;;) {
+			{
+				std::unique_lock lock(mutex);
+				wakeUp.wait(lock, [&] { return stopping || generation != seen; });
+				if (stopping) {
+					return;
+				}
+				seen = generation;
+			}
+			runPending(worker);
+		}
+	}
+
+	void ThreadPool::runPending(int worker) {
+		int index = 0;
+		while (takeIndex(worker, index)) {
+			try {
+				(*task)(index);
+			} catch (...) {
+				std::lock_guard lock(mutex);
+				if (!error) {
+					error = std::current_exception();
+				}
+			}
+			if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				std::lock_guard lock(mutex);
+				finished.notify_all();
+			}
+		}
+	}
+
+	bool ThreadPool::takeIndex(int worker, int &index) {
+		{
+			Queue &own = *queues[worker];
+			std::lock_guard lock(own.mutex);
+			if (!own.indices.empty()) {
+				index = own.indices.front();
+				own.indices.pop_front();
+				return true;
+			}
+		}
+
+		const int threadCount = getThreadCount();
+		for (int offset = 1; offset < threadCount; ++offset) {
+			Queue &victim = *queues[(worker + offset) % threadCount];
+			std::lock_guard lock(victim.mutex);
+			if (!victim.indices.empty()) {
+				index = victim.indices.back();
+				victim.indices.pop_back();
+				return true;
+			}
+		}
+		return false;
+	}
+
+} // namespace pxr
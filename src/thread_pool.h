@@ -0,0 +1,105 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace pxr {
+
+	/**
+	 * @brief Fixed set of worker threads running index ranges with work stealing.
+	 *
+	 * parallelFor() splits the indices into one contiguous block per thread. Each
+	 * thread works through its own block front to back; a thread that runs out
+	 * steals indices from the back of another block, so uneven task lengths
+	 * still keep every thread busy. The calling thread takes part in the work.
+	 */
+	class ThreadPool {
+	public:
+		/**
+		 * @brief Starts the workers.
+		 * @param threadCount Total number of threads including the caller, or 0 for one per hardware thread.
+		 */
+		explicit ThreadPool(int threadCount = 0);
+
+		/**
+		 * @brief Stops and joins the workers.
+		 */
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool &) = delete;
+		ThreadPool &operator=(const ThreadPool &) = delete;
+
+		/**
+		 * @brief Returns the number of threads running tasks, including the caller.
+		 */
+		[[nodiscard]] int getThreadCount() const;
+
+		/**
+		 * @brief Runs a task for every index in [0, count) and waits for all of them.
+		 *
+		 * If tasks throw, the remaining indices still run and the first exception
+		 * is rethrown on the calling thread. Must not be called from inside a task.
+		 *
+		 * @param count Number of indices.
+		 * @param task Function called once per index, on any thread.
+		 */
+		void parallelFor(int count, const std::function<void(int)> &task);
+
+	private:
+		/**
+		 * @brief Indices assigned to one thread.
+		 */
+		struct Queue {
+			std::mutex mutex; ///< Guards the indices.
+			std::deque<int> indices; ///< Owner takes from the front, thieves from the back.
+		};
+
+		/**
+		 * @brief Waits for work and runs it until the pool stops.
+		 * @param worker Index of the worker's queue.
+		 */
+		void workerLoop(int worker);
+
+		/**
+		 * @brief Runs tasks from a queue, then from other queues, until none are left.
+		 * @param worker Index of the calling thread's queue.
+		 */
+		void runPending(int worker);
+
+		/**
+		 * @brief Takes the next index from the thread's own queue or steals one.
+		 * @return False if every queue is empty.
+		 */
+		bool takeIndex(int worker, int &index);
+
+		std::vector<std::unique_ptr<Queue>> queues; ///< One queue per thread; queue 0 belongs to the caller.
+		std::vector<std::thread> threads; ///< Worker threads (queues 1 and up).
+
+		std::mutex mutex; ///< Guards the members below.
+		std::condition_variable wakeUp; ///< Signals new work or shutdown.
+		std::condition_variable finished; ///< Signals that the last task completed.
+		const std::function<void(int)> *task = nullptr; ///< Task of the current parallelFor().
+		std::exception_ptr error; ///< First exception thrown by a task of the current parallelFor().
+		uint64_t generation = 0; ///< Incremented by every parallelFor().
+		bool stopping = false; ///< Set when the workers should exit.
+		std::atomic<int> remaining = 0; ///< Tasks of the current parallelFor() not yet completed.
+	};
+
+} // namespace pxr
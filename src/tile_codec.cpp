@@ -0,0 +1,152 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "tile_codec.h"
+
+#include <array>
+
+namespace pxr {
+
+	namespace {
+
+		// Operation tags, as in QOI.
+		constexpr uint8_t OpIndex = 0x00;
+		constexpr uint8_t OpDiff = 0x40;
+		constexpr uint8_t OpLuma = 0x80;
+		constexpr uint8_t OpRun = 0xC0;
+		constexpr uint8_t OpRgb = 0xFE;
+		constexpr uint8_t OpRgba = 0xFF;
+		constexpr uint8_t TagMask = 0xC0;
+		constexpr int MaxRun = 62;
+
+		constexpr uint32_t StartPixel = 0xFF000000;
+
+		inline int hashPixel(uint32_t p) {
+			const uint32_t a = p >> 24, r = (p >> 16) & 0xFF, g = (p >> 8) & 0xFF, b = p & 0xFF;
+			return static_cast<int>((r * 3 + g * 5 + b * 7 + a * 11) % 64);
+		}
+
+	} // namespace
+
+	void encodeTile(std::vector<uint8_t> &out, const uint32_t *pixels, int stride, int width, int height) {
+		std::array<uint32_t, 64> seen{};
+		uint32_t previous = StartPixel;
+		int run = 0;
+
+		for (int y = 0; y < height; ++y) {
+			const uint32_t *row = pixels + static_cast<size_t>(y) * stride;
+			for (int x = 0; x < width; ++x) {
+				const uint32_t p = row[x];
+				if (p == previous) {
+					if (++run == MaxRun) {
+						out.push_back(static_cast<uint8_t>(OpRun | (run - 1)));
+						run = 0;
+					}
+					continue;
+				}
+				if (run > 0) {
+					out.push_back(static_cast<uint8_t>(OpRun | (run - 1)));
+					run = 0;
+				}
+
+				const int index = hashPixel(p);
+				if (seen[index] == p) {
+					out.push_back(static_cast<uint8_t>(OpIndex | index));
+				} else {
+					seen[index] = p;
+					if ((p >> 24) == (previous >> 24)) {
+						const auto dr = static_cast<int8_t>(((p >> 16) & 0xFF) - ((previous >> 16) & 0xFF));
+						const auto dg = static_cast<int8_t>(((p >> 8) & 0xFF) - ((previous >> 8) & 0xFF));
+						const auto db = static_cast<int8_t>((p & 0xFF) - (previous & 0xFF));
+						const int drg = dr - dg;
+						const int dbg = db - dg;
+						if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+							out.push_back(static_cast<uint8_t>(OpDiff | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2)));
+						} else if (dg >= -32 && dg <= 31 && drg >= -8 && drg <= 7 && dbg >= -8 && dbg <= 7) {
+							out.push_back(static_cast<uint8_t>(OpLuma | (dg + 32)));
+							out.push_back(static_cast<uint8_t>((drg + 8) << 4 | (dbg + 8)));
+						} else {
+							out.push_back(OpRgb);
+							out.push_back(static_cast<uint8_t>(p >> 16));
+							out.push_back(static_cast<uint8_t>(p >> 8));
+							out.push_back(static_cast<uint8_t>(p));
+						}
+					} else {
+						out.push_back(OpRgba);
+						out.push_back(static_cast<uint8_t>(p >> 16));
+						out.push_back(static_cast<uint8_t>(p >> 8));
+						out.push_back(static_cast<uint8_t>(p));
+						out.push_back(static_cast<uint8_t>(p >> 24));
+					}
+				}
+				previous = p;
+			}
+		}
+		if (run > 0) {
+			out.push_back(static_cast<uint8_t>(OpRun | (run - 1)));
+		}
+	}
+
+	bool decodeTile(const uint8_t *data, size_t size, uint32_t *pixels, int stride, int width, int height) {
+		std::array<uint32_t, 64> seen{};
+		uint32_t p = StartPixel;
+		int run = 0;
+		size_t pos = 0;
+
+		for (int y = 0; y < height; ++y) {
+			uint32_t *row = pixels + static_cast<size_t>(y) * stride;
+			for (int x = 0; x < width; ++x) {
+				if (run > 0) {
+					--run;
+					row[x] = p;
+					continue;
+				}
+				if (pos >= size) {
+					return false;
+				}
+
+				const uint8_t op = data[pos++];
+				if (op == OpRgb || op == OpRgba) {
+					const size_t count = op == OpRgb ? 3 : 4;
+					if (pos + count > size) {
+						return false;
+					}
+					const uint32_t alpha = op == OpRgb ? (p & 0xFF000000) : static_cast<uint32_t>(data[pos + 3]) << 24;
+					p = alpha | static_cast<uint32_t>(data[pos]) << 16 | static_cast<uint32_t>(data[pos + 1]) << 8 |
+						data[pos + 2];
+					pos += count;
+				} else if ((op & TagMask) == OpIndex) {
+					p = seen[op];
+				} else if ((op & TagMask) == OpDiff) {
+					const uint32_t r = ((p >> 16) + ((op >> 4) & 3) - 2) & 0xFF;
+					const uint32_t g = ((p >> 8) + ((op >> 2) & 3) - 2) & 0xFF;
+					const uint32_t b = (p + (op & 3) - 2) & 0xFF;
+					p = (p & 0xFF000000) | r << 16 | g << 8 | b;
+				} else if ((op & TagMask) == OpLuma) {
+					if (pos >= size) {
+						return false;
+					}
+					const uint8_t next = data[pos++];
+					const int dg = (op & 0x3F) - 32;
+					const uint32_t r = ((p >> 16) + dg - 8 + ((next >> 4) & 0x0F)) & 0xFF;
+					const uint32_t g = ((p >> 8) + dg) & 0xFF;
+					const uint32_t b = (p + dg - 8 + (next & 0x0F)) & 0xFF;
+					p = (p & 0xFF000000) | r << 16 | g << 8 | b;
+				} else {
+					run = op & 0x3F;
+				}
+
+				seen[hashPixel(p)] = p;
+				row[x] = p;
+			}
+		}
+		return pos == size;
+	}
+
+} // namespace pxr
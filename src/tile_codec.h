@@ -0,0 +1,86 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file tile_codec.h
+ * @brief Wire format and pixel codec of frame streams.
+ *
+ * A stream starts with a Hello message carrying the frame size. Each Frame
+ * message is followed by `tileCount` tiles, each a FrameStreamTile header and
+ * `encodedBytes` of pixels compressed with a QOI-style codec (index, diff,
+ * luma and run operations; state resets at every tile). All fields are
+ * little-endian; both ends run on the same machine.
+ */
+
+namespace pxr {
+
+	/// Edge length of a stream tile in pixels.
+	constexpr int StreamTileSize = 16;
+
+	/**
+	 * @brief Header of every frame stream message.
+	 */
+	struct FrameStreamMessage {
+		static constexpr uint32_t Magic = 0x50585253; ///< "PXRS"
+		static constexpr uint16_t Version = 1; ///< Protocol version.
+		static constexpr uint16_t Hello = 1; ///< Sent once on connection; announces the frame size.
+		static constexpr uint16_t Frame = 2; ///< Changed tiles of one frame.
+
+		uint32_t magic; ///< Always Magic.
+		uint16_t version; ///< Protocol version.
+		uint16_t type; ///< Hello or Frame.
+		uint32_t width; ///< Frame width in pixels.
+		uint32_t height; ///< Frame height in pixels.
+		uint64_t frameNumber; ///< Producer frame number (Frame only).
+		uint32_t tileCount; ///< Number of tiles that follow (Frame only).
+		uint32_t payloadBytes; ///< Total size of the tiles that follow.
+	};
+
+	/**
+	 * @brief Header of one tile inside a Frame message.
+	 */
+	struct FrameStreamTile {
+		uint16_t x; ///< Left edge in pixels.
+		uint16_t y; ///< Top edge in pixels.
+		uint16_t width; ///< Width in pixels (smaller than StreamTileSize at the right edge).
+		uint16_t height; ///< Height in pixels (smaller than StreamTileSize at the bottom edge).
+		uint32_t encodedBytes; ///< Size of the compressed pixels that follow.
+	};
+
+	static_assert(sizeof(FrameStreamMessage) == 32 && sizeof(FrameStreamTile) == 12, "Stream layout must stay fixed.");
+
+	/**
+	 * @brief Compresses a block of pixels and appends the result.
+	 * @param out Buffer receiving the encoded bytes.
+	 * @param pixels First pixel of the block.
+	 * @param stride Distance between rows, in pixels.
+	 * @param width Block width in pixels.
+	 * @param height Block height in pixels.
+	 */
+	void encodeTile(std::vector<uint8_t> &out, const uint32_t *pixels, int stride, int width, int height);
+
+	/**
+	 * @brief Decompresses a block of pixels.
+	 * @param data Encoded bytes.
+	 * @param size Number of encoded bytes.
+	 * @param pixels First pixel of the destination block.
+	 * @param stride Distance between destination rows, in pixels.
+	 * @param width Block width in pixels.
+	 * @param height Block height in pixels.
+	 * @return False if the data is malformed.
+	 */
+	bool decodeTile(const uint8_t *data, size_t size, uint32_t *pixels, int stride, int width, int height);
+
+} // namespace pxr
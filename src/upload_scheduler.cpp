@@ -0,0 +1,98 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "upload_scheduler.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace pxr {
+
+	namespace {
+
+		constexpr size_t BytesPerPixel = 4;
+
+	} // namespace
+
+	void UploadScheduler::setBudget(size_t bytes) { budget = bytes; }
+
+	size_t UploadScheduler::getBudget() const { return budget; }
+
+	void UploadScheduler::enqueue(const Surface &surface, const Rect &rect, UploadPriority priority) {
+		const Rect area = rect.intersected(Rect{0, 0, surface.getWidth(), surface.getHeight()});
+		if (area.isEmpty()) {
+			return;
+		}
+
+		for (auto &request: pending) {
+			if (request.surface == &surface && request.priority == priority) {
+				request.rect = request.rect.united(area);
+				return;
+			}
+		}
+		pending.push_back(Request{&surface, area, priority, nextSequence++});
+	}
+
+	void UploadScheduler::cancel(const Surface &surface) {
+		std::erase_if(pending, [&](const Request &request) { return request.surface == &surface; });
+	}
+
+	void UploadScheduler::clear() { pending.clear(); }
+
+	void UploadScheduler::process(const UploadFunction &upload) {
+		bytesLastFrame = 0;
+		if (pending.empty()) {
+			return;
+		}
+
+		std::ranges::sort(pending, [](const Request &a, const Request &b) {
+			return a.priority != b.priority ? a.priority < b.priority : a.sequence < b.sequence;
+		});
+
+		size_t remaining = budget ? budget : std::numeric_limits<size_t>::max();
+		size_t served = 0;
+		for (; served < pending.size(); ++served) {
+			Request &request = pending[served];
+			const size_t rowBytes = static_cast<size_t>(request.rect.width) * BytesPerPixel;
+
+			int rows = static_cast<int>(std::min<size_t>(request.rect.height, remaining / rowBytes));
+			if (rows == 0) {
+				if (bytesLastFrame > 0) {
+					break;
+				}
+				rows = 1; // Guarantee progress when a single row exceeds the budget.
+			}
+
+			upload(*request.surface, Rect{request.rect.x, request.rect.y, request.rect.width, rows});
+			const size_t bytes = rowBytes * rows;
+			bytesLastFrame += bytes;
+			remaining -= std::min(remaining, bytes);
+
+			if (rows < request.rect.height) {
+				request.rect.y += rows;
+				request.rect.height -= rows;
+				break;
+			}
+		}
+		pending.erase(pending.begin(), pending.begin() + static_cast<std::ptrdiff_t>(served));
+	}
+
+	bool UploadScheduler::isIdle() const { return pending.empty(); }
+
+	size_t UploadScheduler::getPendingBytes() const {
+		size_t total = 0;
+		for (const auto &request: pending) {
+			total += static_cast<size_t>(request.rect.area()) * BytesPerPixel;
+		}
+		return total;
+	}
+
+	size_t UploadScheduler::getBytesLastFrame() const { return bytesLastFrame; }
+
+} // namespace pxr
@@ -0,0 +1,115 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "pxr/surface.h"
+#include "pxr/types.h"
+
+namespace pxr {
+
+	/**
+	 * @brief Order in which pending uploads are served. Lower values go first.
+	 */
+	enum class UploadPriority : uint8_t {
+		Visible, ///< Content currently on screen.
+		Offscreen, ///< Content of a visible surface that lies outside the viewport.
+		Hidden, ///< Content of a surface that is not displayed at all.
+	};
+
+	/**
+	 * @brief Spreads texture uploads across frames under a per-frame byte budget.
+	 *
+	 * Callers enqueue rectangles of surfaces; each frame, process() hands out row
+	 * bands of the pending rectangles, highest priority first, until the budget is
+	 * spent. Rectangles enqueued again for the same surface and priority are merged,
+	 * and the pixels are read at upload time, so the latest content is always sent.
+	 */
+	class UploadScheduler {
+	public:
+		/// Callback performing the actual transfer of one rectangle.
+		using UploadFunction = std::function<void(const Surface &surface, const Rect &rect)>;
+
+		/**
+		 * @brief Sets the number of bytes that may be uploaded per frame.
+		 * @param bytes Byte budget per frame, or 0 for no limit.
+		 */
+		void setBudget(size_t bytes);
+
+		/**
+		 * @brief Returns the per-frame byte budget (0 means unlimited).
+		 */
+		[[nodiscard]] size_t getBudget() const;
+
+		/**
+		 * @brief Queues a rectangle of a surface for upload.
+		 * @param surface The source surface. Must outlive the request or be cancelled.
+		 * @param rect The region to upload, clipped to the surface bounds.
+		 * @param priority How urgently the region is needed.
+		 */
+		void enqueue(const Surface &surface, const Rect &rect, UploadPriority priority);
+
+		/**
+		 * @brief Drops all pending requests for a surface.
+		 * @param surface The surface being destroyed or replaced.
+		 */
+		void cancel(const Surface &surface);
+
+		/**
+		 * @brief Drops all pending requests.
+		 */
+		void clear();
+
+		/**
+		 * @brief Uploads pending regions until the frame budget is exhausted.
+		 *
+		 * At least one row is uploaded per frame even if a single row exceeds the
+		 * budget, so the queue always makes progress.
+		 *
+		 * @param upload Function performing each transfer.
+		 */
+		void process(const UploadFunction &upload);
+
+		/**
+		 * @brief Returns true if no uploads are pending.
+		 */
+		[[nodiscard]] bool isIdle() const;
+
+		/**
+		 * @brief Returns the number of bytes still waiting to be uploaded.
+		 */
+		[[nodiscard]] size_t getPendingBytes() const;
+
+		/**
+		 * @brief Returns the number of bytes uploaded by the last call to process().
+		 */
+		[[nodiscard]] size_t getBytesLastFrame() const;
+
+	private:
+		/**
+		 * @brief A pending upload request.
+		 */
+		struct Request {
+			const Surface *surface = nullptr; ///< Source surface.
+			Rect rect; ///< Remaining region to upload.
+			UploadPriority priority = UploadPriority::Visible; ///< Serving order.
+			uint64_t sequence = 0; ///< Enqueue order, used to keep FIFO within a priority.
+		};
+
+		std::vector<Request> pending; ///< Requests waiting to be served.
+		size_t budget = 0; ///< Bytes per frame, 0 = unlimited.
+		size_t bytesLastFrame = 0; ///< Bytes uploaded by the last process() call.
+		uint64_t nextSequence = 0; ///< Sequence number for the next new request.
+	};
+
+} // namespace pxr
@@ -0,0 +1,352 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "pxr/video_player.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include "error_handling.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace pxr {
+
+	namespace {
+
+		/// Files this large are mapped; below it, reading into one staging buffer is as fast and maps nothing.
+		constexpr size_t MapThreshold = size_t{32} << 20;
+
+		/// Longest header or frame line accepted; real ones are a few dozen bytes.
+		constexpr size_t MaxLineLength = 4096;
+
+		/// Parses a positive integer taking the whole text.
+		bool parsePositive(const std::string &text, long &value) {
+			char *end = nullptr;
+			value = std::strtol(text.c_str(), &end, 10);
+			return !text.empty() && *end == '\0' && value > 0;
+		}
+
+	} // namespace
+
+	//--------------------------------------------------------------------------
+	// Lifecycle
+	//--------------------------------------------------------------------------
+
+	VideoPlayer::VideoPlayer(const std::string &path, int ringSize) {
+		PXR_ASSERT(ringSize >= 2, "A video player needs a ring of at least 2 frames.");
+		openFile(path);
+		readHeader();
+		ring.resize(ringSize);
+		for (Slot &slot : ring) {
+			slot.frame.resize(frameBytes);
+		}
+		reader = std::thread(&VideoPlayer::readLoop, this);
+	}
+
+	VideoPlayer::~VideoPlayer() {
+		{
+			std::lock_guard lock(mutex);
+			stopping = true;
+		}
+		slotFreed.notify_all();
+		if (reader.joinable()) {
+			reader.join();
+		}
+#ifndef _WIN32
+		if (mapping) {
+			munmap(const_cast<uint8_t *>(mapping), fileSize);
+		}
+#endif
+	}
+
+	//--------------------------------------------------------------------------
+	// File access
+	//--------------------------------------------------------------------------
+
+	void VideoPlayer::openFile(const std::string &path) {
+		std::error_code error;
+		fileSize = static_cast<size_t>(std::filesystem::file_size(path, error));
+		PXR_ASSERT(!error, "Cannot open the video file.");
+#ifndef _WIN32
+		if (fileSize >= MapThreshold) {
+			const int fd = ::open(path.c_str(), O_RDONLY);
+			PXR_ASSERT(fd >= 0, "Cannot open the video file.");
+			void *view = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+			close(fd);
+			if (view != MAP_FAILED) {
+				// Frames are read once, front to back: read ahead harder and drop pages soon after use.
+				madvise(view, fileSize, MADV_SEQUENTIAL);
+				mapping = static_cast<const uint8_t *>(view);
+				return;
+			}
+		}
+#endif
+		file.open(path, std::ios::binary);
+		PXR_ASSERT(file.is_open(), "Cannot open the video file.");
+	}
+
+	bool VideoPlayer::readLine(size_t &offset, std::string &line) {
+		if (offset >= fileSize) {
+			return false;
+		}
+		const size_t limit = std::min(fileSize - offset, MaxLineLength);
+		if (mapping) {
+			const void *newline = std::memchr(mapping + offset, '\n', limit);
+			if (!newline) {
+				return false;
+			}
+			const auto *end = static_cast<const uint8_t *>(newline);
+			line.assign(mapping + offset, end);
+			offset = static_cast<size_t>(end - mapping) + 1;
+			return true;
+		}
+		file.clear();
+		file.seekg(static_cast<std::streamoff>(offset));
+		if (!std::getline(file, line) || line.size() >= limit) {
+			return false;
+		}
+		offset += line.size() + 1;
+		return true;
+	}
+
+	const uint8_t *VideoPlayer::readBytes(size_t offset, size_t count) {
+		if (offset > fileSize || count > fileSize - offset) {
+			return nullptr;
+		}
+		if (mapping) {
+			return mapping + offset;
+		}
+		staging.resize(count);
+		file.clear();
+		file.seekg(static_cast<std::streamoff>(offset));
+		file.read(reinterpret_cast<char *>(staging.data()), static_cast<std::streamsize>(count));
+		return file.gcount() == static_cast<std::streamsize>(count) ? staging.data() : nullptr;
+	}
+
+	void VideoPlayer::readHeader() {
+		size_t offset = 0;
+		std::string line;
+		PXR_ASSERT(readLine(offset, line) && line.starts_with("YUV4MPEG2"), "Not a Y4M video file.");
+
+		// Space-separated tags, each a letter and a value: W1920 H1080 F30000:1001 C420jpeg XCOLORRANGE=FULL
+		long frameRateNumerator = 0;
+		long frameRateDenominator = 0;
+		bool fullRange = false;
+		size_t start = 0;
+		while (start < line.size()) {
+			size_t end = line.find(' ', start);
+			if (end == std::string::npos) {
+				end = line.size();
+			}
+			const std::string tag = line.substr(start, end - start);
+			start = end + 1;
+			if (tag.size() < 2) {
+				continue;
+			}
+			const std::string value = tag.substr(1);
+			long number = 0;
+			switch (tag[0]) {
+				case 'W':
+					PXR_ASSERT(parsePositive(value, number), "Invalid Y4M frame width.");
+					width = static_cast<int>(number);
+					break;
+				case 'H':
+					PXR_ASSERT(parsePositive(value, number), "Invalid Y4M frame height.");
+					height = static_cast<int>(number);
+					break;
+				case 'F': {
+					const size_t colon = value.find(':');
+					const bool valid = colon != std::string::npos &&
+									   parsePositive(value.substr(0, colon), frameRateNumerator) &&
+									   parsePositive(value.substr(colon + 1), frameRateDenominator);
+					PXR_ASSERT(valid, "Invalid Y4M frame rate.");
+					break;
+				}
+				case 'C':
+					PXR_ASSERT(value == "420" || value == "420jpeg" || value == "420paldv" || value == "420mpeg2",
+							   "Only 4:2:0 Y4M video is supported.");
+					break;
+				case 'X':
+					fullRange = fullRange || value == "COLORRANGE=FULL";
+					break;
+				default:
+					break;
+			}
+		}
+		PXR_ASSERT(width > 0 && height > 0, "Y4M header has no frame size.");
+		PXR_ASSERT(frameRateNumerator > 0, "Y4M header has no frame rate.");
+
+		frameRate = static_cast<double>(frameRateNumerator) / static_cast<double>(frameRateDenominator);
+		frameBytes = yuv::getBufferSize(width, height);
+		firstFrame = offset;
+		colorSpace.matrix = height >= 720 ? YuvMatrix::Bt709 : YuvMatrix::Bt601;
+		colorSpace.range = fullRange ? YuvRange::Full : YuvRange::Limited;
+	}
+
+	//--------------------------------------------------------------------------
+	// Reader thread
+	//--------------------------------------------------------------------------
+
+	void VideoPlayer::readLoop() {
+		size_t offset = firstFrame;
+		uint64_t index = 0;
+		bool frameSinceStart = false;
+		std::string line;
+		while (true) {
+			size_t slot = 0;
+			YuvColorSpace space;
+			{
+				std::unique_lock lock(mutex);
+				slotFreed.wait(lock, [&] { return stopping || count < ring.size(); });
+				if (stopping) {
+					return;
+				}
+				slot = (head + count) % ring.size();
+				space = colorSpace;
+			}
+
+			// Find the next frame that is not late yet; late ones are skipped without reading their planes.
+			const uint8_t *planes = nullptr;
+			while (!planes) {
+				if (!readLine(offset, line) || !line.starts_with("FRAME")) {
+					std::unique_lock lock(mutex);
+					endOfStream = true;
+					// A file without a single whole frame would wrap forever.
+					slotFreed.wait(lock, [&] { return stopping || (looping && frameSinceStart); });
+					if (stopping) {
+						return;
+					}
+					endOfStream = false;
+					offset = firstFrame;
+					frameSinceStart = false;
+					continue;
+				}
+				const size_t data = offset;
+				offset += frameBytes;
+				if (index < dueFrame.load(std::memory_order_relaxed)) {
+					++index;
+					droppedFrames.fetch_add(1, std::memory_order_relaxed);
+					frameSinceStart = true;
+					continue;
+				}
+				planes = readBytes(data, frameBytes);
+				if (!planes) {
+					offset = fileSize; // Truncated last frame.
+				}
+			}
+			frameSinceStart = true;
+
+			// The slot is outside [head, head + count), so update() leaves it alone while it is filled.
+			// Luma is copied as is; U and V rows are interleaved into the NV12 chroma plane the GPU samples.
+			uint8_t *const frame = ring[slot].frame.data();
+			const size_t lumaBytes = static_cast<size_t>(width) * height;
+			const size_t chromaBytes = (frameBytes - lumaBytes) / 2;
+			std::memcpy(frame, planes, lumaBytes);
+			const uint8_t *const u = planes + lumaBytes;
+			const uint8_t *const v = u + chromaBytes;
+			uint8_t *const uv = frame + lumaBytes;
+			for (size_t i = 0; i < chromaBytes; ++i) {
+				uv[2 * i] = u[i];
+				uv[2 * i + 1] = v[i];
+			}
+			bytesRead.fetch_add(frameBytes, std::memory_order_relaxed);
+			{
+				std::lock_guard lock(mutex);
+				ring[slot].space = space;
+				ring[slot].index = index;
+				++count;
+			}
+			++index;
+		}
+	}
+
+	//--------------------------------------------------------------------------
+	// Playback
+	//--------------------------------------------------------------------------
+
+	bool VideoPlayer::update(float deltaTime, Layer &target) {
+		PXR_ASSERT(target.getSurface().getWidth() == width && target.getSurface().getHeight() == height,
+				   "Video frames need a target layer of the video's size.");
+		// The frame due is the one at the start of this update, so the first update shows frame 0.
+		const auto due = static_cast<uint64_t>(position * frameRate);
+		dueFrame.store(due, std::memory_order_relaxed);
+		position += std::max(deltaTime, 0.0f);
+
+		// Late frames are dropped; the last one due stays in the ring until the layer has copied it.
+		bool freed = false;
+		bool shown = false;
+		{
+			std::lock_guard lock(mutex);
+			while (count > 1 && ring[(head + 1) % ring.size()].index <= due) {
+				droppedFrames.fetch_add(1, std::memory_order_relaxed);
+				head = (head + 1) % ring.size();
+				--count;
+				freed = true;
+			}
+			shown = count > 0 && ring[head].index <= due;
+		}
+		if (shown) {
+			// Only this thread moves head, and the reader does not touch slots in the ring while copying.
+			const YuvPlanes frame = yuv::wrapBuffer(YuvLayout::Nv12, ring[head].frame.data(), width, height);
+			target.presentNv12(frame, ring[head].space);
+			++shownFrames;
+			std::lock_guard lock(mutex);
+			head = (head + 1) % ring.size();
+			--count;
+			freed = true;
+		}
+		if (freed) {
+			slotFreed.notify_one();
+		}
+		return shown;
+	}
+
+	//--------------------------------------------------------------------------
+	// Settings and state
+	//--------------------------------------------------------------------------
+
+	int VideoPlayer::getWidth() const { return width; }
+
+	int VideoPlayer::getHeight() const { return height; }
+
+	double VideoPlayer::getFrameRate() const { return frameRate; }
+
+	void VideoPlayer::setLooping(bool enabled) {
+		{
+			std::lock_guard lock(mutex);
+			looping = enabled;
+		}
+		slotFreed.notify_one();
+	}
+
+	void VideoPlayer::setColorSpace(YuvColorSpace space) {
+		std::lock_guard lock(mutex);
+		colorSpace = space;
+	}
+
+	double VideoPlayer::getPosition() const { return position; }
+
+	bool VideoPlayer::isFinished() const {
+		std::lock_guard lock(mutex);
+		return endOfStream && count == 0;
+	}
+
+	uint64_t VideoPlayer::getShownFrames() const { return shownFrames; }
+
+	uint64_t VideoPlayer::getDroppedFrames() const { return droppedFrames.load(std::memory_order_relaxed); }
+
+	uint64_t VideoPlayer::getBytesRead() const { return bytesRead.load(std::memory_order_relaxed); }
+
+} // namespace pxr
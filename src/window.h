@@ -9,29 +9,25 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include "pxr/types.h"
 
-struct GLFWwindow;
-
 namespace pxr {
 
+	class Input;
+	class InputSource;
+
 	/**
-	 * @brief Manages an OpenGL window and context using GLFW.
+	 * @brief Platform window (or window-less output target) driven by the app loop.
 	 *
-	 * Handles window creation, event polling, buffer swapping, vsync, and access to dimensions.
+	 * Implementations own the connection to the window system, deliver events and
+	 * pace frames. Pixels are put on screen by a Presenter created for the window.
 	 */
 	class Window {
 	public:
-		/**
-		 * @brief Constructs a Window object.
-		 */
-		Window();
-
-		/**
-		 * @brief Destroys the window and terminates GLFW.
-		 */
-		~Window();
+		virtual ~Window() = default;
 
 		/**
 		 * @brief Creates a new window with the specified dimensions and title.
@@ -40,80 +36,108 @@ namespace pxr {
 		 * @param title Window title string.
 		 * @param vsync Whether to enable vertical sync.
 		 */
-		void create(int width, int height, const std::string &title, bool vsync);
+		virtual void create(int width, int height, const std::string &title, bool vsync) = 0;
+
+		/**
+		 * @brief Destroys the window.
+		 */
+		virtual void destroy() = 0;
+
+		/**
+		 * @brief Processes pending window system events. Should be called once per frame.
+		 */
+		virtual void pollEvents() = 0;
 
 		/**
-		 * @brief Destroys the window and its OpenGL context.
+		 * @brief Sleeps until window system events arrive, then processes them.
+		 *
+		 * May return early without any event.
+		 *
+		 * @param timeout Maximum time to wait in seconds, or a negative value to wait indefinitely.
 		 */
-		void destroy();
+		virtual void waitEvents(double timeout) = 0;
 
 		/**
-		 * @brief Polls GLFW events. Should be called once per frame.
+		 * @brief Finishes the frame: swaps buffers or waits for the next frame slot.
 		 */
-		void pollEvents() const;
+		virtual void swapBuffers() = 0;
 
 		/**
-		 * @brief Swaps the front and back buffers.
+		 * @brief Makes the window's rendering context current on the calling thread.
+		 *
+		 * Needed before presenting when several windows exist. Windows without a
+		 * context of their own ignore it.
 		 */
-		void swapBuffers() const;
+		virtual void makeCurrent() {}
 
 		/**
 		 * @brief Enables or disables vertical synchronization (vsync).
 		 * @param enabled True to enable vsync, false to disable.
 		 */
-		void setVSync(bool enabled);
+		virtual void setVSync(bool enabled) = 0;
 
 		/**
 		 * @brief Sets the window title.
 		 * @param title New window title.
 		 */
-		void setTitle(const std::string &title);
+		virtual void setTitle(const std::string &title) = 0;
 
 		/**
 		 * @brief Sets the window dimensions.
 		 * @param width New width in pixels.
 		 * @param height New height in pixels.
 		 */
-		void setSize(int width, int height);
+		virtual void setSize(int width, int height) = 0;
 
 		/**
 		 * @brief Checks whether the window should close (e.g., user pressed the close button).
 		 * @return True if the window should close.
 		 */
-		[[nodiscard]] bool shouldClose() const;
+		[[nodiscard]] virtual bool shouldClose() const = 0;
+
+		/**
+		 * @brief Creates the input source delivering this window's keyboard and mouse events.
+		 * @param input The input state receiving the events.
+		 * @return The source, or nullptr if the window has no input of its own.
+		 */
+		virtual std::unique_ptr<InputSource> createInputSource(Input &input) = 0;
+
+		/**
+		 * @brief Returns how many times the window system asked for the window contents again.
+		 *
+		 * Bumped when, for example, the window is uncovered after being hidden or
+		 * its framebuffer is resized.
+		 * Compare with an earlier value to detect new requests. Windows that keep
+		 * their contents always return 0.
+		 */
+		[[nodiscard]] virtual uint64_t getRefreshCount() const { return 0; }
 
 		/**
 		 * @brief Returns the current window width in pixels.
 		 */
-		[[nodiscard]] int getWidth() const;
+		[[nodiscard]] int getWidth() const { return width; }
 
 		/**
 		 * @brief Returns the current window height in pixels.
 		 */
-		[[nodiscard]] int getHeight() const;
+		[[nodiscard]] int getHeight() const { return height; }
 
 		/**
 		 * @brief Returns the current window size as a Size struct.
 		 */
-		[[nodiscard]] Size getSize() const;
+		[[nodiscard]] Size getSize() const { return Size{width, height}; }
 
 		/**
 		 * @brief Returns the current window title string.
 		 */
-		[[nodiscard]] const std::string &getTitle() const;
+		[[nodiscard]] const std::string &getTitle() const { return title; }
 
 		/**
 		 * @brief Checks if vsync is currently enabled.
 		 */
-		[[nodiscard]] bool isVSyncEnabled() const;
-
-		/**
-		 * @brief Returns the raw GLFW window handle.
-		 */
-		[[nodiscard]] GLFWwindow *getHandle() const;
+		[[nodiscard]] bool isVSyncEnabled() const { return vsyncEnabled; }
 
-	private:
-		GLFWwindow *handle = nullptr; ///< Native GLFW window handle.
+	protected:
 		int width = 640; ///< Current window width.
 		int height = 480; ///< Current window height.
 		std::string title = "Pixel Runtime"; ///< Current window title.
@@ -0,0 +1,180 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "x11_shm_presenter.h"
+
+#include <cstdlib>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include "error_handling.h"
+#include "gl_includes.h"
+#include "glfw_window.h"
+
+// Xlib last: it defines macros such as None and Bool.
+#define GLFW_EXPOSE_NATIVE_X11
+#include <GLFW/glfw3native.h>
+#include <X11/Xutil.h>
+#include <X11/extensions/XShm.h>
+
+namespace pxr {
+
+	namespace {
+
+		bool attachFailed = false;
+
+		int recordAttachError(Display *, XErrorEvent *) {
+			attachFailed = true;
+			return 0;
+		}
+
+	} // namespace
+
+	struct X11ShmPresenter::X11State {
+		Display *display = nullptr; ///< GLFW's X11 display connection.
+		::Window drawable = 0; ///< Native window.
+		GC gc = nullptr; ///< Graphics context used for puts.
+		XImage *image = nullptr; ///< Image receiving scaled frames.
+		XShmSegmentInfo shmInfo{}; ///< Shared segment backing the image.
+		bool useShm = false; ///< Whether the image lives in shared memory.
+
+		/**
+		 * @brief Creates a shared-memory image; returns false if the server cannot attach it.
+		 */
+		bool createShmImage(Visual *visual, int depth, int width, int height);
+
+		~X11State();
+	};
+
+	X11ShmPresenter::X11State::~X11State() {
+		if (image) {
+			if (useShm) {
+				XShmDetach(display, &shmInfo);
+				XSync(display, False);
+				image->data = nullptr;
+			}
+			XDestroyImage(image);
+		}
+		if (shmInfo.shmaddr) {
+			shmdt(shmInfo.shmaddr);
+		}
+		if (gc) {
+			XFreeGC(display, gc);
+		}
+	}
+
+	X11ShmPresenter::X11ShmPresenter() : x11(std::make_unique<X11State>()) {}
+
+	X11ShmPresenter::~X11ShmPresenter() = default;
+
+	void X11ShmPresenter::initialize(Window &window, const Surface &surface, int pixelSize) {
+		auto *glfwWindow = dynamic_cast<GlfwWindow *>(&window);
+		PXR_ASSERT(glfwWindow && glfwWindow->getClientApi() == GlfwWindow::ClientApi::X11,
+				   "The X11 presenter needs a GLFW window created for X11.");
+
+		X11State &state = *x11;
+		state.display = glfwGetX11Display();
+		state.drawable = glfwGetX11Window(glfwWindow->getHandle());
+		PXR_ASSERT(state.display != nullptr && state.drawable != 0, "Failed to get the native X11 window.");
+
+		XWindowAttributes attributes{};
+		XGetWindowAttributes(state.display, state.drawable, &attributes);
+		Visual *visual = attributes.visual;
+		PXR_ASSERT((attributes.depth == 24 || attributes.depth == 32) && visual->red_mask == 0xFF0000 &&
+						   visual->green_mask == 0x00FF00 && visual->blue_mask == 0x0000FF,
+				   "The X11 presenter needs a 24-bit RGB TrueColor visual.");
+
+		state.gc = XCreateGC(state.display, state.drawable, 0, nullptr);
+
+		const int width = surface.getWidth() * pixelSize;
+		const int height = surface.getHeight() * pixelSize;
+		state.useShm =
+				XShmQueryExtension(state.display) && state.createShmImage(visual, attributes.depth, width, height);
+		if (!state.useShm) {
+			auto *pixels = static_cast<char *>(std::calloc(static_cast<size_t>(width) * height, sizeof(uint32_t)));
+			PXR_ASSERT(pixels != nullptr, "Failed to allocate the X11 image.");
+			state.image =
+					XCreateImage(state.display, visual, attributes.depth, ZPixmap, 0, pixels, width, height, 32, 0);
+			PXR_ASSERT(state.image != nullptr, "Failed to create the X11 image.");
+		}
+		PXR_ASSERT(state.image->bits_per_pixel == 32, "The X11 presenter needs 32 bits per pixel.");
+
+		setTarget(reinterpret_cast<uint32_t *>(state.image->data), state.image->bytes_per_line / 4, width, height,
+				  pixelSize);
+		presentedWindow = &window;
+		seenRefreshes = window.getRefreshCount();
+	}
+
+	void X11ShmPresenter::present() {
+		// Exposed parts of the window are blank until drawn again, and damage tracking knows nothing of them.
+		const uint64_t refreshes = presentedWindow->getRefreshCount();
+		if (refreshes != seenRefreshes) {
+			seenRefreshes = refreshes;
+			markTargetDirty();
+		}
+		SoftwarePresenter::present();
+	}
+
+	bool X11ShmPresenter::X11State::createShmImage(Visual *visual, int depth, int width, int height) {
+		image = XShmCreateImage(display, visual, depth, ZPixmap, nullptr, &shmInfo, width, height);
+		if (!image) {
+			return false;
+		}
+
+		const size_t bytes = static_cast<size_t>(image->bytes_per_line) * image->height;
+		shmInfo.shmid = shmget(IPC_PRIVATE, bytes, IPC_CREAT | 0600);
+		if (shmInfo.shmid >= 0) {
+			shmInfo.shmaddr = static_cast<char *>(shmat(shmInfo.shmid, nullptr, 0));
+			if (shmInfo.shmaddr == reinterpret_cast<char *>(-1)) {
+				shmInfo.shmaddr = nullptr;
+			}
+		}
+
+		// Attaching fails asynchronously on remote displays; catch the error instead of aborting.
+		attachFailed = shmInfo.shmaddr == nullptr;
+		if (!attachFailed) {
+			image->data = shmInfo.shmaddr;
+			shmInfo.readOnly = False;
+			const auto previousHandler = XSetErrorHandler(recordAttachError);
+			XShmAttach(display, &shmInfo);
+			XSync(display, False);
+			XSetErrorHandler(previousHandler);
+		}
+		if (shmInfo.shmid >= 0) {
+			// Mark the segment for removal now; it stays alive until both sides detach.
+			shmctl(shmInfo.shmid, IPC_RMID, nullptr);
+		}
+
+		if (attachFailed) {
+			image->data = nullptr;
+			XDestroyImage(image);
+			image = nullptr;
+			if (shmInfo.shmaddr) {
+				shmdt(shmInfo.shmaddr);
+				shmInfo.shmaddr = nullptr;
+			}
+			return false;
+		}
+		return true;
+	}
+
+	void X11ShmPresenter::flush(const Rect &damage) {
+		X11State &state = *x11;
+		if (state.useShm) {
+			XShmPutImage(state.display, state.drawable, state.gc, state.image, damage.x, damage.y, damage.x, damage.y,
+						 damage.width, damage.height, False);
+			// The server reads the shared image asynchronously; wait so the next frame cannot tear it.
+			XSync(state.display, False);
+		} else {
+			XPutImage(state.display, state.drawable, state.gc, state.image, damage.x, damage.y, damage.x, damage.y,
+					  damage.width, damage.height);
+			XFlush(state.display);
+		}
+	}
+
+} // namespace pxr
@@ -0,0 +1,52 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include <memory>
+#include "software_presenter.h"
+
+namespace pxr {
+
+	/**
+	 * @brief Presents frames into an X11 window through MIT-SHM images, without OpenGL.
+	 *
+	 * Frames are scaled on the CPU straight into an image shared with the X
+	 * server, and only the damaged region is sent with XShmPutImage(). On displays
+	 * without the MIT-SHM extension (e.g. remote connections) it falls back to
+	 * XPutImage(). The window keeps no copy of its own, so the whole image is
+	 * sent again whenever the server asks for a repaint (e.g. after an Expose).
+	 * Requires a GlfwWindow created with GlfwWindow::ClientApi::X11 and a 24- or
+	 * 32-bit TrueColor visual.
+	 */
+	class X11ShmPresenter final : public SoftwarePresenter {
+	public:
+		X11ShmPresenter();
+		~X11ShmPresenter() override;
+
+		X11ShmPresenter(const X11ShmPresenter &) = delete;
+		X11ShmPresenter &operator=(const X11ShmPresenter &) = delete;
+
+		void initialize(Window &window, const Surface &surface, int pixelSize) override;
+
+		void present() override;
+
+	protected:
+		void flush(const Rect &damage) override;
+
+	private:
+		/// X11 objects, kept out of this header so Xlib macros do not leak into the runtime.
+		struct X11State;
+
+		std::unique_ptr<X11State> x11; ///< Display, window, image and shared segment.
+		const Window *presentedWindow = nullptr; ///< Window presented into; reports when X needs the contents again.
+		uint64_t seenRefreshes = 0; ///< Refresh count of the window at the last present().
+	};
+
+} // namespace pxr
@@ -0,0 +1,216 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "pxr/yuv.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include "error_handling.h"
+#include "kernel_table.h"
+#include "pixel_kernels.h"
+#include "pxr/surface.h"
+#include "thread_pool.h"
+#include "yuv_transform.h"
+
+namespace pxr {
+
+	namespace {
+
+		/// Row pairs converted per task; 16 pairs of a 1080p frame are about 250 KB of pixels.
+		constexpr int BandRowPairs = 16;
+
+		/// Images with fewer pixels convert on the calling thread; waking the workers would cost more.
+		constexpr int MinParallelPixels = 320 * 240;
+
+		/// Guards the pool, which runs one parallelFor() at a time.
+		std::mutex poolMutex;
+
+		/**
+		 * @brief Workers shared by every conversion, started by the first large one. Call with poolMutex held.
+		 *
+		 * Conversions usually run beside the frame loop, e.g. on a video reader
+		 * thread while the command executor's pool uses every hardware thread.
+		 * Half the hardware threads leaves room for the frame instead of
+		 * oversubscribing the cores.
+		 */
+		ThreadPool &getPool() {
+			static ThreadPool pool(std::max(2, static_cast<int>(std::thread::hardware_concurrency()) / 2));
+			return pool;
+		}
+
+		/**
+		 * @brief Calls convert for consecutive ranges of row pairs covering [0, rowPairs).
+		 *
+		 * Bands run on the pool when the image is large enough. A conversion
+		 * started while another one holds the pool runs on its own thread
+		 * instead of waiting.
+		 */
+		void forEachBand(int width, int rowPairs, const std::function<void(int, int)> &convert) {
+			const int bands = (rowPairs + BandRowPairs - 1) / BandRowPairs;
+			if (bands > 1 && static_cast<int64_t>(width) * rowPairs * 2 >= MinParallelPixels) {
+				std::unique_lock lock(poolMutex, std::try_to_lock);
+				if (lock.owns_lock()) {
+					getPool().parallelFor(bands, [&](int band) {
+						convert(band * BandRowPairs, std::min(rowPairs, (band + 1) * BandRowPairs));
+					});
+					return;
+				}
+			}
+			convert(0, rowPairs);
+		}
+
+		int toFixed(float value, int fractionBits) {
+			return static_cast<int>(std::lround(value * static_cast<float>(1 << fractionBits)));
+		}
+
+		/// Rounds the transform to the kernels' constants, keeping the weights' sums exact so white and grey survive.
+		kernels::YuvCoefficients getYuvCoefficients(YuvColorSpace space) {
+			const YuvTransform t = getYuvTransform(space);
+			kernels::YuvCoefficients k{};
+			k.lumaRed = toFixed(t.toYuv[0][0], 14);
+			k.lumaBlue = toFixed(t.toYuv[0][2], 14);
+			k.lumaGreen = toFixed(t.toYuv[0][0] + t.toYuv[0][1] + t.toYuv[0][2], 14) - k.lumaRed - k.lumaBlue;
+			k.lumaOffset = static_cast<int>(std::lround(t.offset[0] * 255.0f));
+			k.uRed = toFixed(t.toYuv[1][0], 14);
+			k.uBlue = toFixed(t.toYuv[1][2], 14);
+			k.uGreen = -k.uRed - k.uBlue;
+			k.vRed = toFixed(t.toYuv[2][0], 14);
+			k.vBlue = toFixed(t.toYuv[2][2], 14);
+			k.vGreen = -k.vRed - k.vBlue;
+			k.yScale = toFixed(t.toRgb[0][0], 13);
+			k.redV = toFixed(t.toRgb[0][2], 13);
+			k.greenU = toFixed(t.toRgb[1][1], 13);
+			k.greenV = toFixed(t.toRgb[1][2], 13);
+			k.blueU = toFixed(t.toRgb[2][1], 13);
+			return k;
+		}
+
+		/// Returns the V plane; the V of an interleaved plane is one byte after each U.
+		uint8_t *getVPlane(const YuvPlanes &planes) {
+			return planes.layout == YuvLayout::Nv12 ? planes.u + 1 : planes.v;
+		}
+
+		size_t getVStride(const YuvPlanes &planes) {
+			return planes.layout == YuvLayout::Nv12 ? planes.uStride : planes.vStride;
+		}
+
+	} // namespace
+
+	YuvTransform getYuvTransform(YuvColorSpace space) {
+		const float kr = space.matrix == YuvMatrix::Bt709 ? 0.2126f : 0.299f;
+		const float kb = space.matrix == YuvMatrix::Bt709 ? 0.0722f : 0.114f;
+		const float kg = 1.0f - kr - kb;
+		const bool limited = space.range == YuvRange::Limited;
+		const float lumaScale = limited ? 219.0f / 255.0f : 1.0f;
+		const float chromaScale = limited ? 224.0f / 255.0f : 1.0f;
+		const float cb = 2.0f * (1.0f - kb); // B - Y = cb * U
+		const float cr = 2.0f * (1.0f - kr); // R - Y = cr * V
+
+		YuvTransform t{};
+		const float toYuv[3][3] = {
+			{kr * lumaScale, kg * lumaScale, kb * lumaScale},
+			{-kr / cb * chromaScale, -kg / cb * chromaScale, 0.5f * chromaScale},
+			{0.5f * chromaScale, -kg / cr * chromaScale, -kb / cr * chromaScale},
+		};
+		const float toRgb[3][3] = {
+			{1.0f / lumaScale, 0.0f, cr / chromaScale},
+			{1.0f / lumaScale, -cb * kb / kg / chromaScale, -cr * kr / kg / chromaScale},
+			{1.0f / lumaScale, cb / chromaScale, 0.0f},
+		};
+		std::copy(&toYuv[0][0], &toYuv[0][0] + 9, &t.toYuv[0][0]);
+		std::copy(&toRgb[0][0], &toRgb[0][0] + 9, &t.toRgb[0][0]);
+		t.offset[0] = limited ? 16.0f / 255.0f : 0.0f;
+		t.offset[1] = 128.0f / 255.0f;
+		t.offset[2] = 128.0f / 255.0f;
+		return t;
+	}
+
+	namespace yuv {
+
+		size_t getBufferSize(int width, int height) {
+			width = std::max(width, 0);
+			height = std::max(height, 0);
+			const size_t chromaSize = static_cast<size_t>((width + 1) / 2) * ((height + 1) / 2);
+			return static_cast<size_t>(width) * height + chromaSize * 2;
+		}
+
+		YuvPlanes wrapBuffer(YuvLayout layout, uint8_t *buffer, int width, int height) {
+			const size_t chromaWidth = (width + 1) / 2;
+			const size_t chromaHeight = (height + 1) / 2;
+			YuvPlanes planes;
+			planes.layout = layout;
+			planes.width = width;
+			planes.height = height;
+			planes.y = buffer;
+			planes.yStride = width;
+			planes.u = buffer + static_cast<size_t>(width) * height;
+			if (layout == YuvLayout::Nv12) {
+				planes.uStride = chromaWidth * 2;
+			} else {
+				planes.uStride = chromaWidth;
+				planes.v = planes.u + chromaWidth * chromaHeight;
+				planes.vStride = chromaWidth;
+			}
+			return planes;
+		}
+
+		void fromSurface(const Surface &src, const YuvPlanes &dst, YuvColorSpace space) {
+			PXR_ASSERT(src.getWidth() == dst.width && src.getHeight() == dst.height,
+					   "Surface and YUV planes must have the same size");
+			const int width = dst.width;
+			const int height = dst.height;
+			if (width <= 0 || height <= 0) {
+				return;
+			}
+			const kernels::YuvCoefficients k = getYuvCoefficients(space);
+			const int chromaStep = dst.layout == YuvLayout::Nv12 ? 2 : 1;
+			uint8_t *v = getVPlane(dst);
+			const size_t vStride = getVStride(dst);
+			const uint32_t *pixels = src.data();
+			forEachBand(width, (height + 1) / 2, [&](int first, int last) {
+				for (int pair = first; pair < last; ++pair) {
+					const size_t row = static_cast<size_t>(pair) * 2;
+					// An odd last row pairs with itself.
+					const size_t next = std::min<size_t>(row + 1, height - 1);
+					kernels::packYuvRows(dst.y + row * dst.yStride, dst.y + next * dst.yStride,
+										 dst.u + pair * dst.uStride, v + pair * vStride, chromaStep,
+										 pixels + row * width, pixels + next * width, width, k);
+				}
+			});
+		}
+
+		void toSurface(const YuvPlanes &src, Surface &dst, YuvColorSpace space) {
+			PXR_ASSERT(src.width == dst.getWidth() && src.height == dst.getHeight(),
+					   "Surface and YUV planes must have the same size");
+			const int width = src.width;
+			const int height = src.height;
+			if (width <= 0 || height <= 0) {
+				return;
+			}
+			const kernels::YuvCoefficients k = getYuvCoefficients(space);
+			const int chromaStep = src.layout == YuvLayout::Nv12 ? 2 : 1;
+			uint8_t *v = getVPlane(src);
+			const size_t vStride = getVStride(src);
+			uint32_t *pixels = dst.data();
+			forEachBand(width, (height + 1) / 2, [&](int first, int last) {
+				for (int row = first * 2; row < std::min(last * 2, height); ++row) {
+					const size_t pair = row / 2;
+					kernels::unpackYuvRow(pixels + static_cast<size_t>(row) * width, src.y + row * src.yStride,
+										  src.u + pair * src.uStride, v + pair * vStride, chromaStep, width, k);
+				}
+			});
+			dst.markDirty();
+		}
+
+	} // namespace yuv
+
+} // namespace pxr
@@ -0,0 +1,38 @@
+/*
+ * Part of the Pixel Runtime project - https://github.com/angelotadres/pixel_runtime
+ *
+ * Copyright (c) 2025 Angelo Tadres
+ *
+ * Licensed under the MIT License.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#pragma once
+
+#include "pxr/yuv.h"
+
+/**
+ * @file yuv_transform.h
+ * @brief Matrices of the YUV color spaces, shared by the CPU kernels and the NV12 shader of Graphics.
+ */
+
+namespace pxr {
+
+	/**
+	 * @brief Color space conversion on values from 0 to 1.
+	 *
+	 * YUV = toYuv * RGB + offset, and RGB = toRgb * (YUV - offset). The fixed-point
+	 * constants of the kernels are rounded from these, so both sides agree.
+	 */
+	struct YuvTransform {
+		float toYuv[3][3]; ///< Rows give Y, U and V from red, green and blue.
+		float toRgb[3][3]; ///< Rows give red, green and blue from Y, U and V.
+		float offset[3]; ///< Y, U and V of black.
+	};
+
+	/**
+	 * @brief Returns the transform of a color space.
+	 */
+	YuvTransform getYuvTransform(YuvColorSpace space);
+
+} // namespace pxr